@@ -0,0 +1,304 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: CommandBuffer
+* Description:
+*     Implements recording of deferred structural changes and their batched playback.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+
+#include <pch.h>
+#include "CommandBuffer.h"
+#include <Core/ECS/Entity/Entity.h>
+#include <Core/ECS/Component/Component.h>
+
+namespace {
+
+/// @brief  orders commands across every thread's buffer
+std::atomic< uint64_t > s_NextSequence = 0;
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+// CommandBuffer
+//-----------------------------------------------------------------------------
+
+CommandBuffer::~CommandBuffer()
+{
+    Clear();
+}
+
+EntityHandle CommandBuffer::CreateEntity( StringId name, EntityHandle parent )
+{
+    // reserve the slot now so the handle can be used by later commands
+    const EntityHandle handle = Entities()->Create( nullptr );
+
+    record( { CommandType::Create, 0, handle, parent, name, nullptr, typeid( void ) } );
+    return handle;
+}
+
+void CommandBuffer::DestroyEntity( EntityHandle entity )
+{
+    record( { CommandType::Destroy, 0, entity, {}, {}, nullptr, typeid( void ) } );
+}
+
+void CommandBuffer::AddComponent( EntityHandle entity, Component* component )
+{
+    record( { CommandType::AddComponent, 0, entity, {}, {}, component, typeid( void ) } );
+}
+
+void CommandBuffer::RemoveComponent( EntityHandle entity, std::type_index type )
+{
+    record( { CommandType::RemoveComponent, 0, entity, {}, {}, nullptr, type } );
+}
+
+void CommandBuffer::Clear()
+{
+    for ( Command const& command : m_Commands )
+    {
+        if ( command.m_Type == CommandType::Create )
+            Entities()->Release( command.m_Target );
+        else if ( command.m_Type == CommandType::AddComponent )
+            delete command.m_Component;
+    }
+
+    m_Commands.clear();
+}
+
+void CommandBuffer::record( Command command )
+{
+    command.m_Sequence = s_NextSequence.fetch_add( 1, std::memory_order_relaxed );
+    m_Commands.push_back( command );
+}
+
+//-----------------------------------------------------------------------------
+// CommandQueue
+//-----------------------------------------------------------------------------
+
+CommandBuffer& CommandQueue::ThisThread()
+{
+    // gives the buffer back when the thread exits, so short-lived threads don't pile up
+    struct Owner
+    {
+        CommandBuffer* m_Buffer = nullptr;
+
+        ~Owner()
+        {
+            if ( m_Buffer != nullptr )
+                CommandQueue::Instance().retireBuffer( m_Buffer );
+            m_Buffer = nullptr;
+        }
+    };
+
+    thread_local Owner t_Owner;
+    if ( t_Owner.m_Buffer == nullptr )
+        t_Owner.m_Buffer = acquireBuffer();
+    return *t_Owner.m_Buffer;
+}
+
+CommandBuffer* CommandQueue::acquireBuffer()
+{
+    std::lock_guard< std::mutex > lock( m_Mutex );
+    if ( !m_FreeBuffers.empty() )
+    {
+        CommandBuffer* buffer = m_FreeBuffers.back();
+        m_FreeBuffers.pop_back();
+        return buffer;
+    }
+
+    m_Buffers.push_back( std::make_unique< CommandBuffer >() );
+    return m_Buffers.back().get();
+}
+
+void CommandQueue::retireBuffer( CommandBuffer* buffer )
+{
+    std::lock_guard< std::mutex > lock( m_Mutex );
+    m_FreeBuffers.push_back( buffer );
+}
+
+std::size_t CommandQueue::GetBufferCount()
+{
+    std::lock_guard< std::mutex > lock( m_Mutex );
+    return m_Buffers.size();
+}
+
+std::size_t CommandQueue::GetPendingCount()
+{
+    std::lock_guard< std::mutex > lock( m_Mutex );
+
+    std::size_t count = 0;
+    for ( auto const& buffer : m_Buffers )
+        count += buffer->Size();
+    return count;
+}
+
+void CommandQueue::Playback()
+{
+    using Command = CommandBuffer::Command;
+    using CommandType = CommandBuffer::CommandType;
+
+    // take everything out of the buffers first, so commands recorded during playback
+    // (e.g. from OnInit) wait for the next sync point
+    PlaybackState state;
+    std::vector< Command > commands;
+    {
+        std::lock_guard< std::mutex > lock( m_Mutex );
+        for ( auto const& buffer : m_Buffers )
+        {
+            commands.insert( commands.end(), buffer->m_Commands.begin(), buffer->m_Commands.end() );
+            buffer->m_Commands.clear();
+        }
+    }
+
+    if ( commands.empty() )
+        return;
+
+    // creations first, then Component changes grouped per Entity (in recording order),
+    // then destructions
+    auto phase = []( CommandType type )
+    {
+        switch ( type )
+        {
+            case CommandType::Create:           return 0;
+            case CommandType::AddComponent:
+            case CommandType::RemoveComponent:  return 1;
+            case CommandType::Destroy:          return 2;
+        }
+        return 2;
+    };
+    std::sort( commands.begin(), commands.end(), [ &phase ]( Command const& a, Command const& b )
+    {
+        const int phaseA = phase( a.m_Type );
+        const int phaseB = phase( b.m_Type );
+        if ( phaseA != phaseB )
+            return phaseA < phaseB;
+        if ( phaseA == 1 && a.m_Target.m_Index != b.m_Target.m_Index )
+            return a.m_Target.m_Index < b.m_Target.m_Index;
+        return a.m_Sequence < b.m_Sequence;
+    } );
+
+    std::size_t next = 0;
+    for ( ; next < commands.size() && phase( commands[ next ].m_Type ) < 2; ++next )
+        apply( commands[ next ], state );
+
+    // new Entities enter the world with all of their Components
+    for ( Entity* entity : state.m_Created )
+        entity->Init();
+
+    for ( ; next < commands.size(); ++next )
+        apply( commands[ next ], state );
+
+    reclaim( state.m_Destroyed );
+}
+
+void CommandQueue::apply( CommandBuffer::Command const& command, PlaybackState& state )
+{
+    using CommandType = CommandBuffer::CommandType;
+
+    switch ( command.m_Type )
+    {
+        case CommandType::Create:
+        {
+            Entity* entity = new Entity( command.m_Target );
+            entity->SetName( command.m_Name );
+            entity->m_IsOwnedByWorld = true;
+
+            if ( Entity* parent = Entities()->Resolve( command.m_Parent ) )
+                entity->SetParent( parent );
+
+            state.m_Created.push_back( entity );
+            state.m_CreatedSet.insert( entity );
+            break;
+        }
+
+        case CommandType::AddComponent:
+        {
+            Entity* entity = Entities()->Resolve( command.m_Target );
+            if ( entity == nullptr || entity->FindComponent( command.m_Component->GetType() ) != nullptr )
+            {
+                ETERNUM_LOG_WARNING("dropping deferred Component add to a stale Entity or duplicate type");
+                delete command.m_Component;
+                break;
+            }
+
+            entity->AddComponent( command.m_Component );
+
+            // Entities created in this batch initialize all of their Components at once
+            if ( state.m_CreatedSet.count( entity ) == 0 )
+                command.m_Component->OnInit();
+            break;
+        }
+
+        case CommandType::RemoveComponent:
+        {
+            if ( Entity* entity = Entities()->Resolve( command.m_Target ) )
+            {
+                if ( Component* component = entity->FindComponent( command.m_ComponentType ) )
+                    component->OnExit();
+                entity->RemoveComponent( command.m_ComponentType );
+            }
+            break;
+        }
+
+        case CommandType::Destroy:
+        {
+            Entity* entity = Entities()->Resolve( command.m_Target );
+            if ( entity == nullptr )
+                break;
+
+            // flag the whole subtree directly; Destroy() would record more commands
+            std::vector< Entity* > stack{ entity };
+            while ( !stack.empty() )
+            {
+                Entity* node = stack.back();
+                stack.pop_back();
+                node->m_IsDestroyed = true;
+                stack.insert( stack.end(), node->m_Children.begin(), node->m_Children.end() );
+            }
+
+            state.m_Destroyed.push_back( entity );
+            break;
+        }
+    }
+}
+
+void CommandQueue::reclaim( std::vector< Entity* >& destroyed )
+{
+    std::sort( destroyed.begin(), destroyed.end() );
+    destroyed.erase( std::unique( destroyed.begin(), destroyed.end() ), destroyed.end() );
+
+    const std::unordered_set< Entity* > doomed( destroyed.begin(), destroyed.end() );
+    auto hasDoomedAncestor = [ &doomed ]( Entity const* entity )
+    {
+        for ( Entity const* parent = entity->GetParent(); parent; parent = parent->GetParent() )
+            if ( doomed.count( const_cast< Entity* >( parent ) ) )
+                return true;
+        return false;
+    };
+
+    // only delete the roots of destroyed hierarchies; descendants go with them
+    std::vector< Entity* > roots;
+    for ( Entity* entity : destroyed )
+        if ( !hasDoomedAncestor( entity ) )
+            roots.push_back( entity );
+
+    // exit the Components of the whole subtree, children before their parents, directly
+    // rather than through Exit(), which would first move the root's range out of its
+    // parent's; the destructor detaches it in place instead
+    std::vector< Entity* > subtree;
+    for ( Entity* root : roots )
+    {
+        subtree.assign( 1, root );
+        for ( std::size_t i = 0; i < subtree.size(); ++i )
+            subtree.insert( subtree.end(), subtree[ i ]->m_Children.begin(), subtree[ i ]->m_Children.end() );
+
+        for ( auto node = subtree.rbegin(); node != subtree.rend(); ++node )
+            for ( auto& [ type, component ] : ( *node )->m_Components )
+                component->OnExit();
+
+        delete root;
+    }
+}
@@ -0,0 +1,201 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: CommandBuffer
+* Description:
+*     Deferred structural changes for the ECS. Systems record Entity creation, destruction
+*     and Component additions/removals into a buffer owned by their thread; the Runtime
+*     plays every buffer back in one sorted batch at its sync points and reclaims the
+*     destroyed hierarchies.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef COMMANDBUFFER_H
+#define COMMANDBUFFER_H
+
+#include <pch.h>
+#include <Core/ECS/Entity/EntityRegistry.h>
+#include <unordered_set>
+
+class Entity;
+class Component;
+
+/// @brief  list of recorded structural changes; only ever written by a single thread
+class CommandBuffer
+{
+public:
+    CommandBuffer() = default;
+
+    /// @brief  destructor, discards every command that was never played back
+    ~CommandBuffer();
+
+    // Prevent copy construction and assignment
+    CommandBuffer( CommandBuffer const& ) = delete;
+    CommandBuffer& operator=( CommandBuffer const& ) = delete;
+
+//-----------------------------------------------------------------------------
+// Recording
+//-----------------------------------------------------------------------------
+
+    /// @brief  records the creation of an Entity
+    /// @param  name    the name of the new Entity
+    /// @param  parent  the parent of the new Entity (null for a root)
+    /// @return handle of the new Entity; it resolves once the buffer has been played back,
+    ///         and can already be used as the target of other commands
+    EntityHandle CreateEntity( StringId name = {}, EntityHandle parent = {} );
+
+    /// @brief  records the destruction of an Entity and all of its descendants
+    /// @param  entity  the Entity to destroy; it must have been allocated with new, as
+    ///         playback deletes it
+    void DestroyEntity( EntityHandle entity );
+
+    /// @brief  records adding a Component to an Entity
+    /// @param  entity      the Entity to add to
+    /// @param  component   the Component to add; the buffer takes ownership
+    void AddComponent( EntityHandle entity, Component* component );
+
+    /// @brief  records removing the Component of an exact type from an Entity
+    /// @param  entity  the Entity to remove from
+    /// @param  type    the exact type of the Component to remove
+    void RemoveComponent( EntityHandle entity, std::type_index type );
+
+    /// @brief  records removing the Component of an exact type from an Entity
+    /// @tparam ComponentType   the exact type of the Component to remove
+    /// @param  entity  the Entity to remove from
+    template < typename ComponentType >
+    void RemoveComponent( EntityHandle entity ) { RemoveComponent( entity, typeid( ComponentType ) ); }
+
+    /// @brief  discards every recorded command without applying it
+    /// @note   deletes the owned Components and releases the handles reserved for Entities
+    ///         that will now never be created
+    void Clear();
+
+//-----------------------------------------------------------------------------
+// Public Accessors
+//-----------------------------------------------------------------------------
+
+    /// @brief  gets the number of recorded commands
+    std::size_t Size() const { return m_Commands.size(); }
+
+    /// @brief  gets whether nothing has been recorded
+    bool Empty() const { return m_Commands.empty(); }
+
+//-----------------------------------------------------------------------------
+// Private Types
+//-----------------------------------------------------------------------------
+private:
+    friend class CommandQueue;
+
+    /// @brief  kinds of command, in the order their phases are applied
+    enum class CommandType : uint8_t
+    {
+        Create,
+        AddComponent,
+        RemoveComponent,
+        Destroy
+    };
+
+    struct Command
+    {
+        CommandType m_Type;
+
+        /// @brief  global recording order, used to keep per-Entity changes in sequence
+        uint64_t m_Sequence;
+
+        /// @brief  the Entity the command applies to
+        EntityHandle m_Target;
+
+        /// @brief  Create: parent of the new Entity
+        EntityHandle m_Parent;
+
+        /// @brief  Create: name of the new Entity
+        StringId m_Name;
+
+        /// @brief  AddComponent: the owned Component
+        Component* m_Component;
+
+        /// @brief  RemoveComponent: the exact type to remove
+        std::type_index m_ComponentType;
+    };
+
+    /// @brief  appends a command, stamping it with the next sequence number
+    void record( Command command );
+
+    std::vector< Command > m_Commands;
+};
+
+/// @brief  owns one CommandBuffer per recording thread and plays them back at sync points
+class CommandQueue
+{
+public:
+    /// @brief  gets the global CommandQueue
+    static CommandQueue& Instance()
+    {
+        static CommandQueue instance;
+        return instance;
+    }
+
+    /// @brief  gets the CommandBuffer of the calling thread
+    /// @return the buffer; recording into it needs no locking
+    CommandBuffer& ThisThread();
+
+    /// @brief  applies every recorded command in one sorted batch, then reclaims destroyed
+    ///         hierarchies
+    /// @note   must be called from a sync point, when no thread is recording or iterating
+    void Playback();
+
+    /// @brief  gets the number of commands waiting for playback across all threads
+    std::size_t GetPendingCount();
+
+    /// @brief  gets the number of CommandBuffers allocated, including ones whose threads
+    ///         have exited and that wait to be reused
+    std::size_t GetBufferCount();
+
+    // Prevent copy construction and assignment
+    CommandQueue( CommandQueue const& ) = delete;
+    CommandQueue& operator=( CommandQueue const& ) = delete;
+
+private:
+    /// @brief  constructor, makes sure the EntityRegistry outlives the buffers that release
+    ///         their reserved handles into it
+    CommandQueue() { Entities(); }
+
+    /// @brief  Entities touched by the batch being played back
+    struct PlaybackState
+    {
+        std::vector< Entity* > m_Created;
+        std::unordered_set< Entity* > m_CreatedSet;
+        std::vector< Entity* > m_Destroyed;
+    };
+
+    /// @brief  hands the calling thread a buffer, reusing one whose thread has exited
+    CommandBuffer* acquireBuffer();
+
+    /// @brief  makes a buffer available to the next thread; commands still in it are
+    ///         played back as usual
+    void retireBuffer( CommandBuffer* buffer );
+
+    /// @brief  applies one command
+    static void apply( CommandBuffer::Command const& command, PlaybackState& state );
+
+    /// @brief  exits the Components of every destroyed hierarchy, then deletes each
+    ///         destroyed Entity whose parent is not being destroyed too
+    static void reclaim( std::vector< Entity* >& destroyed );
+
+    /// @brief  every buffer allocated, in use or retired; never freed before exit
+    std::vector< std::unique_ptr< CommandBuffer > > m_Buffers;
+
+    /// @brief  buffers whose threads have exited, waiting for a new thread
+    std::vector< CommandBuffer* > m_FreeBuffers;
+    std::mutex m_Mutex;
+};
+
+/// @brief  gets the global CommandQueue
+inline CommandQueue* Commands()
+{
+    return &CommandQueue::Instance();
+}
+
+#endif //COMMANDBUFFER_H
@@ -0,0 +1,60 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: ChangeTracker
+* Description:
+*     Implements the world version counter and the per-type change logs.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+
+#include <pch.h>
+#include "ChangeTracker.h"
+
+ChangeVersion ChangeTracker::Advance()
+{
+    const ChangeVersion previous = m_Version.fetch_add( 1, std::memory_order_acq_rel );
+    if ( previous <= kRetainedVersions )
+        return previous;
+
+    const ChangeVersion cutoff = previous - kRetainedVersions;
+    for ( Log& log : m_Logs )
+    {
+        std::lock_guard< std::mutex > lock( log.m_Mutex );
+        if ( log.m_Entries.empty() || log.m_Entries.front().m_Version > cutoff )
+            continue;
+
+        auto keep = std::partition_point( log.m_Entries.begin(), log.m_Entries.end(),
+                                          [ cutoff ]( Entry const& entry ) { return entry.m_Version <= cutoff; } );
+        log.m_Entries.erase( log.m_Entries.begin(), keep );
+        log.m_Horizon = cutoff;
+    }
+    return previous;
+}
+
+void ChangeTracker::Record( ComponentTypeId type, EntityHandle entity, ChangeVersion version )
+{
+    Log& log = m_Logs[ type ];
+    std::lock_guard< std::mutex > lock( log.m_Mutex );
+    log.m_Entries.push_back( { version, entity } );
+}
+
+void ChangeTracker::RecordBatch( ComponentTypeId type, EntityHandle const* entities, std::size_t count, ChangeVersion version )
+{
+    if ( count == 0 )
+        return;
+
+    Log& log = m_Logs[ type ];
+    std::lock_guard< std::mutex > lock( log.m_Mutex );
+    for ( std::size_t i = 0; i < count; ++i )
+        log.m_Entries.push_back( { version, entities[ i ] } );
+}
+
+std::size_t ChangeTracker::GetLogSize( ComponentTypeId type )
+{
+    Log& log = m_Logs[ type ];
+    std::lock_guard< std::mutex > lock( log.m_Mutex );
+    return log.m_Entries.size();
+}
@@ -0,0 +1,131 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: ChangeTracker
+* Description:
+*     Write versioning for Components. Every Component remembers the world version of its
+*     last write, and each Component type keeps a log of the Entities written at each
+*     version, so systems can visit only what changed since they last ran.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef CHANGETRACKER_H
+#define CHANGETRACKER_H
+
+#include <pch.h>
+#include <Core/ECS/Entity/EntityRegistry.h>
+#include <Core/ECS/Component/ComponentType.h>
+
+/// @brief  world version a Component was last written at
+using ChangeVersion = uint64_t;
+
+class ChangeTracker
+{
+public:
+    /// @brief  number of versions the change logs remember; asking about anything older
+    ///         falls back to checking every Component's version
+    static constexpr ChangeVersion kRetainedVersions = 1024;
+
+    /// @brief  gets the global ChangeTracker
+    /// @note   intentionally never destroyed since Components may be written during
+    ///         static destruction
+    static ChangeTracker& Instance()
+    {
+        static ChangeTracker* instance = new ChangeTracker();
+        return *instance;
+    }
+
+//-----------------------------------------------------------------------------
+// Versions
+//-----------------------------------------------------------------------------
+
+    /// @brief  gets the version writes are currently stamped with
+    ChangeVersion GetVersion() const { return m_Version.load( std::memory_order_acquire ); }
+
+    /// @brief  starts a new version and forgets log entries that are too old
+    /// @return the version that was current; a system that remembers it and later asks
+    ///         for changes since it sees every write made after this call
+    /// @note   call only when no thread is writing Components, e.g. at sync points or
+    ///         before a system iterates
+    ChangeVersion Advance();
+
+//-----------------------------------------------------------------------------
+// Change Logs
+//-----------------------------------------------------------------------------
+
+    /// @brief  records that a Component type was written on an Entity
+    /// @param  type    the Component type
+    /// @param  entity  the Entity owning the Component
+    /// @param  version the version the write was stamped with
+    void Record( ComponentTypeId type, EntityHandle entity, ChangeVersion version );
+
+    /// @brief  records several writes of one Component type under a single lock
+    /// @param  type        the Component type
+    /// @param  entities    the Entities owning the written Components
+    /// @param  count       the number of Entities
+    /// @param  version     the version the writes were stamped with
+    void RecordBatch( ComponentTypeId type, EntityHandle const* entities, std::size_t count, ChangeVersion version );
+
+    /// @brief  calls a function for every logged write of a type newer than a version
+    /// @param  type    the Component type
+    /// @param  since   only writes stamped after this version are visited
+    /// @param  func    called as func( EntityHandle ); an Entity may be visited once per
+    ///                 version it was written at, and may no longer exist
+    /// @return false if the log no longer reaches back to since, in which case nothing
+    ///         was visited and the caller must check every Component instead
+    template < typename Func >
+    bool ForEachSince( ComponentTypeId type, ChangeVersion since, Func&& func )
+    {
+        Log& log = m_Logs[ type ];
+        std::lock_guard< std::mutex > lock( log.m_Mutex );
+        if ( since < log.m_Horizon )
+            return false;
+
+        // entries are appended in version order, so the newer ones are at the back
+        auto first = std::partition_point( log.m_Entries.begin(), log.m_Entries.end(),
+                                           [ since ]( Entry const& entry ) { return entry.m_Version <= since; } );
+        for ( ; first != log.m_Entries.end(); ++first )
+            func( first->m_Entity );
+        return true;
+    }
+
+    /// @brief  gets the number of log entries kept for a type
+    std::size_t GetLogSize( ComponentTypeId type );
+
+    // Prevent copy construction and assignment
+    ChangeTracker( ChangeTracker const& ) = delete;
+    ChangeTracker& operator=( ChangeTracker const& ) = delete;
+
+private:
+    ChangeTracker() = default;
+
+    struct Entry
+    {
+        ChangeVersion m_Version;
+        EntityHandle m_Entity;
+    };
+
+    struct Log
+    {
+        std::mutex m_Mutex;
+        std::vector< Entry > m_Entries;
+
+        /// @brief  every write after this version is still in m_Entries
+        ChangeVersion m_Horizon = 0;
+    };
+
+    std::array< Log, kMaxComponentTypes > m_Logs;
+
+    /// @brief  starts at 1 so that a system remembering 0 sees everything
+    std::atomic< ChangeVersion > m_Version{ 1 };
+};
+
+/// @brief  gets the global ChangeTracker
+inline ChangeTracker* Changes()
+{
+    return &ChangeTracker::Instance();
+}
+
+#endif //CHANGETRACKER_H
@@ -14,6 +14,9 @@
 
 #include <pch.h>
 #include <Core/ECS/Entity/Entity.h>
+#include <Core/Memory/PoolAllocator.h>
+#include <Core/ECS/Component/ComponentType.h>
+#include <Core/ECS/Component/ChangeTracker.h>
 
 class Component
 {
@@ -64,6 +67,10 @@ public:
     /// @return component type
     std::type_index GetType() const { return m_Type; }
 
+    /// @brief  gets the dense ID of the component's type
+    /// @return component type ID
+    ComponentTypeId GetTypeId() const { return m_TypeId; }
+
     /// @brief  sets the parent entity of the component
     /// @param  entity  the parent entity of the component
     void SetEntity( Entity* entity ) { m_Parent = entity; }
@@ -76,13 +83,56 @@ public:
     /// @return the ID of this Component
     unsigned GetId() const { return m_Id; }
 
+    /// @brief  gets the world version this Component was last written at
+    ChangeVersion GetChangeVersion() const { return m_Version; }
+
+    /// @brief  checks whether this Component was written after a version
+    /// @param  since   the version to compare against
+    bool HasChangedSince( ChangeVersion since ) const { return m_Version > since; }
+
+    /// @brief  stamps this Component as written at the current version and logs the write
+    ///         for its type (once per version)
+    void MarkChanged()
+    {
+        const ChangeVersion now = Changes()->GetVersion();
+        if ( StampVersion( now ) && m_Parent != nullptr )
+            Changes()->Record( m_TypeId, m_Parent->GetHandle(), now );
+    }
+
+    /// @brief  stamps this Component as written without logging it
+    /// @param  version the current version
+    /// @return whether the stamp changed, in which case the caller must log the write
+    /// @note   used by batched writers that log many writes at once
+    bool StampVersion( ChangeVersion version )
+    {
+        if ( m_Version == version )
+            return false;
+        m_Version = version;
+        return true;
+    }
+
     /// @brief  gets this Component's name
     /// @return this Component's name
+    /// @note   builds a string for display; compare Entities with GetNameId() instead
     std::string GetName() const
     {
         return m_Parent->GetName() + "->" + PrefixlessName( m_Type );
     }
 
+//-----------------------------------------------------------------------------
+// Pooled Allocation
+//-----------------------------------------------------------------------------
+
+    /// @brief  allocates Components from the shared object pools, so every component
+    ///         type gets slab storage of its own size class
+    /// @param  size    the size of the most derived Component type
+    static void* operator new( std::size_t size ) { return Pools()->Allocate( size ); }
+
+    /// @brief  returns Components to the shared object pools
+    /// @param  block   the memory of the Component
+    /// @param  size    the size of the most derived Component type
+    static void operator delete( void* block, std::size_t size ) { Pools()->Deallocate( block, size ); }
+
 //-----------------------------------------------------------------------------
 // Protected Constructors
 //-----------------------------------------------------------------------------
@@ -92,6 +142,7 @@ protected:
     /// @param type The type of component this is.
     explicit Component (const std::type_index type ) :
         m_Type( type ),
+        m_TypeId( ComponentTypeRegistry::GetId( type ) ),
         m_Parent( nullptr ),
         m_Id( GetUniqueId() )
     {}
@@ -100,6 +151,7 @@ protected:
     /// @param other the component to clone
     Component( Component const& other ) :
     m_Type( other.m_Type ),
+    m_TypeId( other.m_TypeId ),
     m_Parent( nullptr ),
     m_Id( GetUniqueId() )
     {}
@@ -112,11 +164,17 @@ private:
     /// @brief  the type of this Component
     std::type_index const m_Type;
 
+    /// @brief  the dense ID of this Component's type
+    ComponentTypeId const m_TypeId;
+
     /// @brief  the parent Entity of this Component
     Entity* m_Parent;
 
     /// @brief  the ID of this Component
     unsigned m_Id;
+
+    /// @brief  the world version of the last write to this Component
+    ChangeVersion m_Version = 0;
 };
 
 #endif //COMPONENT_H
@@ -0,0 +1,71 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: ComponentType
+* Description:
+*     Assigns every Component type a small dense ID so that the set of Components on an
+*     Entity can be stored as a bitmask signature.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef COMPONENTTYPE_H
+#define COMPONENTTYPE_H
+
+#include <pch.h>
+#include <bitset>
+
+/// @brief  dense ID of a Component type
+using ComponentTypeId = uint32_t;
+
+/// @brief  maximum number of distinct Component types
+constexpr std::size_t kMaxComponentTypes = 64;
+
+/// @brief  set of Component types, one bit per ComponentTypeId
+using ComponentMask = std::bitset< kMaxComponentTypes >;
+
+class ComponentTypeRegistry
+{
+public:
+    /// @brief  gets (assigning on first use) the ID of a Component type
+    /// @param  type    the exact type of the Component
+    /// @return the ID of the type
+    static ComponentTypeId GetId( std::type_index type )
+    {
+        static std::mutex s_Mutex;
+        static std::unordered_map< std::type_index, ComponentTypeId > s_Ids;
+
+        std::lock_guard< std::mutex > lock( s_Mutex );
+        auto const [ it, inserted ] = s_Ids.try_emplace( type, static_cast< ComponentTypeId >( s_Ids.size() ) );
+        if ( inserted && it->second >= kMaxComponentTypes )
+        {
+            ETERNUM_LOG_ERROR("too many Component types, raise kMaxComponentTypes");
+            std::abort();
+        }
+        return it->second;
+    }
+
+    /// @brief  gets the ID of a Component type
+    /// @tparam ComponentType   the exact type of the Component
+    /// @return the ID of the type
+    template < typename ComponentType >
+    static ComponentTypeId Of()
+    {
+        static ComponentTypeId const s_Id = GetId( typeid( ComponentType ) );
+        return s_Id;
+    }
+
+    /// @brief  builds the signature of a set of Component types
+    /// @tparam ComponentTypeList   the exact types of the Components
+    /// @return mask with one bit set per type
+    template < typename... ComponentTypeList >
+    static ComponentMask MaskOf()
+    {
+        ComponentMask mask;
+        ( mask.set( Of< ComponentTypeList >() ), ... );
+        return mask;
+    }
+};
+
+#endif //COMPONENTTYPE_H
@@ -3,7 +3,7 @@
 * -----------------------------------------------------------------------------------------
 * File: Transform
 * Description:
-*     TODO: Describe the purpose of this file.
+*     Implements the Transform component's accessors and dirty tracking.
 *
 * Author:     Jax Clayton
 * Created:    8/8/2025
@@ -12,3 +12,83 @@
 
 #include <pch.h>
 #include "Transform.h"
+#include <Systems/Transform System/TransformSystem.h>
+
+//-----------------------------------------------------------------------------
+// Constructor
+//-----------------------------------------------------------------------------
+
+Transform::Transform() :
+    Component( typeid( Transform ) )
+{}
+
+Transform::Transform( Transform const& other ) :
+    Component( other ),
+    m_Translation( other.m_Translation ),
+    m_Rotation( other.m_Rotation ),
+    m_Scale( other.m_Scale ),
+    m_World( other.m_World )
+{}
+
+//-----------------------------------------------------------------------------
+// Public Virtual Overrides
+//-----------------------------------------------------------------------------
+
+void Transform::OnInit()
+{
+    markDirty();
+}
+
+void Transform::OnHierarchyChange( [[maybe_unused]] Entity* previousParent )
+{
+    markDirty();
+}
+
+Component* Transform::Clone() const
+{
+    return new Transform( *this );
+}
+
+//-----------------------------------------------------------------------------
+// Public Accessors
+//-----------------------------------------------------------------------------
+
+void Transform::SetTranslation( Vec2f const& translation )
+{
+    m_Translation = translation;
+    markDirty();
+}
+
+void Transform::SetRotation( float rotation )
+{
+    m_Rotation = rotation;
+    markDirty();
+}
+
+void Transform::SetScale( Vec2f const& scale )
+{
+    m_Scale = scale;
+    markDirty();
+}
+
+Affine2f Transform::GetLocalMatrix() const
+{
+    return Affine2f::FromTRS( m_Translation, m_Rotation, m_Scale );
+}
+
+//-----------------------------------------------------------------------------
+// Private Methods
+//-----------------------------------------------------------------------------
+
+void Transform::markDirty()
+{
+    m_IsDirty = true;
+    MarkChanged();
+
+    // unattached Transforms are queued by OnInit instead
+    if ( !m_IsQueued && GetEntity() != nullptr )
+    {
+        m_IsQueued = true;
+        Transforms()->MarkDirty( GetEntity()->GetHandle() );
+    }
+}
@@ -3,7 +3,9 @@
 * -----------------------------------------------------------------------------------------
 * File: Transform
 * Description:
-*     TODO: Describe the purpose of this file.
+*     Local translation, rotation and scale of an Entity, along with its cached
+*     local-to-world matrix. Changing any local value queues the Entity's subtree with
+*     the TransformSystem, which recomputes the world matrices in batches.
 *
 * Author:     Jax Clayton
 * Created:    8/8/2025
@@ -14,6 +16,7 @@
 
 #include <pch.h>
 #include <Core/ECS/Component/Component.h>
+#include <Core/Math/Affine2.h>
 #include <Systems/ComponentSystem/ComponentSystem.h>
 
 class Transform final : public Component{
@@ -26,10 +29,85 @@ public:
     /// @brief  constructor
     Transform();
 
+    /// @brief  copy constructor; the copy starts dirty and unqueued
+    /// @param  other   the Transform to copy
+    Transform( Transform const& other );
+
     /// @brief destructor
     ~Transform() override = default;
 
+    //-----------------------------------------------------------------------------
+    // Public Virtual Overrides
+    //-----------------------------------------------------------------------------
+
+    /// @brief  queues this Transform once its Entity enters the Scene
+    void OnInit() override;
+
+    /// @brief  queues this Transform since its parent's world matrix now applies
+    /// @param  previousParent   the parent of this Entity before the hierarchy change
+    void OnHierarchyChange( Entity* previousParent ) override;
+
+    /// @brief  clones this Transform
+    /// @return new clone of this Transform
+    Component* Clone() const override;
+
+    //-----------------------------------------------------------------------------
+    // Public Accessors
+    //-----------------------------------------------------------------------------
+
+    /// @brief  gets the translation relative to the parent
+    Vec2f const& GetTranslation() const { return m_Translation; }
+
+    /// @brief  sets the translation relative to the parent
+    /// @param  translation the new translation
+    void SetTranslation( Vec2f const& translation );
+
+    /// @brief  gets the rotation relative to the parent, in degrees
+    float GetRotation() const { return m_Rotation; }
+
+    /// @brief  sets the rotation relative to the parent
+    /// @param  rotation    the new rotation in degrees
+    void SetRotation( float rotation );
+
+    /// @brief  gets the scale relative to the parent
+    Vec2f const& GetScale() const { return m_Scale; }
+
+    /// @brief  sets the scale relative to the parent
+    /// @param  scale   the new scale
+    void SetScale( Vec2f const& scale );
+
+    /// @brief  gets the local-to-parent matrix
+    /// @return the matrix built from the translation, rotation and scale
+    Affine2f GetLocalMatrix() const;
+
+    /// @brief  gets the local-to-world matrix as of the last TransformSystem propagation
+    Affine2f const& GetWorldMatrix() const { return m_World; }
+
+    /// @brief  gets the world position as of the last TransformSystem propagation
+    Vec2f GetWorldPosition() const { return m_World.GetTranslation(); }
+
+    /// @brief  maps a point from this Transform's local space into world space
+    /// @param  point   the point in local space
+    Vec2f LocalToWorld( Vec2f const& point ) const { return m_World.TransformPoint( point ); }
+
+    /// @brief  maps a world-space point into this Transform's local space, e.g. to hit-test
+    ///         it against local bounds
+    /// @param  point   the point in world space
+    Vec2f WorldToLocal( Vec2f const& point ) const { return m_World.Inverse().TransformPoint( point ); }
+
+    /// @brief  gets whether the world matrix is waiting to be recomputed
+    bool IsDirty() const { return m_IsDirty; }
+
 private:
+    friend class TransformSystem;
+
+    //-----------------------------------------------------------------------------
+    // Private Methods
+    //-----------------------------------------------------------------------------
+
+    /// @brief  flags the world matrix as stale and queues this Transform's subtree
+    void markDirty();
+
     //-----------------------------------------------------------------------------
     // Private Member Variables
     //-----------------------------------------------------------------------------
@@ -41,12 +119,17 @@ private:
     float m_Rotation = 0.0f;
 
     /// @brief the scale of this Transform
-    Vec2f m_Scale = Vec2f::Zero();
+    Vec2f m_Scale = Vec2f( 1.0f );
+
+    /// @brief  the cached local-to-world matrix
+    Affine2f m_World = {};
 
     /// @brief  flag for when the matrix needs to be regenerated
     bool m_IsDirty = true;
 
+    /// @brief  whether this Transform's Entity is already queued with the TransformSystem
+    bool m_IsQueued = false;
+
 };
 
-REGISTER_COMPONENT_SYSTEM(Transform)
 #endif //TRANSFORM_H
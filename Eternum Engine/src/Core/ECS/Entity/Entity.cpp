@@ -13,22 +13,63 @@
 #include <pch.h>
 #include "Entity.h"
 #include <Core/ECS/Component/Component.h>
+#include <Core/Memory/PoolAllocator.h>
+#include <Core/ECS/Query/Query.h>
+#include <Core/ECS/Commands/CommandBuffer.h>
+#include <Core/ECS/Hierarchy/EntityHierarchy.h>
 
 //-----------------------------------------------------------------------------
 // Constructor / Destructor
 //-----------------------------------------------------------------------------
 
 Entity::Entity() :
-    m_Id(GetUniqueId())
-{}
+    m_Handle(Entities()->Create(this))
+{
+    Hierarchy()->Insert(this);
+}
+
+Entity::Entity(EntityHandle reserved) :
+    m_Handle(reserved)
+{
+    Entities()->Bind(m_Handle, this);
+    Hierarchy()->Insert(this);
+}
 
 Entity::~Entity()
 {
+    // leave the parent's child list without moving the range; the slot just becomes
+    // a tombstone inside the parent's subtree
+    if (m_Parent)
+    {
+        m_Parent->removeChild(this);
+        m_Parent->adjustDescendants(-(m_NumDescendants + 1));
+    }
+
+    if (m_Signature.any())
+        Queries()->OnSignatureChanged(this, m_Signature, {});
+
     for (auto& [type, component] : m_Components)
         delete component;
 
-    for (Entity* child : m_Children)
-        delete child;
+    if (!m_Children.empty())
+        destroyDescendants();
+
+    Hierarchy()->Remove(this);
+    Entities()->Release(m_Handle);
+}
+
+//-----------------------------------------------------------------------------
+// Pooled Allocation
+//-----------------------------------------------------------------------------
+
+void* Entity::operator new(std::size_t size)
+{
+    return Pools()->Allocate(size);
+}
+
+void Entity::operator delete(void* block, std::size_t size)
+{
+    Pools()->Deallocate(block, size);
 }
 
 //-----------------------------------------------------------------------------
@@ -49,7 +90,7 @@ void Entity::Exit()
         component->OnExit();
 
     if (m_Parent)
-        m_Parent->removeChild(this);
+        SetParent(nullptr);
 }
 
 //-----------------------------------------------------------------------------
@@ -59,6 +100,7 @@ void Entity::Exit()
 void Entity::operator=(Entity const& other)
 {
     m_Name = other.m_Name;
+    m_NameText = other.m_NameText;
     m_IsDestroyed = false;
 
     for ( auto& [ type, component ] : other.m_Components )
@@ -79,6 +121,10 @@ void Entity::operator=(Entity const& other)
 
 void Entity::Destroy()
 {
+    // world-owned Entities are reclaimed by the CommandQueue at the next sync point
+    if (m_IsOwnedByWorld && !m_IsDestroyed)
+        Commands()->ThisThread().DestroyEntity(m_Handle);
+
     m_IsDestroyed = true;
 
     for ( Entity* child : m_Children )
@@ -89,7 +135,38 @@ void Entity::Destroy()
 
 void Entity::SetParent(Entity* parent)
 {
+    if (parent == m_Parent)
+        return;
+
+    if (parent == this || (parent && parent->IsDescendedFrom(this)))
+    {
+        ETERNUM_LOG_ERROR("cannot parent \"", GetName(), "\" to its own descendant");
+        return;
+    }
+
+    Entity* oldParent = m_Parent;
+    if (oldParent)
+    {
+        for (auto& [type, component] : oldParent->m_Components)
+            component->OnRemoveChild(this);
+        oldParent->removeChild(this);
+        oldParent->adjustDescendants(-(m_NumDescendants + 1));
+    }
+
+    // move the range while the old ancestor chain is still reachable
+    Hierarchy()->Reparent(this, oldParent, parent);
     m_Parent = parent;
+
+    if (parent)
+    {
+        parent->addChild(this);
+        parent->adjustDescendants(m_NumDescendants + 1);
+        for (auto& [type, component] : parent->m_Components)
+            component->OnAddChild(this);
+    }
+
+    for (auto& [type, component] : m_Components)
+        component->OnHierarchyChange(oldParent);
 }
 
 void Entity::AddComponent(Component* component)
@@ -97,7 +174,7 @@ void Entity::AddComponent(Component* component)
     // Check if the component already exists.
     if ( m_Components.find( component->GetType() ) != m_Components.end() )
     {
-        std::cout << "WARNING: attempting to add a duplicate component to the Entity \"" << m_Name << "\"" << std::endl;
+        ETERNUM_LOG_WARNING("attempting to add a duplicate component to the Entity \"", GetName(), "\"");
         return;
     }
 
@@ -106,18 +183,43 @@ void Entity::AddComponent(Component* component)
 
     // add it to the entity.
     m_Components[ component->GetType() ] = component;
+
+    // let the cached queries pick up the new signature
+    const ComponentMask before = m_Signature;
+    m_Signature.set( component->GetTypeId() );
+    Queries()->OnSignatureChanged( this, before, m_Signature );
+
+    // a new Component counts as a change to its type
+    component->MarkChanged();
+}
+
+bool Entity::RemoveComponent(std::type_index type)
+{
+    const auto it = m_Components.find( type );
+    if ( it == m_Components.end() )
+        return false;
+
+    Component* component = it->second;
+
+    // drop the Entity from the cached queries before the Component goes away
+    const ComponentMask before = m_Signature;
+    m_Signature.reset( component->GetTypeId() );
+    Queries()->OnSignatureChanged( this, before, m_Signature );
+
+    m_Components.erase( it );
+    delete component;
+    return true;
+}
+
+Component* Entity::FindComponent(std::type_index type) const
+{
+    const auto it = m_Components.find( type );
+    return it != m_Components.end() ? it->second : nullptr;
 }
 
 bool Entity::IsDescendedFrom(Entity const* ancestor) const
 {
-    Entity const* current = m_Parent;
-    while (current)
-    {
-        if (current == ancestor)
-            return true;
-        current = current->m_Parent;
-    }
-    return false;
+    return Hierarchy()->IsDescendant(this, ancestor);
 }
 
 //-----------------------------------------------------------------------------
@@ -150,7 +252,12 @@ ComponentType const* Entity::GetComponent() const
 template <typename ComponentType>
 ComponentType* Entity::GetComponent()
 {
-    return const_cast< ComponentType* >( const_cast< Entity const* >( this )->GetComponent< ComponentType >() );
+    auto* component = const_cast< ComponentType* >( const_cast< Entity const* >( this )->GetComponent< ComponentType >() );
+
+    // mutable access counts as a write
+    if ( component != nullptr )
+        component->MarkChanged();
+    return component;
 }
 
 template <typename ComponentType>
@@ -160,7 +267,10 @@ std::vector<ComponentType*> Entity::GetComponentsOfType()
     for (auto& [type, comp] : m_Components)
     {
         if (auto* match = dynamic_cast<ComponentType*>(comp))
+        {
+            match->MarkChanged();
             result.push_back(match);
+        }
     }
     return result;
 }
@@ -174,6 +284,11 @@ std::map<std::type_index, Component*>& Entity::getComponents()
     return m_Components;
 }
 
+ComponentMask const& Entity::GetSignature() const
+{
+    return m_Signature;
+}
+
 bool Entity::IsDestroyed() const
 {
     return m_IsDestroyed;
@@ -181,17 +296,29 @@ bool Entity::IsDestroyed() const
 
 std::string const& Entity::GetName() const
 {
-    return m_Name;
+    return m_NameText.empty() ? m_Name.GetString() : m_NameText;
 }
 
-void Entity::SetName(std::string const& name)
+void Entity::SetName(StringId name)
 {
     m_Name = name;
+    m_NameText.clear();
+}
+
+void Entity::SetName(std::string_view name)
+{
+    m_Name = StringId::Hashed(name);
+    m_NameText = name;
 }
 
 unsigned Entity::GetId() const
 {
-    return m_Id;
+    return m_Handle.m_Index;
+}
+
+EntityHandle Entity::GetHandle() const
+{
+    return m_Handle;
 }
 
 Entity const* Entity::GetParent() const
@@ -225,18 +352,85 @@ int Entity::GetNumDescendants() const
 
 void Entity::addChild(Entity* child)
 {
+    child->m_ChildIndex = static_cast< uint32_t >( m_Children.size() );
     m_Children.push_back( child );
 }
 
+void Entity::adoptComponents(Component* const* components, std::size_t count, ChangeVersion version)
+{
+    const ComponentMask before = m_Signature;
+    for ( std::size_t i = 0; i < count; ++i )
+    {
+        Component* component = components[ i ];
+        if ( component == nullptr )
+            continue;
+
+        component->SetEntity( this );
+        component->StampVersion( version );
+        m_Components.emplace_hint( m_Components.end(), component->GetType(), component );
+        m_Signature.set( component->GetTypeId() );
+    }
+
+    if ( m_Signature != before )
+        Queries()->OnSignatureChanged( this, before, m_Signature );
+}
+
+void Entity::adjustDescendants(int delta)
+{
+    for ( Entity* entity = this; entity; entity = entity->m_Parent )
+        entity->m_NumDescendants += delta;
+}
+
+void Entity::destroyDescendants()
+{
+    // flatten the subtree breadth-first, detaching each child list so that the
+    // destructors below don't recurse into nodes that are already queued
+    std::vector<Entity*> nodes;
+    nodes.swap(m_Children);
+    for (std::size_t i = 0; i < nodes.size(); ++i)
+    {
+        Entity* node = nodes[i];
+        nodes.insert(nodes.end(), node->m_Children.begin(), node->m_Children.end());
+        node->m_Children.clear();
+        node->m_NumDescendants = 0;
+    }
+
+    // parents are destroyed before their children, so the children must not reach back
+    for (Entity* node : nodes)
+        node->m_Parent = nullptr;
+    m_NumDescendants = 0;
+
+    for (Entity* node : nodes)
+        node->~Entity();
+
+    // free at the size operator delete gets for an Entity*; the destructor is not
+    // virtual, so that is sizeof(Entity) whatever the node was created as
+    PoolAllocator* pool = Pools()->GetPool(sizeof(Entity));
+    if (pool == nullptr)
+    {
+        for (Entity* node : nodes)
+            Entity::operator delete(node, sizeof(Entity));
+        return;
+    }
+
+    std::vector<void*> blocks(nodes.begin(), nodes.end());
+    pool->DeallocateBatch(blocks.data(), blocks.size());
+}
+
 void Entity::removeChild(const Entity* child)
 {
-    const auto it = std::find( m_Children.begin(), m_Children.end(), child );
-    if ( it == m_Children.end() )
+    const uint32_t index = child->m_ChildIndex;
+    if ( index >= m_Children.size() || m_Children[ index ] != child )
     {
-        std::cout << "ERROR: cannot find child \"" << child->GetName() << "\" to remove" << std::endl;
+        ETERNUM_LOG_ERROR("cannot find child \"", child->GetName(), "\" to remove");
         return;
     }
-    m_Children.erase( it );
+
+    // swap with the last child; sibling order is not significant
+    Entity* last = m_Children.back();
+    m_Children[ index ] = last;
+    last->m_ChildIndex = index;
+    m_Children.pop_back();
 }
 
 // Explicit template instantiations
@@ -16,6 +16,9 @@
 // Include Files:
 //-----------------------------------------------------------------------------
 #include <pch.h>
+#include <Core/ECS/Entity/EntityRegistry.h>
+#include <Core/ECS/Component/ComponentType.h>
+#include <Core/ECS/Component/ChangeTracker.h>
 
 class Component;
 
@@ -52,6 +55,8 @@ public:
 //-----------------------------------------------------------------------------
 
     /// @brief  flags this Entity for destruction
+    /// @note   Entities created through a CommandBuffer are also reclaimed at the next sync point.
+    ///         Any other Entity stays owned by whoever created it, who must still delete it
     void Destroy();
 
     /// @brief  gets the component of the specified type from this Entity
@@ -64,6 +69,7 @@ public:
     /// @brief  gets the component of the specified type from this Entity
     /// @tparam ComponentType   the type of component to get
     /// @return the component of the specified type (nullptr if component doesn't exist)
+    /// @note   mutable access marks the component as changed
     template < typename ComponentType >
     ComponentType* GetComponent();
 
@@ -71,21 +77,40 @@ public:
     /// @brief  gets all the components derived from the specified type from this Entity
     /// @tparam ComponentType   the type of component to get
     /// @return a vector of all components of the specified type
+    /// @note   every returned component is marked as changed
     template < typename ComponentType >
     std::vector< ComponentType* > GetComponentsOfType();
 
 
-    /// @brief  sets the parent of this Entity
-    /// @param  parent  the Entity that should be the parent of this one
+    /// @brief  sets the parent of this Entity, moving its whole subtree under the new parent
+    /// @param  parent  the Entity that should be the parent of this one (nullptr for a root)
+    /// @note   a parent takes ownership of its children: they are destroyed along with it
     void SetParent( Entity* parent );
 
     /// @brief  Adds a Component to this Entity
     /// @param  component the Component to add to this Entity
     void AddComponent( Component* component );
 
+    /// @brief  removes and deletes the Component of an exact type from this Entity
+    /// @param  type    the exact type of the Component to remove
+    /// @return whether a Component was removed
+    bool RemoveComponent( std::type_index type );
+
+    /// @brief  removes and deletes the Component of an exact type from this Entity
+    /// @tparam ComponentType   the exact type of the Component to remove
+    /// @return whether a Component was removed
+    template < typename ComponentType >
+    bool RemoveComponent() { return RemoveComponent( typeid( ComponentType ) ); }
+
+    /// @brief  gets the Component of an exact type, without falling back to derived types
+    /// @param  type    the exact type of the Component
+    /// @return the Component, or nullptr if this Entity has none of that type
+    Component* FindComponent( std::type_index type ) const;
+
     /// @brief  checks if this Entity is descended from another Entity
     /// @param  ancestor    The entity to check if this Entity is descended from
     /// @return whether this Entity is descended from the other Entity
+    /// @note   constant time, using the subtree ranges of the EntityHierarchy
     bool IsDescendedFrom( Entity const* ancestor ) const;
 
 //-----------------------------------------------------------------------------
@@ -96,6 +121,10 @@ public:
     /// @return the map of all components in this Entity
     std::map< std::type_index, Component* >& getComponents();
 
+    /// @brief  gets the set of Component types on this Entity
+    /// @return one bit per ComponentTypeId
+    ComponentMask const& GetSignature() const;
+
 
     /// @brief  gets whether this Entity is flagged for destruction
     /// @return whether this Entity is flagged for destruction
@@ -106,15 +135,31 @@ public:
     /// @return this Entity's name
     std::string const& GetName() const;
 
-    /// @brief  sets this Entity's name
+    /// @brief  gets this Entity's interned name, for comparisons and lookups
+    /// @return this Entity's name ID
+    StringId GetNameId() const { return m_Name; }
+
+    /// @brief  sets this Entity's name to a shared ID, e.g. a literal or a Prefab node's
+    ///         name; the text comes from the StringTable
     /// @param  name    the new name for this Entity
-    void SetName( std::string const& name );
+    void SetName( StringId name );
+
+    /// @brief  sets this Entity's name to text the Entity keeps itself, so names built
+    ///         at runtime are not interned for the life of the program
+    /// @param  name    the new name for this Entity
+    void SetName( std::string_view name );
+    void SetName( std::string const& name ) { SetName( std::string_view( name ) ); }
+    void SetName( char const* name ) { SetName( std::string_view( name ) ); }
 
 
-    /// @brief  gets the ID of this Component
-    /// @return the ID of this Component
+    /// @brief  gets the ID of this Entity
+    /// @return the ID of this Entity (its slot index in the EntityRegistry)
     unsigned GetId() const;
 
+    /// @brief  gets the generational handle of this Entity
+    /// @return the handle that refers to this Entity in the EntityRegistry
+    EntityHandle GetHandle() const;
+
 
     /// @brief  gets the parent of this Entity
     /// @return the parent of this Entity
@@ -157,6 +202,19 @@ public:
     void operator =( Entity const& other );
 
 
+//-----------------------------------------------------------------------------
+// Pooled Allocation
+//-----------------------------------------------------------------------------
+
+    /// @brief  allocates Entities from the shared object pools instead of the heap
+    /// @param  size    the size of the Entity
+    static void* operator new( std::size_t size );
+
+    /// @brief  returns Entities to the shared object pools
+    /// @param  block   the memory of the Entity
+    /// @param  size    the size of the Entity
+    static void operator delete( void* block, std::size_t size );
+
     /// @brief deletes the copy constructor to prevent copying
     /// @param other   the entity to copy from
     /// @note  this is deleted to prevent copying of Entities, which can lead to issues
@@ -170,13 +228,19 @@ public:
 private:
 
     /// @brief  this Entity's name
-    std::string m_Name = "";
+    StringId m_Name;
+
+    /// @brief  the text of m_Name when it was set from runtime text; empty otherwise
+    std::string m_NameText;
 
     /// @brief  container of components attached to this Entity
     std::map< std::type_index, Component* > m_Components = {};
 
-    /// @brief  the ID of this Entity
-    unsigned m_Id = -1;
+    /// @brief  one bit per type in m_Components, used to match Queries
+    ComponentMask m_Signature = {};
+
+    /// @brief  the handle of this Entity in the EntityRegistry
+    EntityHandle m_Handle = {};
 
     /// @brief  the children of this Entity
     std::vector< Entity* > m_Children = {};
@@ -184,16 +248,30 @@ private:
     /// @brief  the number of descendants this Entity has
     int m_NumDescendants = 0;
 
+    /// @brief  the index of this Entity in its parent's m_Children
+    uint32_t m_ChildIndex = 0;
+
     /// @brief  the parent Entity of this Entity
     Entity* m_Parent = nullptr;
 
     /// @brief  flag of whether this Entity should be destroyed
     bool m_IsDestroyed = false;
 
+    /// @brief  whether this Entity was created by a CommandBuffer, and so is deleted by
+    ///         the CommandQueue once destroyed
+    bool m_IsOwnedByWorld = false;
+
 //-----------------------------------------------------------------------------
 // Private Methods
 //-----------------------------------------------------------------------------
 
+    friend class CommandQueue;
+    friend class Prefab;
+
+    /// @brief  constructs an Entity into a handle reserved by a CommandBuffer
+    /// @param  reserved    the handle reserved with EntityRegistry::Create( nullptr )
+    explicit Entity( EntityHandle reserved );
+
     /// @brief  adds a child to this Enity
     /// @param  child   - the child to add to this Enitity
     void addChild( Entity* child );
@@ -202,6 +280,20 @@ private:
     /// @param  child   - the child to remove from this Enitity
     void removeChild( const Entity* child );
 
+    /// @brief  attaches freshly built Components without duplicate checks or OnInit, and
+    ///         updates the Queries once for the whole set
+    /// @param  components  - the Components, sorted by type; nullptr entries are skipped
+    /// @param  count       - the number of entries
+    /// @param  version     - the change version to stamp them with; the caller logs the writes
+    void adoptComponents( Component* const* components, std::size_t count, ChangeVersion version );
+
+    /// @brief  adds to the descendant count of this Entity and all of its ancestors
+    /// @param  delta   - the number of descendants gained (negative when lost)
+    void adjustDescendants( int delta );
+
+    /// @brief  destroys every descendant of this Entity and releases their memory in one batch
+    void destroyDescendants();
+
 
 
 };
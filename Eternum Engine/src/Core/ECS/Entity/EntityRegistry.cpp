@@ -0,0 +1,151 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: EntityRegistry
+* Description:
+*     Implements generational handle allocation, release and resolution for Entities.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+
+#include <pch.h>
+#include "EntityRegistry.h"
+
+//-----------------------------------------------------------------------------
+// Destructor
+//-----------------------------------------------------------------------------
+
+EntityRegistry::~EntityRegistry()
+{
+    for ( auto& page : m_Pages )
+        delete[] page.load( std::memory_order_relaxed );
+}
+
+//-----------------------------------------------------------------------------
+// Public Methods
+//-----------------------------------------------------------------------------
+
+EntityHandle EntityRegistry::Create( Entity* entity )
+{
+    std::lock_guard< std::mutex > lock( m_Mutex );
+
+    uint32_t index = m_FreeHead;
+    if ( index != EntityHandle::kInvalidIndex )
+    {
+        m_FreeHead = getSlot( index ).m_NextFree;
+    }
+    else
+    {
+        index = m_Capacity.load( std::memory_order_relaxed );
+        const uint32_t page = index >> kPageBits;
+        if ( page >= kMaxPages )
+        {
+            ETERNUM_LOG_ERROR("EntityRegistry is full");
+            return {};
+        }
+
+        if ( m_Pages[ page ].load( std::memory_order_relaxed ) == nullptr )
+            m_Pages[ page ].store( new Slot[ kPageSize ], std::memory_order_release );
+
+        m_Capacity.store( index + 1, std::memory_order_release );
+    }
+
+    Slot& slot = getSlot( index );
+    slot.m_NextFree = EntityHandle::kInvalidIndex;
+    slot.m_Entity.store( entity, std::memory_order_release );
+    m_LiveCount.fetch_add( 1, std::memory_order_relaxed );
+
+    return { index, slot.m_Generation.load( std::memory_order_relaxed ) };
+}
+
+bool EntityRegistry::Release( EntityHandle handle )
+{
+    if ( handle.IsNull() )
+        return false;
+
+    std::lock_guard< std::mutex > lock( m_Mutex );
+
+    if ( handle.m_Index >= m_Capacity.load( std::memory_order_relaxed ) )
+        return false;
+
+    Slot& slot = getSlot( handle.m_Index );
+    if ( slot.m_Generation.load( std::memory_order_relaxed ) != handle.m_Generation )
+        return false;
+
+    // bump the generation first so concurrent resolves of the old handle fail
+    slot.m_Generation.fetch_add( 1, std::memory_order_release );
+    slot.m_Entity.store( nullptr, std::memory_order_release );
+    slot.m_NextFree = m_FreeHead;
+    m_FreeHead = handle.m_Index;
+    m_LiveCount.fetch_sub( 1, std::memory_order_relaxed );
+    return true;
+}
+
+bool EntityRegistry::Bind( EntityHandle handle, Entity* entity )
+{
+    if ( handle.IsNull() )
+        return false;
+
+    std::lock_guard< std::mutex > lock( m_Mutex );
+
+    if ( handle.m_Index >= m_Capacity.load( std::memory_order_relaxed ) )
+        return false;
+
+    Slot& slot = getSlot( handle.m_Index );
+    if ( slot.m_Generation.load( std::memory_order_relaxed ) != handle.m_Generation )
+        return false;
+
+    slot.m_Entity.store( entity, std::memory_order_release );
+    return true;
+}
+
+Entity* EntityRegistry::Resolve( EntityHandle handle ) const
+{
+    if ( handle.m_Index >= GetCapacity() )
+        return nullptr;
+
+    Slot const& slot = getSlot( handle.m_Index );
+    if ( slot.m_Generation.load( std::memory_order_acquire ) != handle.m_Generation )
+        return nullptr;
+
+    Entity* entity = slot.m_Entity.load( std::memory_order_acquire );
+
+    // the slot may have been released and reused while we were reading it
+    if ( slot.m_Generation.load( std::memory_order_acquire ) != handle.m_Generation )
+        return nullptr;
+
+    return entity;
+}
+
+bool EntityRegistry::IsAlive( EntityHandle handle ) const
+{
+    return Resolve( handle ) != nullptr;
+}
+
+Entity* EntityRegistry::GetEntity( uint32_t index ) const
+{
+    if ( index >= GetCapacity() )
+        return nullptr;
+
+    return getSlot( index ).m_Entity.load( std::memory_order_acquire );
+}
+
+EntityHandle EntityRegistry::GetHandle( uint32_t index ) const
+{
+    if ( GetEntity( index ) == nullptr )
+        return {};
+
+    return { index, getSlot( index ).m_Generation.load( std::memory_order_acquire ) };
+}
+
+//-----------------------------------------------------------------------------
+// Private Methods
+//-----------------------------------------------------------------------------
+
+EntityRegistry::Slot& EntityRegistry::getSlot( uint32_t index ) const
+{
+    Slot* page = m_Pages[ index >> kPageBits ].load( std::memory_order_acquire );
+    return page[ index & ( kPageSize - 1 ) ];
+}
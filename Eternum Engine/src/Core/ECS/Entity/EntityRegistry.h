@@ -0,0 +1,179 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: EntityRegistry
+* Description:
+*     Central registry that hands out generational handles for Entities. Slots are
+*     recycled through a free list, handles resolve in O(1) and stale handles are
+*     detected by comparing generations.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef ENTITYREGISTRY_H
+#define ENTITYREGISTRY_H
+
+//-----------------------------------------------------------------------------
+// Include Files:
+//-----------------------------------------------------------------------------
+#include <pch.h>
+
+class Entity;
+
+/// @brief  lightweight reference to an Entity: a 32-bit slot index plus a 32-bit generation
+struct EntityHandle
+{
+    /// @brief  index value used by handles that do not reference any slot
+    static constexpr uint32_t kInvalidIndex = 0xFFFFFFFFu;
+
+    /// @brief  the slot this handle refers to
+    uint32_t m_Index = kInvalidIndex;
+
+    /// @brief  the generation of the slot at the time the handle was created
+    uint32_t m_Generation = 0;
+
+    /// @brief  gets whether this handle was never assigned a slot
+    /// @return whether this handle is null
+    bool IsNull() const { return m_Index == kInvalidIndex; }
+
+    bool operator==( EntityHandle const& other ) const
+    {
+        return m_Index == other.m_Index && m_Generation == other.m_Generation;
+    }
+    bool operator!=( EntityHandle const& other ) const { return !( *this == other ); }
+};
+
+class EntityRegistry
+{
+public:
+//-----------------------------------------------------------------------------
+// Constants
+//-----------------------------------------------------------------------------
+
+    /// @brief  number of slots allocated at once when the registry grows
+    static constexpr uint32_t kPageBits = 12;
+    static constexpr uint32_t kPageSize = 1u << kPageBits;
+
+    /// @brief  maximum number of pages, bounding the registry at 16M live Entities
+    static constexpr uint32_t kMaxPages = 4096;
+
+//-----------------------------------------------------------------------------
+// Singleton Access
+//-----------------------------------------------------------------------------
+
+    static EntityRegistry& Instance()
+    {
+        static EntityRegistry instance;
+        return instance;
+    }
+
+    ~EntityRegistry();
+
+//-----------------------------------------------------------------------------
+// Public Methods
+//-----------------------------------------------------------------------------
+
+    /// @brief  allocates a slot for an Entity, reusing freed slots first
+    /// @param  entity  the Entity to store in the slot (nullptr reserves a handle to bind later)
+    /// @return handle referring to the new slot
+    /// @note   safe to call from multiple threads
+    EntityHandle Create( Entity* entity );
+
+    /// @brief  frees the slot of a handle and invalidates every outstanding copy of it
+    /// @param  handle  the handle to release
+    /// @return whether the handle was live and has been released
+    /// @note   safe to call from multiple threads
+    bool Release( EntityHandle handle );
+
+    /// @brief  stores an Entity in a slot that was reserved with Create( nullptr )
+    /// @param  handle  the reserved handle
+    /// @param  entity  the Entity to store
+    /// @return whether the handle was still valid
+    bool Bind( EntityHandle handle, Entity* entity );
+
+    /// @brief  resolves a handle to its Entity
+    /// @param  handle  the handle to resolve
+    /// @return the Entity, or nullptr if the handle is null or stale
+    Entity* Resolve( EntityHandle handle ) const;
+
+    /// @brief  checks whether a handle still refers to a live Entity
+    /// @param  handle  the handle to check
+    /// @return whether the handle is live
+    bool IsAlive( EntityHandle handle ) const;
+
+    /// @brief  gets the Entity stored at a slot index, regardless of generation
+    /// @param  index   the slot index
+    /// @return the Entity, or nullptr if the slot is free
+    Entity* GetEntity( uint32_t index ) const;
+
+    /// @brief  builds the current handle for a slot index
+    /// @param  index   the slot index
+    /// @return the handle, or a null handle if the slot is free
+    EntityHandle GetHandle( uint32_t index ) const;
+
+//-----------------------------------------------------------------------------
+// Public Accessors
+//-----------------------------------------------------------------------------
+
+    /// @brief  gets the number of slots ever handed out; every live index is below this
+    /// @return the high-water mark of slot indices
+    uint32_t GetCapacity() const { return m_Capacity.load( std::memory_order_acquire ); }
+
+    /// @brief  gets the number of live Entities
+    /// @return the number of live Entities
+    uint32_t GetLiveCount() const { return m_LiveCount.load( std::memory_order_relaxed ); }
+
+    // Prevent copy construction and assignment
+    EntityRegistry( EntityRegistry const& ) = delete;
+    EntityRegistry& operator=( EntityRegistry const& ) = delete;
+
+//-----------------------------------------------------------------------------
+// Private Types
+//-----------------------------------------------------------------------------
+private:
+
+    struct Slot
+    {
+        /// @brief  the Entity occupying this slot (nullptr when free)
+        std::atomic< Entity* > m_Entity{ nullptr };
+
+        /// @brief  incremented every time the slot is released
+        std::atomic< uint32_t > m_Generation{ 1 };
+
+        /// @brief  next slot in the free list (only valid while free)
+        uint32_t m_NextFree = EntityHandle::kInvalidIndex;
+    };
+
+    EntityRegistry() = default;
+
+    /// @brief  gets the slot at an index (the page must exist)
+    Slot& getSlot( uint32_t index ) const;
+
+//-----------------------------------------------------------------------------
+// Private Members
+//-----------------------------------------------------------------------------
+
+    /// @brief  page table; pages are never moved so resolving does not need the lock
+    std::array< std::atomic< Slot* >, kMaxPages > m_Pages{};
+
+    /// @brief  number of slots ever handed out
+    std::atomic< uint32_t > m_Capacity{ 0 };
+
+    /// @brief  number of live Entities
+    std::atomic< uint32_t > m_LiveCount{ 0 };
+
+    /// @brief  head of the free list
+    uint32_t m_FreeHead = EntityHandle::kInvalidIndex;
+
+    /// @brief  guards slot allocation and release
+    std::mutex m_Mutex;
+};
+
+/// @brief  gets the global EntityRegistry
+inline EntityRegistry* Entities()
+{
+    return &EntityRegistry::Instance();
+}
+
+#endif //ENTITYREGISTRY_H
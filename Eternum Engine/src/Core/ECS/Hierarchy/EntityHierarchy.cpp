@@ -0,0 +1,191 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: EntityHierarchy
+* Description:
+*     Implements the flattened depth-first Entity hierarchy.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+
+#include <pch.h>
+#include "EntityHierarchy.h"
+#include <Core/ECS/Entity/Entity.h>
+
+namespace {
+
+/// @brief  tombstones tolerated before structural changes compact on their own
+constexpr std::size_t kMinTombstonesToCompact = 1024;
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+// Structural Changes
+//-----------------------------------------------------------------------------
+
+void EntityHierarchy::Insert( Entity* entity )
+{
+    std::lock_guard< std::mutex > lock( m_Mutex );
+    maybeCompact();
+
+    const uint32_t id = entity->GetId();
+    if ( id >= m_PositionOf.size() )
+        m_PositionOf.resize( id + 1, kNoPosition );
+
+    m_PositionOf[ id ] = static_cast< uint32_t >( m_Order.size() );
+    m_Order.push_back( entity );
+    m_SubtreeSize.push_back( 1 );
+    m_Depth.push_back( 0 );
+}
+
+void EntityHierarchy::Remove( Entity const* entity )
+{
+    std::lock_guard< std::mutex > lock( m_Mutex );
+
+    // the slot stays inside its ancestors' ranges so no sizes need to change
+    uint32_t& position = m_PositionOf[ entity->GetId() ];
+    m_Order[ position ] = nullptr;
+    position = kNoPosition;
+    ++m_Tombstones;
+}
+
+void EntityHierarchy::Reparent( Entity const* entity, Entity const* oldParent, Entity const* newParent )
+{
+    std::lock_guard< std::mutex > lock( m_Mutex );
+
+    const uint32_t begin = positionOf( entity );
+    const uint32_t count = m_SubtreeSize[ begin ];
+    const uint32_t end = begin + count;
+
+    // the range goes right after the new parent's current subtree; since the new parent
+    // is never inside the moved range, that point is never inside it either
+    uint32_t target = static_cast< uint32_t >( m_Order.size() );
+    uint32_t depth = 0;
+    if ( newParent )
+    {
+        const uint32_t parentPosition = positionOf( newParent );
+        target = parentPosition + m_SubtreeSize[ parentPosition ];
+        depth = m_Depth[ parentPosition ] + 1;
+    }
+
+    const int32_t depthDelta = static_cast< int32_t >( depth ) - static_cast< int32_t >( m_Depth[ begin ] );
+
+    // move the whole range in each parallel array; a target of begin means it is
+    // already in place
+    uint32_t first = begin, middle = begin, last = begin;
+    if ( target < begin )
+    {
+        first = target;
+        middle = begin;
+        last = end;
+    }
+    else if ( target >= end )
+    {
+        middle = end;
+        last = target;
+    }
+    if ( first != middle && middle != last )
+    {
+        std::rotate( m_Order.begin() + first, m_Order.begin() + middle, m_Order.begin() + last );
+        std::rotate( m_SubtreeSize.begin() + first, m_SubtreeSize.begin() + middle, m_SubtreeSize.begin() + last );
+        std::rotate( m_Depth.begin() + first, m_Depth.begin() + middle, m_Depth.begin() + last );
+        updatePositions( first, last );
+    }
+
+    if ( depthDelta != 0 )
+    {
+        const uint32_t movedBegin = positionOf( entity );
+        for ( uint32_t position = movedBegin; position < movedBegin + count; ++position )
+            m_Depth[ position ] = static_cast< uint32_t >( static_cast< int32_t >( m_Depth[ position ] ) + depthDelta );
+    }
+
+    // ancestors shared by both chains lose and regain the range, which cancels out
+    for ( Entity const* ancestor = oldParent; ancestor; ancestor = ancestor->GetParent() )
+        m_SubtreeSize[ positionOf( ancestor ) ] -= count;
+    for ( Entity const* ancestor = newParent; ancestor; ancestor = ancestor->GetParent() )
+        m_SubtreeSize[ positionOf( ancestor ) ] += count;
+}
+
+void EntityHierarchy::Compact()
+{
+    std::lock_guard< std::mutex > lock( m_Mutex );
+    if ( m_Tombstones != 0 )
+        compact();
+}
+
+//-----------------------------------------------------------------------------
+// Queries
+//-----------------------------------------------------------------------------
+
+bool EntityHierarchy::IsDescendant( Entity const* entity, Entity const* ancestor ) const
+{
+    if ( entity == nullptr || ancestor == nullptr || entity == ancestor )
+        return false;
+
+    const uint32_t position = positionOf( entity );
+    const uint32_t ancestorPosition = positionOf( ancestor );
+    return position > ancestorPosition && position < ancestorPosition + m_SubtreeSize[ ancestorPosition ];
+}
+
+std::pair< uint32_t, uint32_t > EntityHierarchy::GetSubtreeRange( Entity const* root ) const
+{
+    const uint32_t position = positionOf( root );
+    return { position, position + m_SubtreeSize[ position ] };
+}
+
+uint32_t EntityHierarchy::GetDepth( Entity const* entity ) const
+{
+    return m_Depth[ positionOf( entity ) ];
+}
+
+//-----------------------------------------------------------------------------
+// Private Methods
+//-----------------------------------------------------------------------------
+
+uint32_t EntityHierarchy::positionOf( Entity const* entity ) const
+{
+    return m_PositionOf[ entity->GetId() ];
+}
+
+void EntityHierarchy::updatePositions( uint32_t begin, uint32_t end )
+{
+    for ( uint32_t position = begin; position < end; ++position )
+        if ( Entity const* entity = m_Order[ position ] )
+            m_PositionOf[ entity->GetId() ] = position;
+}
+
+void EntityHierarchy::maybeCompact()
+{
+    if ( m_Tombstones >= kMinTombstonesToCompact && m_Tombstones * 2 > m_Order.size() )
+        compact();
+}
+
+void EntityHierarchy::compact()
+{
+    // live[ i ] is the number of live slots before position i, which turns each old
+    // range into its compacted size
+    std::vector< uint32_t > live( m_Order.size() + 1, 0 );
+    for ( std::size_t position = 0; position < m_Order.size(); ++position )
+        live[ position + 1 ] = live[ position ] + ( m_Order[ position ] != nullptr ? 1 : 0 );
+
+    uint32_t next = 0;
+    for ( uint32_t position = 0; position < m_Order.size(); ++position )
+    {
+        Entity* entity = m_Order[ position ];
+        if ( entity == nullptr )
+            continue;
+
+        m_SubtreeSize[ next ] = live[ position + m_SubtreeSize[ position ] ] - live[ position ];
+        m_Depth[ next ] = m_Depth[ position ];
+        m_Order[ next ] = entity;
+        m_PositionOf[ entity->GetId() ] = next;
+        ++next;
+    }
+
+    m_Order.resize( next );
+    m_SubtreeSize.resize( next );
+    m_Depth.resize( next );
+    m_Tombstones = 0;
+}
@@ -0,0 +1,153 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: EntityHierarchy
+* Description:
+*     Flattened, depth-first view of every Entity hierarchy. Each subtree occupies a
+*     contiguous range of the order array, so ancestry checks are an interval test and
+*     subtree traversal is a linear scan. Reparenting moves the whole range at once.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef ENTITYHIERARCHY_H
+#define ENTITYHIERARCHY_H
+
+#include <pch.h>
+
+class Entity;
+
+class EntityHierarchy
+{
+public:
+    /// @brief  gets the global EntityHierarchy
+    /// @note   intentionally never destroyed since Entities may be released during
+    ///         static destruction
+    static EntityHierarchy& Instance()
+    {
+        static EntityHierarchy* instance = new EntityHierarchy();
+        return *instance;
+    }
+
+//-----------------------------------------------------------------------------
+// Structural Changes
+//-----------------------------------------------------------------------------
+
+    /// @brief  adds a new Entity as a root at the end of the order
+    /// @param  entity  the Entity to add
+    void Insert( Entity* entity );
+
+    /// @brief  removes an Entity whose descendants have already been removed; its slot
+    ///         becomes a tombstone until the next compaction
+    /// @param  entity  the Entity to remove
+    void Remove( Entity const* entity );
+
+    /// @brief  moves an Entity and its whole subtree under a new parent
+    /// @param  entity      the Entity being moved
+    /// @param  oldParent   the parent it is leaving (nullptr for a root)
+    /// @param  newParent   the parent it is joining (nullptr to become a root)
+    /// @note   the Entities' parent pointers may already point at newParent; only
+    ///         oldParent is used to find the old ancestors
+    void Reparent( Entity const* entity, Entity const* oldParent, Entity const* newParent );
+
+    /// @brief  squeezes out tombstones left by removed Entities
+    void Compact();
+
+//-----------------------------------------------------------------------------
+// Queries
+//-----------------------------------------------------------------------------
+
+    /// @brief  checks in O(1) whether an Entity lies strictly inside another's subtree
+    /// @param  entity      the possible descendant
+    /// @param  ancestor    the possible ancestor
+    /// @return whether entity is descended from ancestor
+    bool IsDescendant( Entity const* entity, Entity const* ancestor ) const;
+
+    /// @brief  gets the [begin, end) range of order positions covered by a subtree,
+    ///         including the root itself
+    /// @param  root    the root of the subtree
+    /// @return the range of positions
+    std::pair< uint32_t, uint32_t > GetSubtreeRange( Entity const* root ) const;
+
+    /// @brief  gets the Entity at an order position
+    /// @return the Entity, or nullptr for a tombstone
+    Entity* GetEntityAt( uint32_t position ) const { return m_Order[ position ]; }
+
+    /// @brief  gets the depth (0 for roots) of the Entity at an order position
+    uint32_t GetDepthAt( uint32_t position ) const { return m_Depth[ position ]; }
+
+    /// @brief  gets the depth of an Entity (0 for roots)
+    uint32_t GetDepth( Entity const* entity ) const;
+
+    /// @brief  calls a function for a subtree in depth-first order, parents before children
+    /// @param  root    the root of the subtree (included)
+    /// @param  func    called as func( Entity*, depth )
+    template < typename Func >
+    void ForEachInSubtree( Entity const* root, Func&& func ) const
+    {
+        auto const [ begin, end ] = GetSubtreeRange( root );
+        for ( uint32_t position = begin; position < end; ++position )
+            if ( Entity* entity = m_Order[ position ] )
+                func( entity, m_Depth[ position ] );
+    }
+
+    /// @brief  gets the number of slots in the order array, tombstones included
+    std::size_t GetSlotCount() const { return m_Order.size(); }
+
+    /// @brief  gets the number of tombstones waiting for compaction
+    std::size_t GetTombstoneCount() const { return m_Tombstones; }
+
+    // Prevent copy construction and assignment
+    EntityHierarchy( EntityHierarchy const& ) = delete;
+    EntityHierarchy& operator=( EntityHierarchy const& ) = delete;
+
+//-----------------------------------------------------------------------------
+// Private Methods
+//-----------------------------------------------------------------------------
+private:
+
+    static constexpr uint32_t kNoPosition = 0xFFFFFFFFu;
+
+    EntityHierarchy() = default;
+
+    /// @brief  gets the position of an Entity (lock must be held or structure quiescent)
+    uint32_t positionOf( Entity const* entity ) const;
+
+    /// @brief  refreshes the stored positions of the Entities in [begin, end)
+    void updatePositions( uint32_t begin, uint32_t end );
+
+    /// @brief  compacts if tombstones make up most of the order (lock must be held)
+    void maybeCompact();
+
+    /// @brief  compacts the order (lock must be held)
+    void compact();
+
+//-----------------------------------------------------------------------------
+// Private Members
+//-----------------------------------------------------------------------------
+
+    /// @brief  Entities in depth-first pre-order; nullptr marks a tombstone
+    std::vector< Entity* > m_Order;
+
+    /// @brief  number of slots covered by the subtree rooted at each position
+    std::vector< uint32_t > m_SubtreeSize;
+
+    /// @brief  depth of the Entity at each position
+    std::vector< uint32_t > m_Depth;
+
+    /// @brief  position of each Entity, indexed by Entity ID
+    std::vector< uint32_t > m_PositionOf;
+
+    std::size_t m_Tombstones = 0;
+
+    std::mutex m_Mutex;
+};
+
+/// @brief  gets the global EntityHierarchy
+inline EntityHierarchy* Hierarchy()
+{
+    return &EntityHierarchy::Instance();
+}
+
+#endif //ENTITYHIERARCHY_H
@@ -0,0 +1,137 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: Prefab
+* Description:
+*     Implements building Prefab templates and instantiating them in bulk.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+
+#include <pch.h>
+#include "Prefab.h"
+
+//-----------------------------------------------------------------------------
+// Building
+//-----------------------------------------------------------------------------
+
+uint32_t Prefab::AddNode( StringId name, uint32_t parent )
+{
+    const uint32_t index = static_cast< uint32_t >( m_Nodes.size() );
+
+    if ( index == 0 && parent != kNoParent )
+    {
+        ETERNUM_LOG_ERROR( "prefab node \"", name, "\" must be the root, as it is the first node" );
+        return kInvalidNode;
+    }
+    if ( index != 0 && parent == kNoParent )
+    {
+        ETERNUM_LOG_ERROR( "prefab already has a root, so \"", name, "\" needs a parent" );
+        return kInvalidNode;
+    }
+    if ( index != 0 && parent >= index )
+    {
+        ETERNUM_LOG_ERROR( "prefab has no node ", parent, " to be the parent of \"", name, "\"" );
+        return kInvalidNode;
+    }
+
+    m_Nodes.push_back( { name, parent, {} } );
+    if ( parent != kNoParent )
+        m_Nodes[ parent ].m_Children.push_back( index );
+    return index;
+}
+
+//-----------------------------------------------------------------------------
+// Instantiation
+//-----------------------------------------------------------------------------
+
+std::vector< Entity* > Prefab::Instantiate( std::size_t count ) const
+{
+    if ( count == 0 || m_Nodes.empty() )
+        return {};
+
+    const std::size_t nodeCount = m_Nodes.size();
+    const std::size_t total = count * nodeCount;
+
+    // depth-first order, so every copy appends to the EntityHierarchy without moving ranges
+    std::vector< uint32_t > order;
+    order.reserve( nodeCount );
+    std::vector< uint32_t > stack{ 0 };
+    while ( !stack.empty() )
+    {
+        const uint32_t node = stack.back();
+        stack.pop_back();
+        order.push_back( node );
+        stack.insert( stack.end(), m_Nodes[ node ].m_Children.rbegin(), m_Nodes[ node ].m_Children.rend() );
+    }
+
+    // every Entity of the batch in one contiguous run, copy by copy in depth-first order
+    std::vector< void* > blocks( total );
+    if ( PoolAllocator* pool = Pools()->GetPool( sizeof( Entity ) ) )
+        pool->AllocateBatch( total, blocks.data() );
+    else
+        for ( void*& block : blocks )
+            block = Pools()->Allocate( sizeof( Entity ) );
+
+    std::vector< Entity* > entities( total );
+    std::size_t nextBlock = 0;
+    for ( std::size_t copy = 0; copy < count; ++copy )
+    {
+        Entity** copyEntities = entities.data() + copy * nodeCount;
+        for ( uint32_t node : order )
+        {
+            Entity* entity = ::new ( blocks[ nextBlock++ ] ) Entity();
+            entity->SetName( m_Nodes[ node ].m_Name );
+            if ( m_Nodes[ node ].m_Parent != kNoParent )
+                entity->SetParent( copyEntities[ m_Nodes[ node ].m_Parent ] );
+            copyEntities[ node ] = entity;
+        }
+    }
+
+    // build every column, then hand each Entity its Components in type order so they
+    // append to the end of its component map
+    std::vector< ColumnBase const* > columns;
+    for ( auto const& column : m_Columns )
+        columns.push_back( column.get() );
+    std::sort( columns.begin(), columns.end(), []( ColumnBase const* a, ColumnBase const* b ) { return a->m_Type < b->m_Type; } );
+
+    const std::size_t columnCount = columns.size();
+    std::vector< Component* > staged( total * columnCount, nullptr );
+    std::vector< Component* > made;
+    for ( std::size_t c = 0; c < columnCount; ++c )
+    {
+        ColumnBase const& column = *columns[ c ];
+        const std::size_t perCopy = column.m_Nodes.size();
+        made.resize( count * perCopy );
+        column.instantiate( count, made.data() );
+
+        for ( std::size_t copy = 0; copy < count; ++copy )
+            for ( std::size_t k = 0; k < perCopy; ++k )
+                staged[ ( copy * nodeCount + column.m_Nodes[ k ] ) * columnCount + c ] = made[ copy * perCopy + k ];
+    }
+
+    if ( columnCount != 0 )
+    {
+        const ChangeVersion version = Changes()->GetVersion();
+        for ( std::size_t i = 0; i < total; ++i )
+            entities[ i ]->adoptComponents( staged.data() + i * columnCount, columnCount, version );
+
+        // log the new Components once per column rather than once per Component
+        std::vector< EntityHandle > handles;
+        for ( ColumnBase const* column : columns )
+        {
+            handles.clear();
+            for ( std::size_t copy = 0; copy < count; ++copy )
+                for ( uint32_t node : column->m_Nodes )
+                    handles.push_back( entities[ copy * nodeCount + node ]->GetHandle() );
+            Changes()->RecordBatch( column->m_TypeId, handles.data(), handles.size(), version );
+        }
+    }
+
+    std::vector< Entity* > roots( count );
+    for ( std::size_t copy = 0; copy < count; ++copy )
+        roots[ copy ] = entities[ copy * nodeCount ];
+    return roots;
+}
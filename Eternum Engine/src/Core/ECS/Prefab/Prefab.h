@@ -0,0 +1,182 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: Prefab
+* Description:
+*     Compiled Entity templates. A Prefab is a flattened Entity tree with one column of
+*     default Component data per Component type. Instantiating it creates many copies
+*     in one batch: Entities and Components come from contiguous pool blocks and are
+*     copy-constructed from the column prototypes, without virtual Clone calls.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef PREFAB_H
+#define PREFAB_H
+
+#include <pch.h>
+#include <Core/ECS/Entity/Entity.h>
+#include <Core/ECS/Component/Component.h>
+
+class Prefab
+{
+public:
+    /// @brief  parent index of the root node
+    static constexpr uint32_t kNoParent = 0xFFFFFFFFu;
+
+    /// @brief  returned by AddNode when the node is rejected; never the index of a node
+    static constexpr uint32_t kInvalidNode = 0xFFFFFFFFu;
+
+    Prefab() = default;
+    ~Prefab() = default;
+
+    Prefab( Prefab&& ) = default;
+    Prefab& operator=( Prefab&& ) = default;
+
+    // Prevent copy construction and assignment
+    Prefab( Prefab const& ) = delete;
+    Prefab& operator=( Prefab const& ) = delete;
+
+//-----------------------------------------------------------------------------
+// Building
+//-----------------------------------------------------------------------------
+
+    /// @brief  adds a node to the template
+    /// @param  name    the name every instance of the node gets
+    /// @param  parent  index of the parent node; only the first node may be the root
+    /// @return index of the new node, or kInvalidNode if the parent is invalid, which is
+    ///         logged and nothing is added
+    uint32_t AddNode( StringId name, uint32_t parent = kNoParent );
+
+    /// @brief  adds default Component data to a node
+    /// @tparam ComponentType   the exact Component type; instances are copy-constructed
+    ///         from the prototype
+    /// @param  node        the node to add to; an index AddNode did not return is logged
+    ///                     and ignored
+    /// @param  prototype   the default data
+    template < typename ComponentType >
+    void AddComponent( uint32_t node, ComponentType const& prototype )
+    {
+        static_assert( std::is_base_of_v< Component, ComponentType >, "Prefab components must derive from Component" );
+
+        if ( node >= m_Nodes.size() )
+        {
+            ETERNUM_LOG_ERROR( "prefab has no node ", node, " to add a ",
+                               PrefixlessName( typeid( ComponentType ) ), " to" );
+            return;
+        }
+
+        Column< ComponentType >& column = getColumn< ComponentType >();
+        if ( std::find( column.m_Nodes.begin(), column.m_Nodes.end(), node ) != column.m_Nodes.end() )
+        {
+            ETERNUM_LOG_WARNING( "prefab node \"", m_Nodes[ node ].m_Name, "\" already has a ",
+                                 PrefixlessName( typeid( ComponentType ) ) );
+            return;
+        }
+
+        column.m_Nodes.push_back( node );
+        column.m_Prototypes.push_back( prototype );
+    }
+
+//-----------------------------------------------------------------------------
+// Instantiation
+//-----------------------------------------------------------------------------
+
+    /// @brief  creates copies of the whole template in one batch
+    /// @param  count   the number of copies
+    /// @return the root Entity of each copy; each owns its subtree and must be deleted
+    /// @note   Components are attached without OnInit; call Init() on the Entities once
+    ///         they enter the Scene
+    std::vector< Entity* > Instantiate( std::size_t count ) const;
+
+//-----------------------------------------------------------------------------
+// Public Accessors
+//-----------------------------------------------------------------------------
+
+    /// @brief  gets the number of nodes in the template
+    std::size_t GetNodeCount() const { return m_Nodes.size(); }
+
+//-----------------------------------------------------------------------------
+// Private Types
+//-----------------------------------------------------------------------------
+private:
+
+    struct Node
+    {
+        StringId m_Name;
+        uint32_t m_Parent;
+        std::vector< uint32_t > m_Children;
+    };
+
+    /// @brief  default data of one Component type, type-erased only at the column level
+    struct ColumnBase
+    {
+        explicit ColumnBase( std::type_index type ) :
+            m_Type( type ),
+            m_TypeId( ComponentTypeRegistry::GetId( type ) )
+        {}
+        virtual ~ColumnBase() = default;
+
+        /// @brief  constructs every instance of this column
+        /// @param  count   number of template copies
+        /// @param  out     receives count * m_Nodes.size() Components, copy by copy
+        virtual void instantiate( std::size_t count, Component** out ) const = 0;
+
+        std::type_index m_Type;
+        ComponentTypeId m_TypeId;
+
+        /// @brief  node index of each prototype
+        std::vector< uint32_t > m_Nodes;
+    };
+
+    template < typename ComponentType >
+    struct Column final : ColumnBase
+    {
+        Column() : ColumnBase( typeid( ComponentType ) ) {}
+
+        void instantiate( std::size_t count, Component** out ) const override
+        {
+            const std::size_t total = count * m_Prototypes.size();
+            std::vector< void* > blocks( total );
+
+            // one contiguous run from the pool that Component::operator delete returns to
+            if ( PoolAllocator* pool = Pools()->GetPool( sizeof( ComponentType ) ) )
+                pool->AllocateBatch( total, blocks.data() );
+            else
+                for ( void*& block : blocks )
+                    block = Pools()->Allocate( sizeof( ComponentType ) );
+
+            std::size_t next = 0;
+            for ( std::size_t copy = 0; copy < count; ++copy )
+                for ( ComponentType const& prototype : m_Prototypes )
+                {
+                    out[ next ] = ::new ( blocks[ next ] ) ComponentType( prototype );
+                    ++next;
+                }
+        }
+
+        std::vector< ComponentType > m_Prototypes;
+    };
+
+    /// @brief  gets the column of a Component type, creating it on first use
+    template < typename ComponentType >
+    Column< ComponentType >& getColumn()
+    {
+        for ( auto const& column : m_Columns )
+            if ( column->m_Type == typeid( ComponentType ) )
+                return static_cast< Column< ComponentType >& >( *column );
+
+        m_Columns.push_back( std::make_unique< Column< ComponentType > >() );
+        return static_cast< Column< ComponentType >& >( *m_Columns.back() );
+    }
+
+//-----------------------------------------------------------------------------
+// Private Members
+//-----------------------------------------------------------------------------
+
+    std::vector< Node > m_Nodes;
+    std::vector< std::unique_ptr< ColumnBase > > m_Columns;
+};
+
+#endif //PREFAB_H
@@ -0,0 +1,45 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: Query
+* Description:
+*     Implements the QueryRegistry that keeps every cached Query in sync with the ECS.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+
+#include <pch.h>
+#include "Query.h"
+
+void QueryRegistry::Register( QueryBase* query )
+{
+    std::lock_guard< std::mutex > lock( m_Mutex );
+    m_Queries.push_back( query );
+
+    // catch the new query up with every Entity that already exists
+    const uint32_t capacity = Entities()->GetCapacity();
+    for ( uint32_t index = 0; index < capacity; ++index )
+    {
+        Entity* entity = Entities()->GetEntity( index );
+        if ( entity && query->Matches( entity->GetSignature() ) )
+            query->onEntityMatched( entity );
+    }
+}
+
+void QueryRegistry::OnSignatureChanged( Entity* entity, ComponentMask const& before, ComponentMask const& after )
+{
+    // a query may be registered from another thread while Components change
+    std::lock_guard< std::mutex > lock( m_Mutex );
+    for ( QueryBase* query : m_Queries )
+    {
+        const bool matchedBefore = query->Matches( before );
+        const bool matchesNow = query->Matches( after );
+
+        if ( matchedBefore && !matchesNow )
+            query->onEntityUnmatched( entity );
+        else if ( !matchedBefore && matchesNow )
+            query->onEntityMatched( entity );
+    }
+}
@@ -0,0 +1,330 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: Query
+* Description:
+*     Cached multi-component views over the ECS. A Query<A, B, ...> keeps the set of
+*     Entities that own every requested Component type, along with direct pointers to
+*     those Components, and is updated incrementally as Components are added or removed.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef QUERY_H
+#define QUERY_H
+
+#include <pch.h>
+#include <Core/ECS/Entity/Entity.h>
+#include <Core/ECS/Component/Component.h>
+#include <Core/ECS/Component/ComponentType.h>
+#include <Core/Jobs/JobSystem.h>
+#include <numeric>
+
+/// @brief  type-erased part of a Query, used by the QueryRegistry to keep match sets current
+class QueryBase
+{
+public:
+    virtual ~QueryBase() = default;
+
+    /// @brief  gets the Component types this query requires
+    /// @return the signature mask of this query
+    ComponentMask const& GetMask() const { return m_Mask; }
+
+    /// @brief  checks whether an Entity signature satisfies this query
+    /// @param  signature   the Component mask of an Entity
+    /// @return whether every required type is present
+    bool Matches( ComponentMask const& signature ) const { return ( signature & m_Mask ) == m_Mask; }
+
+protected:
+    friend class QueryRegistry;
+
+    explicit QueryBase( ComponentMask const& mask ) : m_Mask( mask ) {}
+
+    /// @brief  called when an Entity starts matching this query
+    virtual void onEntityMatched( Entity* entity ) = 0;
+
+    /// @brief  called when an Entity stops matching this query
+    virtual void onEntityUnmatched( Entity* entity ) = 0;
+
+private:
+    ComponentMask const m_Mask;
+};
+
+/// @brief  keeps every Query informed of Entity signature changes
+class QueryRegistry
+{
+public:
+    /// @brief  gets the global QueryRegistry
+    /// @note   intentionally never destroyed since Entities may be released during
+    ///         static destruction
+    static QueryRegistry& Instance()
+    {
+        static QueryRegistry* instance = new QueryRegistry();
+        return *instance;
+    }
+
+    /// @brief  registers a query and fills it with every existing matching Entity
+    /// @param  query   the query to register
+    void Register( QueryBase* query );
+
+    /// @brief  updates every query after the Components on an Entity change
+    /// @param  entity  the Entity that changed
+    /// @param  before  the signature before the change
+    /// @param  after   the signature after the change
+    void OnSignatureChanged( Entity* entity, ComponentMask const& before, ComponentMask const& after );
+
+private:
+    QueryRegistry() = default;
+
+    /// @brief  guards m_Queries and the queries' contents against concurrent registration
+    std::vector< QueryBase* > m_Queries;
+    std::mutex m_Mutex;
+};
+
+/// @brief  gets the global QueryRegistry
+inline QueryRegistry* Queries()
+{
+    return &QueryRegistry::Instance();
+}
+
+/// @brief  cached view of every Entity that has all of the given Component types
+/// @tparam ComponentTypes  the exact Component types an Entity must have; const-qualify a
+///         type to read it without marking it as changed
+/// @note   structural changes (adding/removing Components, destroying Entities) must not
+///         happen while a query is being iterated; record them in a command buffer instead
+template < typename... ComponentTypes >
+class Query final : public QueryBase
+{
+    static_assert( sizeof...( ComponentTypes ) > 0, "Query needs at least one Component type" );
+
+public:
+    /// @brief  gets the cached query for this set of Component types
+    /// @return the query
+    static Query& Get()
+    {
+        static Query* s_Instance = create();
+        return *s_Instance;
+    }
+
+//-----------------------------------------------------------------------------
+// Iteration
+//-----------------------------------------------------------------------------
+
+    /// @brief  calls a function for every matching Entity
+    /// @param  func    called as func( Entity&, ComponentTypes&... )
+    /// @note   every non-const Component handed out is marked as changed
+    template < typename Func >
+    void ForEach( Func&& func )
+    {
+        forEachRange( 0, m_Entities.size(), func, std::index_sequence_for< ComponentTypes... >{} );
+    }
+
+    /// @brief  calls a function for every matching Entity where at least one of the
+    ///         requested Components was written after a version
+    /// @param  since   the version to compare against, usually the one returned by
+    ///                 Changes()->Advance() when the caller last ran
+    /// @param  func    called as func( Entity&, ComponentTypes&... )
+    /// @note   work is proportional to the number of changes while the change logs still
+    ///         reach back to since; otherwise every row's versions are checked
+    template < typename Func >
+    void ForEachChanged( ChangeVersion since, Func&& func )
+    {
+        constexpr auto sequence = std::index_sequence_for< ComponentTypes... >{};
+
+        std::vector< uint32_t > rows;
+        if ( collectLoggedRows( since, rows, sequence ) )
+        {
+            std::sort( rows.begin(), rows.end() );
+            rows.erase( std::unique( rows.begin(), rows.end() ), rows.end() );
+        }
+        else
+        {
+            rows.resize( m_Entities.size() );
+            std::iota( rows.begin(), rows.end(), 0u );
+        }
+
+        // log entries can be stale, so the Components' own versions decide
+        rows.erase( std::remove_if( rows.begin(), rows.end(), [ this, since, sequence ]( uint32_t row )
+        {
+            return !rowChangedSince( row, since, sequence );
+        } ), rows.end() );
+
+        WriteLog writes;
+        const ChangeVersion now = Changes()->GetVersion();
+        for ( uint32_t row : rows )
+            visitRow( row, func, now, writes, sequence );
+        flushWrites( writes, now, sequence );
+    }
+
+    /// @brief  calls a function for every matching Entity, spread across the JobSystem
+    /// @param  func    called as func( Entity&, ComponentTypes&... ), from several threads
+    /// @param  grain   number of Entities per job (0 picks one automatically)
+    template < typename Func >
+    void ParallelForEach( Func&& func, std::size_t grain = 0 )
+    {
+        Jobs()->ParallelFor( m_Entities.size(), grain, [ this, &func ]( std::size_t begin, std::size_t end )
+        {
+            forEachRange( begin, end, func, std::index_sequence_for< ComponentTypes... >{} );
+        } );
+    }
+
+//-----------------------------------------------------------------------------
+// Public Accessors
+//-----------------------------------------------------------------------------
+
+    /// @brief  gets the number of matching Entities
+    std::size_t Size() const { return m_Entities.size(); }
+
+    /// @brief  gets whether no Entity matches
+    bool Empty() const { return m_Entities.empty(); }
+
+    /// @brief  gets the matching Entities, in iteration order
+    std::vector< Entity* > const& GetEntities() const { return m_Entities; }
+
+    /// @brief  gets the column of one of the requested Component types, in iteration order
+    /// @tparam ComponentType   one of the query's Component types
+    template < typename ComponentType >
+    std::vector< ComponentType* > const& GetComponents() const
+    {
+        return std::get< std::vector< ComponentType* > >( m_Columns );
+    }
+
+    // Prevent copy construction and assignment
+    Query( Query const& ) = delete;
+    Query& operator=( Query const& ) = delete;
+
+//-----------------------------------------------------------------------------
+// Private Methods
+//-----------------------------------------------------------------------------
+private:
+
+    static constexpr uint32_t kNoRow = 0xFFFFFFFFu;
+
+    /// @brief  Entities whose Components were newly stamped during an iteration, per column
+    using WriteLog = std::array< std::vector< EntityHandle >, sizeof...( ComponentTypes ) >;
+
+    Query() : QueryBase( ComponentTypeRegistry::MaskOf< ComponentTypes... >() ) {}
+
+    static Query* create()
+    {
+        // never destroyed, for the same reason as the QueryRegistry
+        Query* query = new Query();
+        Queries()->Register( query );
+        return query;
+    }
+
+    template < typename Func, std::size_t... I >
+    void forEachRange( std::size_t begin, std::size_t end, Func& func, std::index_sequence< I... > sequence )
+    {
+        WriteLog writes;
+        const ChangeVersion now = Changes()->GetVersion();
+        for ( std::size_t row = begin; row < end; ++row )
+            visitRow( row, func, now, writes, sequence );
+        flushWrites( writes, now, sequence );
+    }
+
+    template < typename Func, std::size_t... I >
+    void visitRow( std::size_t row, Func& func, ChangeVersion now, WriteLog& writes, std::index_sequence< I... > )
+    {
+        ( stampWrite< I >( row, now, writes ), ... );
+        func( *m_Entities[ row ], *std::get< I >( m_Columns )[ row ]... );
+    }
+
+    /// @brief  stamps the Component of a mutable column, remembering it for the change log
+    template < std::size_t I >
+    void stampWrite( std::size_t row, ChangeVersion now, WriteLog& writes )
+    {
+        using ComponentType = std::tuple_element_t< I, std::tuple< ComponentTypes... > >;
+        if constexpr ( !std::is_const_v< ComponentType > )
+        {
+            if ( std::get< I >( m_Columns )[ row ]->StampVersion( now ) )
+                writes[ I ].push_back( m_Entities[ row ]->GetHandle() );
+        }
+    }
+
+    /// @brief  logs every write stamped during an iteration, one lock per column
+    template < std::size_t... I >
+    static void flushWrites( WriteLog& writes, ChangeVersion now, std::index_sequence< I... > )
+    {
+        ( Changes()->RecordBatch( ComponentTypeRegistry::Of< std::remove_const_t< ComponentTypes > >(),
+                                  writes[ I ].data(), writes[ I ].size(), now ), ... );
+    }
+
+    /// @brief  gathers the rows of every logged write to the requested types
+    /// @return false if a log no longer reaches back to since
+    template < std::size_t... I >
+    bool collectLoggedRows( ChangeVersion since, std::vector< uint32_t >& rows, std::index_sequence< I... > )
+    {
+        auto addRow = [ this, &rows ]( EntityHandle handle )
+        {
+            if ( handle.m_Index >= m_RowOf.size() )
+                return;
+            const uint32_t row = m_RowOf[ handle.m_Index ];
+            if ( row != kNoRow && m_Entities[ row ]->GetHandle() == handle )
+                rows.push_back( row );
+        };
+
+        bool complete = true;
+        ( ( complete = complete && Changes()->ForEachSince(
+              ComponentTypeRegistry::Of< std::remove_const_t< ComponentTypes > >(), since, addRow ) ), ... );
+        return complete;
+    }
+
+    template < std::size_t... I >
+    bool rowChangedSince( uint32_t row, ChangeVersion since, std::index_sequence< I... > ) const
+    {
+        return ( std::get< I >( m_Columns )[ row ]->HasChangedSince( since ) || ... );
+    }
+
+    void onEntityMatched( Entity* entity ) override
+    {
+        const uint32_t id = entity->GetId();
+        if ( id >= m_RowOf.size() )
+            m_RowOf.resize( id + 1, kNoRow );
+
+        m_RowOf[ id ] = static_cast< uint32_t >( m_Entities.size() );
+        m_Entities.push_back( entity );
+        ( std::get< std::vector< ComponentTypes* > >( m_Columns ).push_back(
+            static_cast< ComponentTypes* >( entity->FindComponent( typeid( ComponentTypes ) ) ) ), ... );
+    }
+
+    void onEntityUnmatched( Entity* entity ) override
+    {
+        const uint32_t id = entity->GetId();
+        if ( id >= m_RowOf.size() || m_RowOf[ id ] == kNoRow )
+            return;
+
+        // swap the last row into the hole
+        const uint32_t row = m_RowOf[ id ];
+        const uint32_t last = static_cast< uint32_t >( m_Entities.size() - 1 );
+        m_RowOf[ m_Entities[ last ]->GetId() ] = row;
+        m_RowOf[ id ] = kNoRow;
+
+        m_Entities[ row ] = m_Entities[ last ];
+        m_Entities.pop_back();
+        ( swapRemove( std::get< std::vector< ComponentTypes* > >( m_Columns ), row ), ... );
+    }
+
+    template < typename T >
+    static void swapRemove( std::vector< T* >& column, uint32_t row )
+    {
+        column[ row ] = column.back();
+        column.pop_back();
+    }
+
+//-----------------------------------------------------------------------------
+// Private Members
+//-----------------------------------------------------------------------------
+
+    /// @brief  matching Entities
+    std::vector< Entity* > m_Entities;
+
+    /// @brief  one column of Component pointers per requested type, parallel to m_Entities
+    std::tuple< std::vector< ComponentTypes* >... > m_Columns;
+
+    /// @brief  row of each Entity, indexed by Entity ID
+    std::vector< uint32_t > m_RowOf;
+};
+
+#endif //QUERY_H
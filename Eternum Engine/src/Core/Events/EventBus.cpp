@@ -0,0 +1,31 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: EventBus
+* Description:
+*     Implements batched dispatch of every event channel.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+
+#include <pch.h>
+#include "EventBus.h"
+
+void EventBus::Dispatch()
+{
+    std::vector< EventChannelBase* > channels;
+    {
+        std::lock_guard< std::mutex > lock( m_Mutex );
+        channels = m_Channels;
+    }
+
+    // drain everything before delivering, so events published by handlers always wait
+    // for the next dispatch regardless of channel order
+    for ( EventChannelBase* channel : channels )
+        channel->drain();
+
+    for ( EventChannelBase* channel : channels )
+        channel->deliver();
+}
@@ -0,0 +1,267 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: EventBus
+* Description:
+*     Typed, batched event bus. Each event type has its own channel backed by a lock-free
+*     multi-producer ring, so any thread can publish without locking or allocating.
+*     Channels are drained at the Runtime's phase points and every subscriber receives
+*     the whole batch of its type as one contiguous span.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef EVENTBUS_H
+#define EVENTBUS_H
+
+#include <pch.h>
+#include <span>
+#include <Core/Events/MpmcQueue.h>
+
+/// @brief  identifies a subscription so it can be removed
+using SubscriptionId = uint32_t;
+
+/// @brief  type-erased channel, used by the EventBus to drain every type at once
+class EventChannelBase
+{
+public:
+    virtual ~EventChannelBase() = default;
+
+    /// @brief  moves every queued event into the channel's batch
+    virtual void drain() = 0;
+
+    /// @brief  hands the drained batch to every subscriber, then clears it
+    virtual void deliver() = 0;
+};
+
+/// @brief  queue, batch and subscribers of one event type
+/// @tparam EventType   a trivially copyable event type
+template < typename EventType >
+class EventChannel final : public EventChannelBase
+{
+public:
+    using Handler = std::function< void( std::span< EventType const > ) >;
+
+    /// @brief  number of events the lock-free ring holds between drains
+    static constexpr std::size_t kCapacity = 4096;
+
+    EventChannel() : m_Queue( kCapacity ) {}
+
+    /// @brief  queues an event; lock-free unless the ring is full
+    void Publish( EventType const& event )
+    {
+        // nobody listening: skip the queue entirely
+        if ( m_SubscriberCount.load( std::memory_order_relaxed ) == 0 )
+            return;
+
+        if ( !m_Queue.TryPush( event ) )
+        {
+            // bursts beyond the ring's capacity spill into a locked buffer so nothing is lost
+            std::lock_guard< std::mutex > lock( m_OverflowMutex );
+            m_Overflow.push_back( event );
+        }
+    }
+
+    /// @note   a handler added while the batch is being delivered gets the next batch
+    SubscriptionId Subscribe( Handler handler, SubscriptionId id )
+    {
+        if ( m_IsDelivering )
+            m_Added.push_back( { id, std::move( handler ) } );
+        else
+            m_Handlers.push_back( { id, std::move( handler ) } );
+        m_SubscriberCount.fetch_add( 1, std::memory_order_relaxed );
+        return id;
+    }
+
+    /// @note   a handler removed while the batch is being delivered, even by itself, is
+    ///         not called again; it is erased once delivery ends
+    bool Unsubscribe( SubscriptionId id )
+    {
+        auto matches = [ id ]( Subscription const& entry ) { return entry.m_Id == id && !entry.m_IsRemoved; };
+
+        auto it = std::find_if( m_Handlers.begin(), m_Handlers.end(), matches );
+        if ( it != m_Handlers.end() )
+        {
+            // the handler may be the one running, so it has to outlive this call
+            if ( m_IsDelivering )
+                it->m_IsRemoved = true;
+            else
+                m_Handlers.erase( it );
+        }
+        else
+        {
+            it = std::find_if( m_Added.begin(), m_Added.end(), matches );
+            if ( it == m_Added.end() )
+                return false;
+            m_Added.erase( it );
+        }
+
+        m_SubscriberCount.fetch_sub( 1, std::memory_order_relaxed );
+        return true;
+    }
+
+    std::size_t GetPendingCount()
+    {
+        std::lock_guard< std::mutex > lock( m_OverflowMutex );
+        return m_Queue.GetSizeApprox() + m_Overflow.size();
+    }
+
+private:
+    void drain() override
+    {
+        EventType event;
+        while ( m_Queue.TryPop( event ) )
+            m_Batch.push_back( event );
+
+        std::lock_guard< std::mutex > lock( m_OverflowMutex );
+        m_Batch.insert( m_Batch.end(), m_Overflow.begin(), m_Overflow.end() );
+        m_Overflow.clear();
+    }
+
+    void deliver() override
+    {
+        if ( m_Batch.empty() )
+            return;
+
+        // handlers may subscribe and unsubscribe; m_Handlers only shrinks or grows after
+        // the loop, so indexing into it stays valid
+        const std::span< EventType const > batch( m_Batch.data(), m_Batch.size() );
+        m_IsDelivering = true;
+        for ( std::size_t i = 0; i < m_Handlers.size(); ++i )
+            if ( !m_Handlers[ i ].m_IsRemoved )
+                m_Handlers[ i ].m_Handler( batch );
+        m_IsDelivering = false;
+        m_Batch.clear();
+
+        std::erase_if( m_Handlers, []( Subscription const& entry ) { return entry.m_IsRemoved; } );
+        for ( Subscription& entry : m_Added )
+            m_Handlers.push_back( std::move( entry ) );
+        m_Added.clear();
+    }
+
+    struct Subscription
+    {
+        SubscriptionId m_Id;
+        Handler m_Handler;
+
+        /// @brief  unsubscribed during delivery, waiting to be erased
+        bool m_IsRemoved = false;
+    };
+
+    MpmcQueue< EventType > m_Queue;
+
+    /// @brief  drained events, reused between dispatches
+    std::vector< EventType > m_Batch;
+
+    std::vector< EventType > m_Overflow;
+    std::mutex m_OverflowMutex;
+
+    std::vector< Subscription > m_Handlers;
+
+    /// @brief  subscribed during delivery, added to m_Handlers once it ends
+    std::vector< Subscription > m_Added;
+    bool m_IsDelivering = false;
+
+    std::atomic< std::size_t > m_SubscriberCount{ 0 };
+};
+
+class EventBus
+{
+public:
+    /// @brief  gets the global EventBus
+    /// @note   intentionally never destroyed so events published during static
+    ///         destruction still have a channel
+    static EventBus& Instance()
+    {
+        static EventBus* instance = new EventBus();
+        return *instance;
+    }
+
+//-----------------------------------------------------------------------------
+// Publishing (any thread)
+//-----------------------------------------------------------------------------
+
+    /// @brief  queues an event for the next Dispatch
+    /// @tparam EventType   the event type
+    /// @param  event   the event; copied into the channel's ring
+    /// @note   events published while nothing is subscribed to their type are dropped
+    template < typename EventType >
+    void Publish( EventType const& event )
+    {
+        channel< EventType >().Publish( event );
+    }
+
+//-----------------------------------------------------------------------------
+// Subscribing / Dispatching (main thread)
+//-----------------------------------------------------------------------------
+
+    /// @brief  subscribes to every batch of an event type
+    /// @tparam EventType   the event type
+    /// @param  handler called once per Dispatch with all events of the type, in publish order
+    ///                 per producer thread
+    /// @return id used to unsubscribe
+    template < typename EventType >
+    SubscriptionId Subscribe( typename EventChannel< EventType >::Handler handler )
+    {
+        return channel< EventType >().Subscribe( std::move( handler ), m_NextSubscription++ );
+    }
+
+    /// @brief  removes a subscription
+    /// @tparam EventType   the event type the subscription was made for
+    /// @param  id  the id returned by Subscribe
+    /// @return whether the subscription existed
+    template < typename EventType >
+    bool Unsubscribe( SubscriptionId id )
+    {
+        return channel< EventType >().Unsubscribe( id );
+    }
+
+    /// @brief  drains every channel, then delivers each batch to its subscribers
+    /// @note   events published by handlers are delivered by the next Dispatch
+    void Dispatch();
+
+    /// @brief  gets the number of events of a type waiting for the next Dispatch
+    template < typename EventType >
+    std::size_t GetPendingCount()
+    {
+        return channel< EventType >().GetPendingCount();
+    }
+
+    // Prevent copy construction and assignment
+    EventBus( EventBus const& ) = delete;
+    EventBus& operator=( EventBus const& ) = delete;
+
+private:
+    EventBus() = default;
+
+    /// @brief  gets the channel of an event type, creating it on first use
+    template < typename EventType >
+    EventChannel< EventType >& channel()
+    {
+        // never destroyed, for the same reason as the EventBus
+        static EventChannel< EventType >* s_Channel = addChannel( new EventChannel< EventType >() );
+        return *s_Channel;
+    }
+
+    /// @brief  adds a channel to the dispatch list
+    template < typename Channel >
+    Channel* addChannel( Channel* channel )
+    {
+        std::lock_guard< std::mutex > lock( m_Mutex );
+        m_Channels.push_back( channel );
+        return channel;
+    }
+
+    std::vector< EventChannelBase* > m_Channels;
+    std::mutex m_Mutex;
+    SubscriptionId m_NextSubscription = 1;
+};
+
+/// @brief  gets the global EventBus
+inline EventBus* Events()
+{
+    return &EventBus::Instance();
+}
+
+#endif //EVENTBUS_H
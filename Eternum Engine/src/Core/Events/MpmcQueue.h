@@ -0,0 +1,140 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: MpmcQueue
+* Description:
+*     Bounded lock-free multi-producer / multi-consumer queue (Vyukov's sequenced ring).
+*     Each cell carries a sequence number that tells producers and consumers whether it
+*     is free or full for their lap of the ring, so a push or pop is a single CAS on the
+*     shared position plus plain stores into the cell.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef MPMCQUEUE_H
+#define MPMCQUEUE_H
+
+#include <pch.h>
+#include <cstring>
+
+/// @brief  bounded lock-free queue of trivially copyable values
+/// @tparam T   the value type; stored inline in the ring, never on the heap
+template < typename T >
+class MpmcQueue
+{
+    static_assert( std::is_trivially_copyable_v< T >, "MpmcQueue values must be trivially copyable" );
+
+public:
+    /// @brief  constructor
+    /// @param  capacity    minimum number of values the ring holds; rounded up to a power of two
+    explicit MpmcQueue( std::size_t capacity )
+    {
+        std::size_t size = 2;
+        while ( size < capacity )
+            size <<= 1;
+
+        m_Mask = size - 1;
+        m_Cells = std::make_unique< Cell[] >( size );
+        for ( std::size_t i = 0; i < size; ++i )
+            m_Cells[ i ].m_Sequence.store( i, std::memory_order_relaxed );
+    }
+
+    // Prevent copy construction and assignment
+    MpmcQueue( MpmcQueue const& ) = delete;
+    MpmcQueue& operator=( MpmcQueue const& ) = delete;
+
+    /// @brief  pushes a value unless the ring is full
+    /// @param  value   the value to push
+    /// @return whether the value was pushed
+    bool TryPush( T const& value )
+    {
+        std::size_t position = m_EnqueuePosition.load( std::memory_order_relaxed );
+        for ( ;; )
+        {
+            Cell& cell = m_Cells[ position & m_Mask ];
+            const std::size_t sequence = cell.m_Sequence.load( std::memory_order_acquire );
+            const std::intptr_t lap = static_cast< std::intptr_t >( sequence ) - static_cast< std::intptr_t >( position );
+
+            if ( lap == 0 )
+            {
+                if ( m_EnqueuePosition.compare_exchange_weak( position, position + 1, std::memory_order_relaxed ) )
+                {
+                    std::memcpy( cell.m_Storage, &value, sizeof( T ) );
+                    cell.m_Sequence.store( position + 1, std::memory_order_release );
+                    return true;
+                }
+            }
+            else if ( lap < 0 )
+            {
+                // the consumers have not freed this cell yet
+                return false;
+            }
+            else
+            {
+                position = m_EnqueuePosition.load( std::memory_order_relaxed );
+            }
+        }
+    }
+
+    /// @brief  pops the oldest value unless the ring is empty
+    /// @param  out receives the value
+    /// @return whether a value was popped
+    bool TryPop( T& out )
+    {
+        std::size_t position = m_DequeuePosition.load( std::memory_order_relaxed );
+        for ( ;; )
+        {
+            Cell& cell = m_Cells[ position & m_Mask ];
+            const std::size_t sequence = cell.m_Sequence.load( std::memory_order_acquire );
+            const std::intptr_t lap = static_cast< std::intptr_t >( sequence ) - static_cast< std::intptr_t >( position + 1 );
+
+            if ( lap == 0 )
+            {
+                if ( m_DequeuePosition.compare_exchange_weak( position, position + 1, std::memory_order_relaxed ) )
+                {
+                    std::memcpy( &out, cell.m_Storage, sizeof( T ) );
+                    cell.m_Sequence.store( position + m_Mask + 1, std::memory_order_release );
+                    return true;
+                }
+            }
+            else if ( lap < 0 )
+            {
+                return false;
+            }
+            else
+            {
+                position = m_DequeuePosition.load( std::memory_order_relaxed );
+            }
+        }
+    }
+
+    /// @brief  gets the number of values the ring holds
+    std::size_t GetCapacity() const { return m_Mask + 1; }
+
+    /// @brief  gets an estimate of the number of queued values
+    std::size_t GetSizeApprox() const
+    {
+        const std::size_t enqueued = m_EnqueuePosition.load( std::memory_order_relaxed );
+        const std::size_t dequeued = m_DequeuePosition.load( std::memory_order_relaxed );
+        return enqueued > dequeued ? enqueued - dequeued : 0;
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic< std::size_t > m_Sequence;
+        alignas( T ) unsigned char m_Storage[ sizeof( T ) ];
+    };
+
+    /// @brief  keeps the producer and consumer positions on separate cache lines
+    static constexpr std::size_t kCacheLine = 64;
+
+    std::unique_ptr< Cell[] > m_Cells;
+    std::size_t m_Mask = 0;
+
+    alignas( kCacheLine ) std::atomic< std::size_t > m_EnqueuePosition{ 0 };
+    alignas( kCacheLine ) std::atomic< std::size_t > m_DequeuePosition{ 0 };
+};
+
+#endif //MPMCQUEUE_H
@@ -0,0 +1,138 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: JobSystem
+* Description:
+*     Implements the persistent worker pool and ParallelFor.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+
+#include <pch.h>
+#include "JobSystem.h"
+
+//-----------------------------------------------------------------------------
+// Constructor / Destructor
+//-----------------------------------------------------------------------------
+
+JobSystem::JobSystem()
+{
+    // the thread calling ParallelFor works too, so leave it a core
+    const unsigned cores = std::thread::hardware_concurrency();
+    const unsigned workers = cores > 1 ? cores - 1 : 1;
+
+    m_Workers.reserve( workers );
+    for ( unsigned i = 0; i < workers; ++i )
+        m_Workers.emplace_back( &JobSystem::workerLoop, this );
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard< std::mutex > lock( m_Mutex );
+        m_Stopping = true;
+    }
+    m_Wake.notify_all();
+
+    for ( std::thread& worker : m_Workers )
+        worker.join();
+}
+
+//-----------------------------------------------------------------------------
+// Public Methods
+//-----------------------------------------------------------------------------
+
+void JobSystem::Submit( std::function< void() > job )
+{
+    {
+        std::lock_guard< std::mutex > lock( m_Mutex );
+        m_Queue.push_back( std::move( job ) );
+    }
+    m_Wake.notify_one();
+}
+
+void JobSystem::ParallelFor( std::size_t count, std::size_t grain,
+                             std::function< void( std::size_t, std::size_t ) > const& body )
+{
+    if ( count == 0 )
+        return;
+
+    const std::size_t threads = m_Workers.size() + 1;
+    if ( grain == 0 )
+        grain = ( std::max )( std::size_t{ 1 }, count / ( threads * 4 ) );
+
+    const std::size_t chunks = ( count + grain - 1 ) / grain;
+    if ( chunks == 1 )
+    {
+        body( 0, count );
+        return;
+    }
+
+    // shared with the helper jobs, which may only start after this call returns
+    struct State
+    {
+        std::atomic< std::size_t > m_NextChunk{ 0 };
+        std::atomic< std::size_t > m_ChunksLeft{ 0 };
+        std::mutex m_DoneMutex;
+        std::condition_variable m_Done;
+    };
+    auto state = std::make_shared< State >();
+    state->m_ChunksLeft.store( chunks, std::memory_order_relaxed );
+
+    auto const* bodyPtr = &body;
+    auto runChunks = [ state, bodyPtr, count, grain, chunks ]()
+    {
+        for ( ;; )
+        {
+            const std::size_t chunk = state->m_NextChunk.fetch_add( 1, std::memory_order_relaxed );
+            if ( chunk >= chunks )
+                return;
+
+            const std::size_t begin = chunk * grain;
+            ( *bodyPtr )( begin, ( std::min )( begin + grain, count ) );
+
+            if ( state->m_ChunksLeft.fetch_sub( 1, std::memory_order_acq_rel ) == 1 )
+            {
+                std::lock_guard< std::mutex > lock( state->m_DoneMutex );
+                state->m_Done.notify_all();
+            }
+        }
+    };
+
+    const std::size_t helpers = ( std::min )( chunks - 1, m_Workers.size() );
+    for ( std::size_t i = 0; i < helpers; ++i )
+        Submit( runChunks );
+
+    runChunks();
+
+    std::unique_lock< std::mutex > lock( state->m_DoneMutex );
+    state->m_Done.wait( lock, [ &state ] {
+        return state->m_ChunksLeft.load( std::memory_order_acquire ) == 0;
+    } );
+}
+
+//-----------------------------------------------------------------------------
+// Private Methods
+//-----------------------------------------------------------------------------
+
+void JobSystem::workerLoop()
+{
+    for ( ;; )
+    {
+        std::function< void() > job;
+        {
+            std::unique_lock< std::mutex > lock( m_Mutex );
+            m_Wake.wait( lock, [ this ] { return m_Stopping || !m_Queue.empty(); } );
+
+            if ( m_Queue.empty() )
+                return;
+
+            job = std::move( m_Queue.front() );
+            m_Queue.pop_front();
+        }
+
+        job();
+    }
+}
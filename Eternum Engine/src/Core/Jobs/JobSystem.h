@@ -0,0 +1,92 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: JobSystem
+* Description:
+*     A small persistent worker pool. Jobs can be submitted fire-and-forget, or a range
+*     can be split across every core with ParallelFor, in which the calling thread also
+*     takes part.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef JOBSYSTEM_H
+#define JOBSYSTEM_H
+
+#include <pch.h>
+#include <condition_variable>
+#include <deque>
+
+class JobSystem
+{
+public:
+//-----------------------------------------------------------------------------
+// Singleton Access
+//-----------------------------------------------------------------------------
+
+    static JobSystem& Instance()
+    {
+        static JobSystem instance;
+        return instance;
+    }
+
+    /// @brief  destructor, finishes queued jobs and joins the workers
+    ~JobSystem();
+
+    // Prevent copy construction and assignment
+    JobSystem( JobSystem const& ) = delete;
+    JobSystem& operator=( JobSystem const& ) = delete;
+
+//-----------------------------------------------------------------------------
+// Public Methods
+//-----------------------------------------------------------------------------
+
+    /// @brief  queues a job to run on a worker thread
+    /// @param  job the job to run
+    void Submit( std::function< void() > job );
+
+    /// @brief  splits [0, count) into chunks and runs them on the workers and the
+    ///         calling thread, returning once every chunk is done
+    /// @param  count   the size of the range
+    /// @param  grain   the number of items per chunk (0 picks one automatically)
+    /// @param  body    called with the [begin, end) of each chunk
+    void ParallelFor( std::size_t count, std::size_t grain,
+                      std::function< void( std::size_t, std::size_t ) > const& body );
+
+//-----------------------------------------------------------------------------
+// Public Accessors
+//-----------------------------------------------------------------------------
+
+    /// @brief  gets the number of worker threads (not counting the caller)
+    /// @return the number of worker threads
+    unsigned GetWorkerCount() const { return static_cast< unsigned >( m_Workers.size() ); }
+
+//-----------------------------------------------------------------------------
+// Private Methods
+//-----------------------------------------------------------------------------
+private:
+
+    JobSystem();
+
+    /// @brief  main loop of every worker thread
+    void workerLoop();
+
+//-----------------------------------------------------------------------------
+// Private Members
+//-----------------------------------------------------------------------------
+
+    std::vector< std::thread > m_Workers;
+    std::deque< std::function< void() > > m_Queue;
+    std::mutex m_Mutex;
+    std::condition_variable m_Wake;
+    bool m_Stopping = false;
+};
+
+/// @brief  gets the global JobSystem
+inline JobSystem* Jobs()
+{
+    return &JobSystem::Instance();
+}
+
+#endif //JOBSYSTEM_H
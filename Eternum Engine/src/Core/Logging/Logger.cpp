@@ -0,0 +1,279 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: Logger
+* Description:
+*     Implements the per-thread log rings and the background sink.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+
+#include <pch.h>
+#include "Logger.h"
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+/// @brief  records each thread can queue before further messages are dropped
+constexpr std::size_t kRecordsPerThread = 512;
+
+/// @brief  how often the sink thread wakes to drain the rings
+constexpr std::chrono::milliseconds kSinkInterval( 5 );
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+// LogBuffer
+//-----------------------------------------------------------------------------
+
+/// @brief  single-producer / single-consumer ring; only its thread pushes and only the
+///         drain (under the drain lock) pops
+class LogBuffer
+{
+public:
+    explicit LogBuffer( uint32_t thread ) :
+        m_Thread( thread )
+    {}
+
+    uint32_t GetThread() const { return m_Thread; }
+
+    /// @brief  labels the records of the thread taking over this ring
+    void SetThread( uint32_t thread ) { m_Thread = thread; }
+
+    /// @brief  pushes a record unless the ring is full
+    bool TryPush( LogRecord const& record )
+    {
+        const std::size_t tail = m_Tail.load( std::memory_order_relaxed );
+        if ( tail - m_Head.load( std::memory_order_acquire ) == kRecordsPerThread )
+            return false;
+
+        m_Records[ tail % kRecordsPerThread ] = record;
+        m_Tail.store( tail + 1, std::memory_order_release );
+        return true;
+    }
+
+    /// @brief  appends every queued record to a list
+    void PopAll( std::vector< LogRecord >& out )
+    {
+        const std::size_t head = m_Head.load( std::memory_order_relaxed );
+        const std::size_t tail = m_Tail.load( std::memory_order_acquire );
+        for ( std::size_t i = head; i != tail; ++i )
+            out.push_back( m_Records[ i % kRecordsPerThread ] );
+        m_Head.store( tail, std::memory_order_release );
+    }
+
+private:
+    uint32_t m_Thread;
+
+    std::array< LogRecord, kRecordsPerThread > m_Records;
+
+    // the two ends live on separate cache lines so the writer and the sink don't contend
+    alignas( 64 ) std::atomic< std::size_t > m_Head = 0;
+    alignas( 64 ) std::atomic< std::size_t > m_Tail = 0;
+};
+
+//-----------------------------------------------------------------------------
+// Writing
+//-----------------------------------------------------------------------------
+
+Logger::Logger() :
+    m_Start( std::chrono::steady_clock::now() )
+{
+    m_SinkThread = std::thread( [ this ] { sinkLoop(); } );
+    std::atexit( [] { Logger::Instance().stop(); } );
+}
+
+std::ostringstream& Logger::threadStream()
+{
+    thread_local std::ostringstream t_Stream;
+    t_Stream.str( {} );
+    t_Stream.clear();
+    return t_Stream;
+}
+
+LogBuffer& Logger::threadBuffer()
+{
+    // hands the ring back at thread exit, so programs that keep starting threads reuse
+    // a few rings instead of keeping one per thread ever started
+    struct Owner
+    {
+        LogBuffer* m_Buffer = nullptr;
+
+        ~Owner()
+        {
+            if ( m_Buffer != nullptr )
+                Logger::Instance().retireBuffer( m_Buffer );
+            m_Buffer = nullptr;
+        }
+    };
+
+    thread_local Owner t_Owner;
+    if ( t_Owner.m_Buffer == nullptr )
+        t_Owner.m_Buffer = acquireBuffer();
+    return *t_Owner.m_Buffer;
+}
+
+LogBuffer* Logger::acquireBuffer()
+{
+    std::lock_guard< std::mutex > lock( m_BuffersMutex );
+    const uint32_t thread = m_NextThread++;
+    if ( !m_FreeBuffers.empty() )
+    {
+        LogBuffer* buffer = m_FreeBuffers.back();
+        m_FreeBuffers.pop_back();
+        buffer->SetThread( thread );
+        return buffer;
+    }
+
+    m_Buffers.push_back( std::make_unique< LogBuffer >( thread ) );
+    return m_Buffers.back().get();
+}
+
+void Logger::retireBuffer( LogBuffer* buffer )
+{
+    std::lock_guard< std::mutex > lock( m_BuffersMutex );
+    m_FreeBuffers.push_back( buffer );
+}
+
+void Logger::submit( LogLevel level, std::string_view text )
+{
+    LogBuffer& buffer = threadBuffer();
+
+    LogRecord record;
+    record.m_Sequence = m_NextSequence.fetch_add( 1, std::memory_order_relaxed );
+    record.m_Time = std::chrono::duration_cast< std::chrono::nanoseconds >(
+        std::chrono::steady_clock::now() - m_Start ).count();
+    record.m_Thread = buffer.GetThread();
+    record.m_Level = level;
+    record.m_Length = static_cast< uint16_t >( ( std::min )( text.size(), LogRecord::kMaxMessageLength ) );
+    std::memcpy( record.m_Text, text.data(), record.m_Length );
+
+    if ( !buffer.TryPush( record ) )
+        m_Dropped.fetch_add( 1, std::memory_order_relaxed );
+
+    // with the sink thread gone (at exit) nothing else will write the record
+    if ( m_Stopped.load( std::memory_order_acquire ) )
+        Flush();
+}
+
+void Logger::Flush()
+{
+    std::lock_guard< std::mutex > lock( m_DrainMutex );
+    drain();
+}
+
+//-----------------------------------------------------------------------------
+// Configuration
+//-----------------------------------------------------------------------------
+
+void Logger::SetSink( std::ostream* sink )
+{
+    std::lock_guard< std::mutex > lock( m_DrainMutex );
+    m_Sink = sink;
+    if ( m_File.is_open() )
+        m_File.close();
+}
+
+bool Logger::OpenFile( std::string const& path )
+{
+    std::ofstream file( path, std::ios::app );
+    if ( !file )
+        return false;
+
+    std::lock_guard< std::mutex > lock( m_DrainMutex );
+    m_File = std::move( file );
+    m_Sink = &m_File;
+    return true;
+}
+
+std::size_t Logger::GetRingCount()
+{
+    std::lock_guard< std::mutex > lock( m_BuffersMutex );
+    return m_Buffers.size();
+}
+
+char const* Logger::GetLevelName( LogLevel level )
+{
+    switch ( level )
+    {
+        case LogLevel::Trace:   return "TRACE";
+        case LogLevel::Debug:   return "DEBUG";
+        case LogLevel::Info:    return "INFO";
+        case LogLevel::Warning: return "WARNING";
+        case LogLevel::Error:   return "ERROR";
+        case LogLevel::Off:     break;
+    }
+    return "OFF";
+}
+
+//-----------------------------------------------------------------------------
+// Private Methods
+//-----------------------------------------------------------------------------
+
+void Logger::drain()
+{
+    {
+        std::lock_guard< std::mutex > lock( m_BuffersMutex );
+        for ( auto const& buffer : m_Buffers )
+            buffer->PopAll( m_Pending );
+    }
+
+    const uint64_t dropped = m_Dropped.load( std::memory_order_relaxed );
+    if ( m_Pending.empty() && dropped == m_ReportedDropped )
+        return;
+
+    // each ring is in order already; merging restores the order across threads
+    std::sort( m_Pending.begin(), m_Pending.end(), []( LogRecord const& a, LogRecord const& b )
+    {
+        return a.m_Sequence < b.m_Sequence;
+    } );
+
+    std::ostream& sink = m_Sink ? *m_Sink : std::cerr;
+    char prefix[ 64 ];
+    for ( LogRecord const& record : m_Pending )
+    {
+        std::snprintf( prefix, sizeof( prefix ), "[%12.6f] [%s] [thread %u] ",
+                       static_cast< double >( record.m_Time ) * 1e-9,
+                       GetLevelName( record.m_Level ), record.m_Thread );
+        sink << prefix;
+        sink.write( record.m_Text, record.m_Length );
+        sink << '\n';
+    }
+    if ( dropped != m_ReportedDropped )
+    {
+        sink << "[WARNING] dropped " << dropped - m_ReportedDropped << " log records from full buffers\n";
+        m_ReportedDropped = dropped;
+    }
+    sink.flush();
+    m_Pending.clear();
+}
+
+void Logger::sinkLoop()
+{
+    std::unique_lock< std::mutex > lock( m_WakeMutex );
+    while ( !m_Stopping )
+    {
+        m_Wake.wait_for( lock, kSinkInterval );
+
+        lock.unlock();
+        Flush();
+        lock.lock();
+    }
+}
+
+void Logger::stop()
+{
+    {
+        std::lock_guard< std::mutex > lock( m_WakeMutex );
+        m_Stopping = true;
+    }
+    m_Wake.notify_one();
+    if ( m_SinkThread.joinable() )
+        m_SinkThread.join();
+
+    m_Stopped.store( true, std::memory_order_release );
+    Flush();
+}
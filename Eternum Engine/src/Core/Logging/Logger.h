@@ -0,0 +1,235 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: Logger
+* Description:
+*     Asynchronous, leveled logging. Each thread formats its messages into fixed-size
+*     records in its own lock-free ring; a background sink thread merges the rings in
+*     order and writes them to stderr or a file, so logging never blocks a frame or
+*     interleaves with console rendering. Messages below ETERNUM_LOG_LEVEL are compiled
+*     out entirely, arguments included.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+/// @brief  severity of a log message, from least to most severe
+enum class LogLevel : uint8_t
+{
+    Trace,
+    Debug,
+    Info,
+    Warning,
+    Error,
+    Off
+};
+
+/// @brief  lowest level compiled into the build (0 = Trace ... 5 = Off)
+#ifndef ETERNUM_LOG_LEVEL
+    #ifdef NDEBUG
+        #define ETERNUM_LOG_LEVEL 2
+    #else
+        #define ETERNUM_LOG_LEVEL 1
+    #endif
+#endif
+
+/// @brief  one formatted message, copied by value through a thread's ring
+struct LogRecord
+{
+    /// @brief  longest message kept; longer ones are truncated
+    static constexpr std::size_t kMaxMessageLength = 224;
+
+    /// @brief  global order the record was written in
+    uint64_t m_Sequence;
+
+    /// @brief  nanoseconds since the Logger started
+    int64_t m_Time;
+
+    /// @brief  index of the writing thread, in order of first use
+    uint32_t m_Thread;
+
+    uint16_t m_Length;
+    LogLevel m_Level;
+    char m_Text[ kMaxMessageLength ];
+};
+
+class LogBuffer;
+
+class Logger
+{
+public:
+    /// @brief  gets the global Logger, starting its sink thread on first use
+    /// @note   intentionally never destroyed since anything may log during static
+    ///         destruction; the sink is stopped and drained at exit instead
+    static Logger& Instance()
+    {
+        static Logger* instance = new Logger();
+        return *instance;
+    }
+
+//-----------------------------------------------------------------------------
+// Writing
+//-----------------------------------------------------------------------------
+
+    /// @brief  formats a message and queues it for the sink without blocking
+    /// @param  level   the severity of the message
+    /// @param  args    values streamed one after another to form the message
+    /// @note   prefer the ETERNUM_LOG_* macros, which compile out disabled levels
+    template < typename... Args >
+    void Write( LogLevel level, Args const&... args )
+    {
+        if ( level < m_Level.load( std::memory_order_relaxed ) )
+            return;
+
+        std::ostringstream& stream = threadStream();
+        ( stream << ... << args );
+        submit( level, stream.view() );
+    }
+
+    /// @brief  writes every queued record to the sink before returning
+    void Flush();
+
+//-----------------------------------------------------------------------------
+// Configuration
+//-----------------------------------------------------------------------------
+
+    /// @brief  sets the lowest level written at runtime; levels compiled out stay out
+    void SetLevel( LogLevel level ) { m_Level.store( level, std::memory_order_relaxed ); }
+
+    /// @brief  gets the lowest level written at runtime
+    LogLevel GetLevel() const { return m_Level.load( std::memory_order_relaxed ); }
+
+    /// @brief  sends records to a stream instead of stderr
+    /// @param  sink    the stream to write to, or nullptr for stderr; it must outlive its
+    ///                 use as the sink
+    void SetSink( std::ostream* sink );
+
+    /// @brief  sends records to a file, replacing any earlier sink
+    /// @param  path    the file to append to
+    /// @return whether the file could be opened; on failure the sink is unchanged
+    bool OpenFile( std::string const& path );
+
+    /// @brief  gets the number of records dropped because a thread's ring was full
+    uint64_t GetDroppedCount() const { return m_Dropped.load( std::memory_order_relaxed ); }
+
+    /// @brief  gets the number of rings allocated; rings of finished threads are reused,
+    ///         so this follows the most threads logging at once, not every thread started
+    std::size_t GetRingCount();
+
+    /// @brief  gets the name of a level as written in the log
+    static char const* GetLevelName( LogLevel level );
+
+    // Prevent copy construction and assignment
+    Logger( Logger const& ) = delete;
+    Logger& operator=( Logger const& ) = delete;
+
+//-----------------------------------------------------------------------------
+// Private Methods
+//-----------------------------------------------------------------------------
+private:
+
+    Logger();
+
+    /// @brief  gets the calling thread's reusable formatting stream, emptied
+    static std::ostringstream& threadStream();
+
+    /// @brief  gets the calling thread's ring, taking one on first use and handing it back
+    ///         when the thread exits
+    LogBuffer& threadBuffer();
+
+    /// @brief  takes a retired ring, or allocates one if none is free
+    LogBuffer* acquireBuffer();
+
+    /// @brief  makes a ring available to the next thread; records still queued in it are
+    ///         drained as usual
+    void retireBuffer( LogBuffer* buffer );
+
+    /// @brief  copies a formatted message into the calling thread's ring
+    void submit( LogLevel level, std::string_view text );
+
+    /// @brief  moves every queued record to the sink in order (drain lock must be held)
+    void drain();
+
+    /// @brief  main loop of the sink thread
+    void sinkLoop();
+
+    /// @brief  stops the sink thread and writes whatever is left; run at exit
+    void stop();
+
+//-----------------------------------------------------------------------------
+// Private Members
+//-----------------------------------------------------------------------------
+
+    std::atomic< LogLevel > m_Level = LogLevel::Trace;
+
+    std::atomic< uint64_t > m_NextSequence = 0;
+    std::atomic< uint64_t > m_Dropped = 0;
+
+    /// @brief  dropped records already reported in the log (drain lock must be held)
+    uint64_t m_ReportedDropped = 0;
+
+    /// @brief  every ring allocated, in use or retired; never freed
+    std::vector< std::unique_ptr< LogBuffer > > m_Buffers;
+
+    /// @brief  rings whose threads have exited, waiting for a new thread
+    std::vector< LogBuffer* > m_FreeBuffers;
+
+    /// @brief  number given to the next thread that logs
+    uint32_t m_NextThread = 0;
+    std::mutex m_BuffersMutex;
+
+    /// @brief  held while records are taken out of the rings and written
+    std::mutex m_DrainMutex;
+    std::ostream* m_Sink = nullptr;
+    std::ofstream m_File;
+
+    /// @brief  records taken out of the rings, reused between drains
+    std::vector< LogRecord > m_Pending;
+
+    std::chrono::steady_clock::time_point m_Start;
+
+    std::thread m_SinkThread;
+    std::condition_variable m_Wake;
+    std::mutex m_WakeMutex;
+    bool m_Stopping = false;
+
+    /// @brief  set once the sink thread is gone; writers then drain themselves
+    std::atomic< bool > m_Stopped = false;
+};
+
+/// @brief  gets the global Logger
+inline Logger* Log()
+{
+    return &Logger::Instance();
+}
+
+/// @brief  writes a message at a level unless the level is compiled out
+#define ETERNUM_LOG( level, ... )                                                   \
+    do {                                                                            \
+        if constexpr ( static_cast< int >( level ) >= ETERNUM_LOG_LEVEL )          \
+            Log()->Write( level, __VA_ARGS__ );                                     \
+    } while ( false )
+
+#define ETERNUM_LOG_TRACE( ... )    ETERNUM_LOG( LogLevel::Trace, __VA_ARGS__ )
+#define ETERNUM_LOG_DEBUG( ... )    ETERNUM_LOG( LogLevel::Debug, __VA_ARGS__ )
+#define ETERNUM_LOG_INFO( ... )     ETERNUM_LOG( LogLevel::Info, __VA_ARGS__ )
+#define ETERNUM_LOG_WARNING( ... )  ETERNUM_LOG( LogLevel::Warning, __VA_ARGS__ )
+#define ETERNUM_LOG_ERROR( ... )    ETERNUM_LOG( LogLevel::Error, __VA_ARGS__ )
+
+#endif //LOGGER_H
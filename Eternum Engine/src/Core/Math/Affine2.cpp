@@ -0,0 +1,94 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: Affine2
+* Description:
+*     Implements 2D affine construction and the SIMD batch composition kernel.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+
+#include <pch.h>
+#include "Affine2.h"
+#include <Core/Math/Simd.h>
+
+namespace {
+
+constexpr float kDegreesToRadians = 3.14159265358979323846f / 180.0f;
+
+/// @brief  composes a single element of the batch
+void composeScalar( Affine2SoA const& p, Affine2SoA const& l, Affine2SoA& out, std::size_t i )
+{
+    const float a = p.m_A[ i ], b = p.m_B[ i ], c = p.m_C[ i ], d = p.m_D[ i ];
+    out.m_A[ i ]  = a * l.m_A[ i ]  + c * l.m_B[ i ];
+    out.m_B[ i ]  = b * l.m_A[ i ]  + d * l.m_B[ i ];
+    out.m_C[ i ]  = a * l.m_C[ i ]  + c * l.m_D[ i ];
+    out.m_D[ i ]  = b * l.m_C[ i ]  + d * l.m_D[ i ];
+    out.m_Tx[ i ] = a * l.m_Tx[ i ] + c * l.m_Ty[ i ] + p.m_Tx[ i ];
+    out.m_Ty[ i ] = b * l.m_Tx[ i ] + d * l.m_Ty[ i ] + p.m_Ty[ i ];
+}
+
+} // namespace
+
+Affine2f Affine2f::FromTRS( Vec2f const& translation, float rotation, Vec2f const& scale )
+{
+    const float radians = rotation * kDegreesToRadians;
+    const float cosine = std::cos( radians );
+    const float sine = std::sin( radians );
+
+    return {
+        cosine * scale.x(),
+        sine * scale.x(),
+        -sine * scale.y(),
+        cosine * scale.y(),
+        translation.x(),
+        translation.y()
+    };
+}
+
+void Affine2SoA::Resize( std::size_t count )
+{
+    m_A.resize( count );
+    m_B.resize( count );
+    m_C.resize( count );
+    m_D.resize( count );
+    m_Tx.resize( count );
+    m_Ty.resize( count );
+}
+
+void ComposeAffine2Batch( Affine2SoA const& parents, Affine2SoA const& locals, Affine2SoA& out,
+                          std::size_t begin, std::size_t end )
+{
+    std::size_t i = begin;
+
+#if ETERNUM_SIMD_SSE
+    for ( ; i + 4 <= end; i += 4 )
+    {
+        const __m128 a = _mm_loadu_ps( &parents.m_A[ i ] );
+        const __m128 b = _mm_loadu_ps( &parents.m_B[ i ] );
+        const __m128 c = _mm_loadu_ps( &parents.m_C[ i ] );
+        const __m128 d = _mm_loadu_ps( &parents.m_D[ i ] );
+
+        const __m128 la = _mm_loadu_ps( &locals.m_A[ i ] );
+        const __m128 lb = _mm_loadu_ps( &locals.m_B[ i ] );
+        const __m128 lc = _mm_loadu_ps( &locals.m_C[ i ] );
+        const __m128 ld = _mm_loadu_ps( &locals.m_D[ i ] );
+        const __m128 ltx = _mm_loadu_ps( &locals.m_Tx[ i ] );
+        const __m128 lty = _mm_loadu_ps( &locals.m_Ty[ i ] );
+
+        _mm_storeu_ps( &out.m_A[ i ], _mm_add_ps( _mm_mul_ps( a, la ), _mm_mul_ps( c, lb ) ) );
+        _mm_storeu_ps( &out.m_B[ i ], _mm_add_ps( _mm_mul_ps( b, la ), _mm_mul_ps( d, lb ) ) );
+        _mm_storeu_ps( &out.m_C[ i ], _mm_add_ps( _mm_mul_ps( a, lc ), _mm_mul_ps( c, ld ) ) );
+        _mm_storeu_ps( &out.m_D[ i ], _mm_add_ps( _mm_mul_ps( b, lc ), _mm_mul_ps( d, ld ) ) );
+        _mm_storeu_ps( &out.m_Tx[ i ], _mm_add_ps( _mm_add_ps( _mm_mul_ps( a, ltx ), _mm_mul_ps( c, lty ) ),
+                                                   _mm_loadu_ps( &parents.m_Tx[ i ] ) ) );
+        _mm_storeu_ps( &out.m_Ty[ i ], _mm_add_ps( _mm_add_ps( _mm_mul_ps( b, ltx ), _mm_mul_ps( d, lty ) ),
+                                                   _mm_loadu_ps( &parents.m_Ty[ i ] ) ) );
+    }
+#endif
+
+    for ( ; i < end; ++i )
+        composeScalar( parents, locals, out, i );
+}
@@ -0,0 +1,126 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: Affine2
+* Description:
+*     2D affine transforms (a 2x2 linear part plus a translation), along with a
+*     structure-of-arrays batch used to compose many of them at once with SIMD.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef AFFINE2_H
+#define AFFINE2_H
+
+#include <pch.h>
+
+/// @brief  2D affine transform, mapping (x, y) to ( a*x + c*y + tx, b*x + d*y + ty )
+struct Affine2f
+{
+    float m_A = 1.0f;
+    float m_B = 0.0f;
+    float m_C = 0.0f;
+    float m_D = 1.0f;
+    float m_Tx = 0.0f;
+    float m_Ty = 0.0f;
+
+    /// @brief  gets the identity transform
+    static Affine2f Identity() { return {}; }
+
+    /// @brief  builds a transform that scales, then rotates, then translates
+    /// @param  translation the translation
+    /// @param  rotation    the rotation in degrees, counter-clockwise
+    /// @param  scale       the scale along each axis
+    static Affine2f FromTRS( Vec2f const& translation, float rotation, Vec2f const& scale );
+
+    /// @brief  composes two transforms; the result applies rhs first, then this
+    Affine2f operator *( Affine2f const& rhs ) const
+    {
+        return {
+            m_A * rhs.m_A  + m_C * rhs.m_B,
+            m_B * rhs.m_A  + m_D * rhs.m_B,
+            m_A * rhs.m_C  + m_C * rhs.m_D,
+            m_B * rhs.m_C  + m_D * rhs.m_D,
+            m_A * rhs.m_Tx + m_C * rhs.m_Ty + m_Tx,
+            m_B * rhs.m_Tx + m_D * rhs.m_Ty + m_Ty
+        };
+    }
+
+    /// @brief  transforms a point
+    Vec2f TransformPoint( Vec2f const& point ) const
+    {
+        return { m_A * point.x() + m_C * point.y() + m_Tx,
+                 m_B * point.x() + m_D * point.y() + m_Ty };
+    }
+
+    /// @brief  transforms a direction, ignoring the translation
+    Vec2f TransformVector( Vec2f const& vector ) const
+    {
+        return { m_A * vector.x() + m_C * vector.y(),
+                 m_B * vector.x() + m_D * vector.y() };
+    }
+
+    /// @brief  gets the translation of this transform
+    Vec2f GetTranslation() const { return { m_Tx, m_Ty }; }
+
+    /// @brief  gets the determinant of the linear part
+    float Determinant() const { return m_A * m_D - m_B * m_C; }
+
+    /// @brief  gets the transform that undoes this one
+    /// @note   the transform must be invertible; a zero scale gives non-finite elements
+    Affine2f Inverse() const
+    {
+        const float inverseDeterminant = 1.0f / Determinant();
+        const float a =  m_D * inverseDeterminant;
+        const float b = -m_B * inverseDeterminant;
+        const float c = -m_C * inverseDeterminant;
+        const float d =  m_A * inverseDeterminant;
+        return { a, b, c, d, -( a * m_Tx + c * m_Ty ), -( b * m_Tx + d * m_Ty ) };
+    }
+
+    /// @brief  compares every element within a tolerance
+    bool AlmostEqual( Affine2f const& other, float eps = 1e-5f ) const
+    {
+        return std::fabs( m_A - other.m_A ) <= eps && std::fabs( m_B - other.m_B ) <= eps &&
+               std::fabs( m_C - other.m_C ) <= eps && std::fabs( m_D - other.m_D ) <= eps &&
+               std::fabs( m_Tx - other.m_Tx ) <= eps && std::fabs( m_Ty - other.m_Ty ) <= eps;
+    }
+};
+
+/// @brief  many Affine2f stored one array per element, so batches map onto SIMD lanes
+struct Affine2SoA
+{
+    std::vector< float > m_A, m_B, m_C, m_D, m_Tx, m_Ty;
+
+    /// @brief  resizes every element array
+    void Resize( std::size_t count );
+
+    /// @brief  gets the number of transforms
+    std::size_t Size() const { return m_A.size(); }
+
+    /// @brief  writes one transform
+    void Set( std::size_t i, Affine2f const& transform )
+    {
+        m_A[ i ] = transform.m_A;   m_B[ i ] = transform.m_B;
+        m_C[ i ] = transform.m_C;   m_D[ i ] = transform.m_D;
+        m_Tx[ i ] = transform.m_Tx; m_Ty[ i ] = transform.m_Ty;
+    }
+
+    /// @brief  reads one transform
+    Affine2f Get( std::size_t i ) const
+    {
+        return { m_A[ i ], m_B[ i ], m_C[ i ], m_D[ i ], m_Tx[ i ], m_Ty[ i ] };
+    }
+};
+
+/// @brief  computes out[ i ] = parents[ i ] * locals[ i ] for every i in [begin, end)
+/// @param  parents the left-hand transforms
+/// @param  locals  the right-hand transforms
+/// @param  out     receives the products; must not alias the inputs
+/// @param  begin   first index to compose
+/// @param  end     one past the last index to compose
+void ComposeAffine2Batch( Affine2SoA const& parents, Affine2SoA const& locals, Affine2SoA& out,
+                          std::size_t begin, std::size_t end );
+
+#endif //AFFINE2_H
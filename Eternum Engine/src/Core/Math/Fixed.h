@@ -0,0 +1,261 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: Fixed
+* Description:
+*     Fixed-point scalars for lockstep simulation. Fixed<Q> keeps a 32-bit integer with Q
+*     fractional bits, and every operation is integer-only with saturation on overflow,
+*     so the same inputs give bit-identical results on every compiler, flag set and
+*     machine. Vector<Fixed<Q>, N> picks up integer kernels from this header: Dot
+*     accumulates in 64 bits and Length is an integer square root.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef FIXED_H
+#define FIXED_H
+
+#include <pch.h>
+#include <bit>
+#include <compare>
+#include <limits>
+
+namespace FixedDetail {
+
+constexpr int64_t kRawMax = ( std::numeric_limits< int32_t >::max )();
+constexpr int64_t kRawMin = ( std::numeric_limits< int32_t >::min )();
+
+/// @brief  clamps a wide intermediate into the 32-bit raw range
+constexpr int32_t Saturate( int64_t value )
+{
+    return static_cast< int32_t >( value > kRawMax ? kRawMax : value < kRawMin ? kRawMin : value );
+}
+
+/// @brief  a + b, clamped to the 64-bit range
+constexpr int64_t SaturatingAdd( int64_t a, int64_t b )
+{
+    constexpr int64_t max = ( std::numeric_limits< int64_t >::max )();
+    constexpr int64_t min = ( std::numeric_limits< int64_t >::min )();
+    if ( b > 0 && a > max - b ) return max;
+    if ( b < 0 && a < min - b ) return min;
+    return a + b;
+}
+
+/// @brief  shifts right by Q, rounding half up; arithmetic on negatives as of C++20
+template < int Q >
+constexpr int64_t RoundShift( int64_t value )
+{
+    constexpr int64_t half = int64_t( 1 ) << ( Q - 1 );
+    return value > ( std::numeric_limits< int64_t >::max )() - half ? value >> Q : ( value + half ) >> Q;
+}
+
+/// @brief  floor( sqrt( n ) ), digit by digit from the highest set bit pair
+constexpr uint64_t ISqrt( uint64_t n )
+{
+    if ( n == 0 )
+        return 0;
+
+    uint64_t result = 0;
+    uint64_t bit = uint64_t( 1 ) << ( ( std::bit_width( n ) - 1 ) & ~1 );
+    while ( bit != 0 )
+    {
+        if ( n >= result + bit )
+        {
+            n -= result + bit;
+            result = ( result >> 1 ) + bit;
+        }
+        else
+        {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return result;
+}
+
+} // namespace FixedDetail
+
+/// @brief  signed Q-format fixed-point number: value = raw / 2^Q
+/// @tparam Q   number of fractional bits; Fixed<16> covers about +-32768 in steps of
+///             1/65536
+/// @note   results that do not fit saturate to Max() or Min() rather than wrapping,
+///         and division by zero saturates towards the sign of the dividend
+template < int Q >
+class Fixed
+{
+    static_assert( Q > 0 && Q < 31, "Fixed<Q>: Q must be in [1, 30]" );
+
+public:
+    static constexpr int kFractionBits = Q;
+
+    /// @brief  constructs zero
+    constexpr Fixed() = default;
+
+    /// @brief  converts an integer, saturating when it is out of range
+    template < std::integral I >
+    constexpr explicit Fixed( I value ) :
+        m_Raw( FixedDetail::Saturate( clampToInt64( value ) * ( int64_t( 1 ) << Q ) ) )
+    {}
+
+    /// @brief  converts a floating-point value to the nearest step, saturating when it is
+    ///         out of range; meant for constants and loading data, not for simulation
+    template < std::floating_point F >
+    constexpr explicit Fixed( F value ) : m_Raw( fromFloating( static_cast< double >( value ) ) ) {}
+
+    /// @brief  wraps a raw value
+    static constexpr Fixed FromRaw( int32_t raw ) { Fixed out; out.m_Raw = raw; return out; }
+
+    static constexpr Fixed Max() { return FromRaw( static_cast< int32_t >( FixedDetail::kRawMax ) ); }
+    static constexpr Fixed Min() { return FromRaw( static_cast< int32_t >( FixedDetail::kRawMin ) ); }
+
+    /// @brief  gets the smallest positive value
+    static constexpr Fixed Epsilon() { return FromRaw( 1 ); }
+
+//-----------------------------------------------------------------------------
+// Conversions
+//-----------------------------------------------------------------------------
+
+    constexpr int32_t GetRaw() const { return m_Raw; }
+
+    /// @brief  rounds towards negative infinity
+    constexpr int32_t ToInt() const { return m_Raw >> Q; }
+
+    /// @brief  converts for rendering and logging; never feed the result back into the
+    ///         simulation
+    constexpr float ToFloat() const { return static_cast< float >( ToDouble() ); }
+    constexpr double ToDouble() const { return static_cast< double >( m_Raw ) / static_cast< double >( int64_t( 1 ) << Q ); }
+
+//-----------------------------------------------------------------------------
+// Arithmetic
+//-----------------------------------------------------------------------------
+
+    constexpr Fixed& operator+=( Fixed rhs ) { m_Raw = FixedDetail::Saturate( int64_t( m_Raw ) + rhs.m_Raw ); return *this; }
+    constexpr Fixed& operator-=( Fixed rhs ) { m_Raw = FixedDetail::Saturate( int64_t( m_Raw ) - rhs.m_Raw ); return *this; }
+
+    /// @brief  multiplies, rounding the product half up to the nearest step
+    constexpr Fixed& operator*=( Fixed rhs )
+    {
+        m_Raw = FixedDetail::Saturate( FixedDetail::RoundShift< Q >( int64_t( m_Raw ) * rhs.m_Raw ) );
+        return *this;
+    }
+
+    /// @brief  divides, truncating the quotient towards zero
+    constexpr Fixed& operator/=( Fixed rhs )
+    {
+        if ( rhs.m_Raw == 0 )
+            *this = m_Raw < 0 ? Min() : Max();
+        else
+            m_Raw = FixedDetail::Saturate( ( int64_t( m_Raw ) * ( int64_t( 1 ) << Q ) ) / rhs.m_Raw );
+        return *this;
+    }
+
+    constexpr Fixed operator+() const { return *this; }
+    constexpr Fixed operator-() const { return FromRaw( FixedDetail::Saturate( -int64_t( m_Raw ) ) ); }
+
+    friend constexpr Fixed operator+( Fixed lhs, Fixed rhs ) { return lhs += rhs; }
+    friend constexpr Fixed operator-( Fixed lhs, Fixed rhs ) { return lhs -= rhs; }
+    friend constexpr Fixed operator*( Fixed lhs, Fixed rhs ) { return lhs *= rhs; }
+    friend constexpr Fixed operator/( Fixed lhs, Fixed rhs ) { return lhs /= rhs; }
+
+    friend constexpr bool operator==( Fixed lhs, Fixed rhs ) = default;
+    friend constexpr std::strong_ordering operator<=>( Fixed lhs, Fixed rhs ) = default;
+
+//-----------------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------------
+
+    /// @brief  gets the absolute value, saturating Min() to Max()
+    friend constexpr Fixed Abs( Fixed value ) { return value.m_Raw < 0 ? -value : value; }
+
+    /// @brief  gets the square root, rounded down to a step; negative values give zero
+    friend constexpr Fixed Sqrt( Fixed value )
+    {
+        if ( value.m_Raw <= 0 )
+            return {};
+        // sqrt( raw / 2^Q ) * 2^Q = sqrt( raw * 2^Q )
+        return FromRaw( static_cast< int32_t >( FixedDetail::ISqrt( uint64_t( value.m_Raw ) << Q ) ) );
+    }
+
+    friend std::ostream& operator<<( std::ostream& os, Fixed value ) { return os << value.ToDouble(); }
+
+private:
+    template < std::integral I >
+    static constexpr int64_t clampToInt64( I value )
+    {
+        // anything past 2^32 saturates anyway, so only the clamp into int64 matters
+        if constexpr ( std::is_unsigned_v< I > )
+            return value > uint64_t( FixedDetail::kRawMax ) ? FixedDetail::kRawMax + 1 : static_cast< int64_t >( value );
+        else
+            return value > FixedDetail::kRawMax ? FixedDetail::kRawMax + 1
+                 : value < FixedDetail::kRawMin ? FixedDetail::kRawMin - 1 : static_cast< int64_t >( value );
+    }
+
+    static constexpr int32_t fromFloating( double value )
+    {
+        const double scaled = value * static_cast< double >( int64_t( 1 ) << Q );
+        if ( !( scaled == scaled ) )
+            return 0;
+        if ( scaled >= static_cast< double >( FixedDetail::kRawMax ) )
+            return static_cast< int32_t >( FixedDetail::kRawMax );
+        if ( scaled <= static_cast< double >( FixedDetail::kRawMin ) )
+            return static_cast< int32_t >( FixedDetail::kRawMin );
+        return static_cast< int32_t >( scaled < 0.0 ? scaled - 0.5 : scaled + 0.5 );
+    }
+
+    int32_t m_Raw = 0;
+};
+
+using Fixed16 = Fixed< 16 >;
+
+//-----------------------------------------------------------------------------
+// Vector Kernels
+//-----------------------------------------------------------------------------
+
+/// @brief  integer loops for fixed-point Vectors; Dot and Length accumulate the raw
+///         products in 64 bits, so only the final result rounds or saturates
+template < int Q, std::size_t N >
+struct ScalarVectorKernel< Fixed< Q >, N >
+{
+    using T = Fixed< Q >;
+
+    static constexpr std::size_t kAlignment = alignof( T );
+
+    static constexpr void Add( T* a, T const* b )      { for ( std::size_t i = 0; i < N; ++i ) a[ i ] += b[ i ]; }
+    static constexpr void Subtract( T* a, T const* b ) { for ( std::size_t i = 0; i < N; ++i ) a[ i ] -= b[ i ]; }
+    static constexpr void Multiply( T* a, T s )        { for ( std::size_t i = 0; i < N; ++i ) a[ i ] *= s; }
+    static constexpr void Divide( T* a, T s )          { for ( std::size_t i = 0; i < N; ++i ) a[ i ] /= s; }
+
+    static constexpr T Dot( T const* a, T const* b )
+    {
+        int64_t acc = 0;
+        for ( std::size_t i = 0; i < N; ++i )
+            acc = FixedDetail::SaturatingAdd( acc, int64_t( a[ i ].GetRaw() ) * b[ i ].GetRaw() );
+        return T::FromRaw( FixedDetail::Saturate( FixedDetail::RoundShift< Q >( acc ) ) );
+    }
+
+    /// @brief  sqrt of the exact sum of squares, so a Vector is measurable even when its
+    ///         LengthSq would saturate
+    static constexpr T Length( T const* a )
+    {
+        // the squares carry 2Q fractional bits, so their root carries Q
+        constexpr uint64_t max = ( std::numeric_limits< uint64_t >::max )();
+        uint64_t acc = 0;
+        for ( std::size_t i = 0; i < N; ++i )
+        {
+            const int64_t raw = a[ i ].GetRaw();
+            const uint64_t square = static_cast< uint64_t >( raw * raw );
+            acc = acc > max - square ? max : acc + square;
+        }
+        return T::FromRaw( FixedDetail::Saturate( static_cast< int64_t >( FixedDetail::ISqrt( acc ) ) ) );
+    }
+};
+
+// -----------------------------------------------------------------------------
+// Common Aliases
+// -----------------------------------------------------------------------------
+using Vec2q = Vector< Fixed16, 2 >;
+using Vec3q = Vector< Fixed16, 3 >;
+using Vec4q = Vector< Fixed16, 4 >;
+
+#endif //FIXED_H
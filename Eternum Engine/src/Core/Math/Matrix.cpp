@@ -0,0 +1,506 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: Matrix
+* Description:
+*     Implements the 3x3 and 4x4 matrices, with SSE paths for multiplication, inversion
+*     and point transformation and scalar paths for builds without SSE.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+
+#include <pch.h>
+#include "Matrix.h"
+#include <Core/Math/Simd.h>
+
+namespace {
+
+constexpr float kDegreesToRadians = 3.14159265358979323846f / 180.0f;
+
+#if ETERNUM_SIMD_SSE
+
+__m128 load( Vec4f const& v ) { return _mm_load_ps( &v[ 0 ] ); }
+void store( Vec4f& v, __m128 value ) { _mm_store_ps( &v[ 0 ], value ); }
+
+/// @brief  picks lanes X, Y, Z, W of v
+template < int X, int Y, int Z, int W >
+__m128 swizzle( __m128 v ) { return _mm_shuffle_ps( v, v, _MM_SHUFFLE( W, Z, Y, X ) ); }
+
+/// @brief  picks lanes X, Y of a and Z, W of b
+template < int X, int Y, int Z, int W >
+__m128 shuffle( __m128 a, __m128 b ) { return _mm_shuffle_ps( a, b, _MM_SHUFFLE( W, Z, Y, X ) ); }
+
+/// @brief  sums all four lanes into every lane
+__m128 sumAcross( __m128 v )
+{
+    const __m128 pairs = _mm_add_ps( v, swizzle< 2, 3, 0, 1 >( v ) );
+    return _mm_add_ps( pairs, swizzle< 1, 0, 3, 2 >( pairs ) );
+}
+
+/// @brief  columns[ 0 ] * v.x + columns[ 1 ] * v.y + ... over the first count columns
+template < std::size_t Count >
+__m128 combine( Vec4f const* columns, __m128 v )
+{
+    __m128 sum = _mm_mul_ps( load( columns[ 0 ] ), swizzle< 0, 0, 0, 0 >( v ) );
+    sum = _mm_add_ps( sum, _mm_mul_ps( load( columns[ 1 ] ), swizzle< 1, 1, 1, 1 >( v ) ) );
+    sum = _mm_add_ps( sum, _mm_mul_ps( load( columns[ 2 ] ), swizzle< 2, 2, 2, 2 >( v ) ) );
+    if constexpr ( Count == 4 )
+        sum = _mm_add_ps( sum, _mm_mul_ps( load( columns[ 3 ] ), swizzle< 3, 3, 3, 3 >( v ) ) );
+    return sum;
+}
+
+/// @brief  cross product of the xyz lanes; w comes out as zero
+__m128 cross( __m128 a, __m128 b )
+{
+    return _mm_sub_ps( _mm_mul_ps( swizzle< 1, 2, 0, 3 >( a ), swizzle< 2, 0, 1, 3 >( b ) ),
+                       _mm_mul_ps( swizzle< 2, 0, 1, 3 >( a ), swizzle< 1, 2, 0, 3 >( b ) ) );
+}
+
+// 2x2 blocks of a 4x4 matrix, packed as ( m00, m01, m10, m11 )
+
+/// @brief  a * b
+__m128 multiply2x2( __m128 a, __m128 b )
+{
+    return _mm_add_ps( _mm_mul_ps( a, swizzle< 0, 3, 0, 3 >( b ) ),
+                       _mm_mul_ps( swizzle< 1, 0, 3, 2 >( a ), swizzle< 2, 1, 2, 1 >( b ) ) );
+}
+
+/// @brief  adjugate( a ) * b
+__m128 adjugateMultiply2x2( __m128 a, __m128 b )
+{
+    return _mm_sub_ps( _mm_mul_ps( swizzle< 3, 3, 0, 0 >( a ), b ),
+                       _mm_mul_ps( swizzle< 1, 1, 2, 2 >( a ), swizzle< 2, 3, 0, 1 >( b ) ) );
+}
+
+/// @brief  a * adjugate( b )
+__m128 multiplyAdjugate2x2( __m128 a, __m128 b )
+{
+    return _mm_sub_ps( _mm_mul_ps( a, swizzle< 3, 0, 3, 0 >( b ) ),
+                       _mm_mul_ps( swizzle< 1, 0, 3, 2 >( a ), swizzle< 2, 1, 2, 1 >( b ) ) );
+}
+
+#endif // ETERNUM_SIMD_SSE
+
+Vec4f column( float x, float y, float z, float w )
+{
+    Vec4f v;
+    v[ 0 ] = x; v[ 1 ] = y; v[ 2 ] = z; v[ 3 ] = w;
+    return v;
+}
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+// Mat3f
+//-----------------------------------------------------------------------------
+
+Mat3f::Mat3f( Vec3f const& column0, Vec3f const& column1, Vec3f const& column2 ) :
+    m_Columns{ column( column0[ 0 ], column0[ 1 ], column0[ 2 ], 0.0f ),
+               column( column1[ 0 ], column1[ 1 ], column1[ 2 ], 0.0f ),
+               column( column2[ 0 ], column2[ 1 ], column2[ 2 ], 0.0f ) }
+{}
+
+Mat3f Mat3f::FromTRS( Vec2f const& translation, float rotation, Vec2f const& scale )
+{
+    return FromAffine( Affine2f::FromTRS( translation, rotation, scale ) );
+}
+
+Mat3f Mat3f::FromAffine( Affine2f const& transform )
+{
+    return { { transform.m_A, transform.m_B, 0.0f },
+             { transform.m_C, transform.m_D, 0.0f },
+             { transform.m_Tx, transform.m_Ty, 1.0f } };
+}
+
+Affine2f Mat3f::ToAffine() const
+{
+    return { ( *this )( 0, 0 ), ( *this )( 1, 0 ), ( *this )( 0, 1 ), ( *this )( 1, 1 ), ( *this )( 0, 2 ), ( *this )( 1, 2 ) };
+}
+
+Mat3f Mat3f::operator *( Mat3f const& rhs ) const
+{
+    Mat3f out;
+    for ( std::size_t j = 0; j < 3; ++j )
+    {
+#if ETERNUM_SIMD_SSE
+        store( out.m_Columns[ j ], combine< 3 >( m_Columns, load( rhs.m_Columns[ j ] ) ) );
+#else
+        out.m_Columns[ j ] = m_Columns[ 0 ] * rhs( 0, j ) + m_Columns[ 1 ] * rhs( 1, j ) + m_Columns[ 2 ] * rhs( 2, j );
+#endif
+    }
+    return out;
+}
+
+Vec3f Mat3f::operator *( Vec3f const& v ) const
+{
+    Vec4f result;
+#if ETERNUM_SIMD_SSE
+    store( result, combine< 3 >( m_Columns, load( column( v[ 0 ], v[ 1 ], v[ 2 ], 0.0f ) ) ) );
+#else
+    result = m_Columns[ 0 ] * v[ 0 ] + m_Columns[ 1 ] * v[ 1 ] + m_Columns[ 2 ] * v[ 2 ];
+#endif
+    return Vec3f( result.begin() );
+}
+
+Vec2f Mat3f::TransformPoint( Vec2f const& point ) const
+{
+    const Vec3f result = *this * Vec3f{ point[ 0 ], point[ 1 ], 1.0f };
+    return { result[ 0 ], result[ 1 ] };
+}
+
+Vec2f Mat3f::TransformVector( Vec2f const& vector ) const
+{
+    const Vec3f result = *this * Vec3f{ vector[ 0 ], vector[ 1 ], 0.0f };
+    return { result[ 0 ], result[ 1 ] };
+}
+
+Mat3f Mat3f::Transposed() const
+{
+    Mat3f out;
+    for ( std::size_t row = 0; row < 3; ++row )
+        for ( std::size_t col = 0; col < 3; ++col )
+            out( row, col ) = ( *this )( col, row );
+    return out;
+}
+
+float Mat3f::Determinant() const
+{
+    Mat3f const& m = *this;
+    return m( 0, 0 ) * ( m( 1, 1 ) * m( 2, 2 ) - m( 2, 1 ) * m( 1, 2 ) )
+         - m( 0, 1 ) * ( m( 1, 0 ) * m( 2, 2 ) - m( 2, 0 ) * m( 1, 2 ) )
+         + m( 0, 2 ) * ( m( 1, 0 ) * m( 2, 1 ) - m( 2, 0 ) * m( 1, 1 ) );
+}
+
+Mat3f Mat3f::Inverse() const
+{
+    Mat3f out;
+
+#if ETERNUM_SIMD_SSE
+    // the rows of the inverse are the cross products of pairs of columns, over the
+    // determinant
+    const __m128 c0 = load( m_Columns[ 0 ] );
+    const __m128 c1 = load( m_Columns[ 1 ] );
+    const __m128 c2 = load( m_Columns[ 2 ] );
+
+    __m128 row0 = cross( c1, c2 );
+    __m128 row1 = cross( c2, c0 );
+    __m128 row2 = cross( c0, c1 );
+    __m128 row3 = _mm_setzero_ps();
+
+    const __m128 inverseDeterminant = _mm_div_ps( _mm_set1_ps( 1.0f ), sumAcross( _mm_mul_ps( c0, row0 ) ) );
+    row0 = _mm_mul_ps( row0, inverseDeterminant );
+    row1 = _mm_mul_ps( row1, inverseDeterminant );
+    row2 = _mm_mul_ps( row2, inverseDeterminant );
+
+    _MM_TRANSPOSE4_PS( row0, row1, row2, row3 );
+    store( out.m_Columns[ 0 ], row0 );
+    store( out.m_Columns[ 1 ], row1 );
+    store( out.m_Columns[ 2 ], row2 );
+#else
+    Mat3f const& m = *this;
+    const float inverseDeterminant = 1.0f / Determinant();
+    for ( std::size_t row = 0; row < 3; ++row )
+    {
+        for ( std::size_t col = 0; col < 3; ++col )
+        {
+            // cofactor of ( col, row ), using the cyclic order of the other rows/columns
+            const std::size_t r0 = ( col + 1 ) % 3, r1 = ( col + 2 ) % 3;
+            const std::size_t c0 = ( row + 1 ) % 3, c1 = ( row + 2 ) % 3;
+            out( row, col ) = ( m( r0, c0 ) * m( r1, c1 ) - m( r0, c1 ) * m( r1, c0 ) ) * inverseDeterminant;
+        }
+    }
+#endif
+
+    return out;
+}
+
+bool Mat3f::AlmostEqual( Mat3f const& other, float eps ) const
+{
+    for ( std::size_t i = 0; i < 3; ++i )
+        if ( !m_Columns[ i ].AlmostEqual( other.m_Columns[ i ], eps ) )
+            return false;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Mat4f
+//-----------------------------------------------------------------------------
+
+Mat4f Mat4f::Translation( Vec3f const& translation )
+{
+    Mat4f out;
+    out.m_Columns[ 3 ] = column( translation[ 0 ], translation[ 1 ], translation[ 2 ], 1.0f );
+    return out;
+}
+
+Mat4f Mat4f::Scaling( Vec3f const& scale )
+{
+    return { column( scale[ 0 ], 0.0f, 0.0f, 0.0f ),
+             column( 0.0f, scale[ 1 ], 0.0f, 0.0f ),
+             column( 0.0f, 0.0f, scale[ 2 ], 0.0f ),
+             Vec4f::Unit( 3 ) };
+}
+
+Mat4f Mat4f::RotationX( float degrees )
+{
+    const float cosine = std::cos( degrees * kDegreesToRadians );
+    const float sine = std::sin( degrees * kDegreesToRadians );
+    return { Vec4f::Unit( 0 ),
+             column( 0.0f, cosine, sine, 0.0f ),
+             column( 0.0f, -sine, cosine, 0.0f ),
+             Vec4f::Unit( 3 ) };
+}
+
+Mat4f Mat4f::RotationY( float degrees )
+{
+    const float cosine = std::cos( degrees * kDegreesToRadians );
+    const float sine = std::sin( degrees * kDegreesToRadians );
+    return { column( cosine, 0.0f, -sine, 0.0f ),
+             Vec4f::Unit( 1 ),
+             column( sine, 0.0f, cosine, 0.0f ),
+             Vec4f::Unit( 3 ) };
+}
+
+Mat4f Mat4f::RotationZ( float degrees )
+{
+    const float cosine = std::cos( degrees * kDegreesToRadians );
+    const float sine = std::sin( degrees * kDegreesToRadians );
+    return { column( cosine, sine, 0.0f, 0.0f ),
+             column( -sine, cosine, 0.0f, 0.0f ),
+             Vec4f::Unit( 2 ),
+             Vec4f::Unit( 3 ) };
+}
+
+Mat4f Mat4f::FromTRS( Vec3f const& translation, Vec3f const& rotation, Vec3f const& scale )
+{
+    return Translation( translation ) * RotationZ( rotation[ 2 ] ) * RotationY( rotation[ 1 ] ) *
+           RotationX( rotation[ 0 ] ) * Scaling( scale );
+}
+
+Mat4f Mat4f::FromAffine( Affine2f const& transform )
+{
+    return { column( transform.m_A, transform.m_B, 0.0f, 0.0f ),
+             column( transform.m_C, transform.m_D, 0.0f, 0.0f ),
+             Vec4f::Unit( 2 ),
+             column( transform.m_Tx, transform.m_Ty, 0.0f, 1.0f ) };
+}
+
+Mat4f Mat4f::operator *( Mat4f const& rhs ) const
+{
+    Mat4f out;
+    for ( std::size_t j = 0; j < 4; ++j )
+        out.m_Columns[ j ] = *this * rhs.m_Columns[ j ];
+    return out;
+}
+
+Vec4f Mat4f::operator *( Vec4f const& v ) const
+{
+    Vec4f result;
+#if ETERNUM_SIMD_SSE
+    store( result, combine< 4 >( m_Columns, load( v ) ) );
+#else
+    result = m_Columns[ 0 ] * v[ 0 ] + m_Columns[ 1 ] * v[ 1 ] + m_Columns[ 2 ] * v[ 2 ] + m_Columns[ 3 ] * v[ 3 ];
+#endif
+    return result;
+}
+
+Vec3f Mat4f::TransformPoint( Vec3f const& point ) const
+{
+    const Vec4f result = *this * column( point[ 0 ], point[ 1 ], point[ 2 ], 1.0f );
+    return Vec3f( result.begin() );
+}
+
+Vec3f Mat4f::TransformVector( Vec3f const& vector ) const
+{
+    const Vec4f result = *this * column( vector[ 0 ], vector[ 1 ], vector[ 2 ], 0.0f );
+    return Vec3f( result.begin() );
+}
+
+Mat4f Mat4f::Transposed() const
+{
+    Mat4f out;
+    for ( std::size_t row = 0; row < 4; ++row )
+        for ( std::size_t col = 0; col < 4; ++col )
+            out( row, col ) = ( *this )( col, row );
+    return out;
+}
+
+float Mat4f::Determinant() const
+{
+    // Laplace expansion over the 2x2 minors of the top two and bottom two rows
+    Mat4f const& m = *this;
+    const float s0 = m( 0, 0 ) * m( 1, 1 ) - m( 1, 0 ) * m( 0, 1 );
+    const float s1 = m( 0, 0 ) * m( 1, 2 ) - m( 1, 0 ) * m( 0, 2 );
+    const float s2 = m( 0, 0 ) * m( 1, 3 ) - m( 1, 0 ) * m( 0, 3 );
+    const float s3 = m( 0, 1 ) * m( 1, 2 ) - m( 1, 1 ) * m( 0, 2 );
+    const float s4 = m( 0, 1 ) * m( 1, 3 ) - m( 1, 1 ) * m( 0, 3 );
+    const float s5 = m( 0, 2 ) * m( 1, 3 ) - m( 1, 2 ) * m( 0, 3 );
+
+    const float c5 = m( 2, 2 ) * m( 3, 3 ) - m( 3, 2 ) * m( 2, 3 );
+    const float c4 = m( 2, 1 ) * m( 3, 3 ) - m( 3, 1 ) * m( 2, 3 );
+    const float c3 = m( 2, 1 ) * m( 3, 2 ) - m( 3, 1 ) * m( 2, 2 );
+    const float c2 = m( 2, 0 ) * m( 3, 3 ) - m( 3, 0 ) * m( 2, 3 );
+    const float c1 = m( 2, 0 ) * m( 3, 2 ) - m( 3, 0 ) * m( 2, 2 );
+    const float c0 = m( 2, 0 ) * m( 3, 1 ) - m( 3, 0 ) * m( 2, 1 );
+
+    return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+}
+
+Mat4f Mat4f::Inverse() const
+{
+    Mat4f out;
+
+#if ETERNUM_SIMD_SSE
+    // blockwise inversion over the 2x2 blocks [ A B ; C D ]. It is written for rows, so
+    // feeding it columns inverts the transpose, whose inverse transposed back is stored
+    // column by column again
+    const __m128 r0 = load( m_Columns[ 0 ] );
+    const __m128 r1 = load( m_Columns[ 1 ] );
+    const __m128 r2 = load( m_Columns[ 2 ] );
+    const __m128 r3 = load( m_Columns[ 3 ] );
+
+    const __m128 a = _mm_movelh_ps( r0, r1 );
+    const __m128 b = _mm_movehl_ps( r1, r0 );
+    const __m128 c = _mm_movelh_ps( r2, r3 );
+    const __m128 d = _mm_movehl_ps( r3, r2 );
+
+    // ( |A|, |B|, |C|, |D| )
+    const __m128 blockDeterminants = _mm_sub_ps(
+        _mm_mul_ps( shuffle< 0, 2, 0, 2 >( r0, r2 ), shuffle< 1, 3, 1, 3 >( r1, r3 ) ),
+        _mm_mul_ps( shuffle< 1, 3, 1, 3 >( r0, r2 ), shuffle< 0, 2, 0, 2 >( r1, r3 ) ) );
+    const __m128 detA = swizzle< 0, 0, 0, 0 >( blockDeterminants );
+    const __m128 detB = swizzle< 1, 1, 1, 1 >( blockDeterminants );
+    const __m128 detC = swizzle< 2, 2, 2, 2 >( blockDeterminants );
+    const __m128 detD = swizzle< 3, 3, 3, 3 >( blockDeterminants );
+
+    const __m128 adjDTimesC = adjugateMultiply2x2( d, c );
+    const __m128 adjATimesB = adjugateMultiply2x2( a, b );
+
+    // adjugates of the blocks of the inverse, before dividing by |M|
+    __m128 x = _mm_sub_ps( _mm_mul_ps( detD, a ), multiply2x2( b, adjDTimesC ) );
+    __m128 w = _mm_sub_ps( _mm_mul_ps( detA, d ), multiply2x2( c, adjATimesB ) );
+    __m128 y = _mm_sub_ps( _mm_mul_ps( detB, c ), multiplyAdjugate2x2( d, adjATimesB ) );
+    __m128 z = _mm_sub_ps( _mm_mul_ps( detC, b ), multiplyAdjugate2x2( a, adjDTimesC ) );
+
+    // |M| = |A||D| + |B||C| - tr( adj( A ) B adj( D ) C )
+    const __m128 trace = sumAcross( _mm_mul_ps( adjATimesB, swizzle< 0, 2, 1, 3 >( adjDTimesC ) ) );
+    const __m128 determinant = _mm_sub_ps( _mm_add_ps( _mm_mul_ps( detA, detD ), _mm_mul_ps( detB, detC ) ), trace );
+
+    // the signs turn each block's adjugate back into the block
+    const __m128 scale = _mm_div_ps( _mm_setr_ps( 1.0f, -1.0f, -1.0f, 1.0f ), determinant );
+    x = _mm_mul_ps( x, scale );
+    y = _mm_mul_ps( y, scale );
+    z = _mm_mul_ps( z, scale );
+    w = _mm_mul_ps( w, scale );
+
+    store( out.m_Columns[ 0 ], shuffle< 3, 1, 3, 1 >( x, y ) );
+    store( out.m_Columns[ 1 ], shuffle< 2, 0, 2, 0 >( x, y ) );
+    store( out.m_Columns[ 2 ], shuffle< 3, 1, 3, 1 >( z, w ) );
+    store( out.m_Columns[ 3 ], shuffle< 2, 0, 2, 0 >( z, w ) );
+#else
+    Mat4f const& m = *this;
+    const float s0 = m( 0, 0 ) * m( 1, 1 ) - m( 1, 0 ) * m( 0, 1 );
+    const float s1 = m( 0, 0 ) * m( 1, 2 ) - m( 1, 0 ) * m( 0, 2 );
+    const float s2 = m( 0, 0 ) * m( 1, 3 ) - m( 1, 0 ) * m( 0, 3 );
+    const float s3 = m( 0, 1 ) * m( 1, 2 ) - m( 1, 1 ) * m( 0, 2 );
+    const float s4 = m( 0, 1 ) * m( 1, 3 ) - m( 1, 1 ) * m( 0, 3 );
+    const float s5 = m( 0, 2 ) * m( 1, 3 ) - m( 1, 2 ) * m( 0, 3 );
+
+    const float c5 = m( 2, 2 ) * m( 3, 3 ) - m( 3, 2 ) * m( 2, 3 );
+    const float c4 = m( 2, 1 ) * m( 3, 3 ) - m( 3, 1 ) * m( 2, 3 );
+    const float c3 = m( 2, 1 ) * m( 3, 2 ) - m( 3, 1 ) * m( 2, 2 );
+    const float c2 = m( 2, 0 ) * m( 3, 3 ) - m( 3, 0 ) * m( 2, 3 );
+    const float c1 = m( 2, 0 ) * m( 3, 2 ) - m( 3, 0 ) * m( 2, 2 );
+    const float c0 = m( 2, 0 ) * m( 3, 1 ) - m( 3, 0 ) * m( 2, 1 );
+
+    const float inverseDeterminant = 1.0f / ( s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0 );
+
+    out( 0, 0 ) = (  m( 1, 1 ) * c5 - m( 1, 2 ) * c4 + m( 1, 3 ) * c3 ) * inverseDeterminant;
+    out( 0, 1 ) = ( -m( 0, 1 ) * c5 + m( 0, 2 ) * c4 - m( 0, 3 ) * c3 ) * inverseDeterminant;
+    out( 0, 2 ) = (  m( 3, 1 ) * s5 - m( 3, 2 ) * s4 + m( 3, 3 ) * s3 ) * inverseDeterminant;
+    out( 0, 3 ) = ( -m( 2, 1 ) * s5 + m( 2, 2 ) * s4 - m( 2, 3 ) * s3 ) * inverseDeterminant;
+
+    out( 1, 0 ) = ( -m( 1, 0 ) * c5 + m( 1, 2 ) * c2 - m( 1, 3 ) * c1 ) * inverseDeterminant;
+    out( 1, 1 ) = (  m( 0, 0 ) * c5 - m( 0, 2 ) * c2 + m( 0, 3 ) * c1 ) * inverseDeterminant;
+    out( 1, 2 ) = ( -m( 3, 0 ) * s5 + m( 3, 2 ) * s2 - m( 3, 3 ) * s1 ) * inverseDeterminant;
+    out( 1, 3 ) = (  m( 2, 0 ) * s5 - m( 2, 2 ) * s2 + m( 2, 3 ) * s1 ) * inverseDeterminant;
+
+    out( 2, 0 ) = (  m( 1, 0 ) * c4 - m( 1, 1 ) * c2 + m( 1, 3 ) * c0 ) * inverseDeterminant;
+    out( 2, 1 ) = ( -m( 0, 0 ) * c4 + m( 0, 1 ) * c2 - m( 0, 3 ) * c0 ) * inverseDeterminant;
+    out( 2, 2 ) = (  m( 3, 0 ) * s4 - m( 3, 1 ) * s2 + m( 3, 3 ) * s0 ) * inverseDeterminant;
+    out( 2, 3 ) = ( -m( 2, 0 ) * s4 + m( 2, 1 ) * s2 - m( 2, 3 ) * s0 ) * inverseDeterminant;
+
+    out( 3, 0 ) = ( -m( 1, 0 ) * c3 + m( 1, 1 ) * c1 - m( 1, 2 ) * c0 ) * inverseDeterminant;
+    out( 3, 1 ) = (  m( 0, 0 ) * c3 - m( 0, 1 ) * c1 + m( 0, 2 ) * c0 ) * inverseDeterminant;
+    out( 3, 2 ) = ( -m( 3, 0 ) * s3 + m( 3, 1 ) * s1 - m( 3, 2 ) * s0 ) * inverseDeterminant;
+    out( 3, 3 ) = (  m( 2, 0 ) * s3 - m( 2, 1 ) * s1 + m( 2, 2 ) * s0 ) * inverseDeterminant;
+#endif
+
+    return out;
+}
+
+bool Mat4f::AlmostEqual( Mat4f const& other, float eps ) const
+{
+    for ( std::size_t i = 0; i < 4; ++i )
+        if ( !m_Columns[ i ].AlmostEqual( other.m_Columns[ i ], eps ) )
+            return false;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Batches
+//-----------------------------------------------------------------------------
+
+void TransformPointsBatch( Mat3f const& transform, Vec2fSoA const& points, Vec2fSoA& out,
+                           std::size_t begin, std::size_t end )
+{
+    end = ( std::min )( end, points.Size() );
+
+    float const* inX = points.Component( 0 );
+    float const* inY = points.Component( 1 );
+    float* outX = out.Component( 0 );
+    float* outY = out.Component( 1 );
+
+    SoADetail::ForEachLane< float >( begin, end, [ & ]( std::size_t i, auto lane )
+    {
+        using Lane = decltype( lane );
+        const auto x = Lane::Load( inX + i );
+        const auto y = Lane::Load( inY + i );
+
+        // each output row is a dot product with the broadcast row of the matrix
+        auto row = [ & ]( std::size_t r )
+        {
+            return Lane::Add( Lane::Add( Lane::Mul( Lane::Set( transform( r, 0 ) ), x ),
+                                         Lane::Mul( Lane::Set( transform( r, 1 ) ), y ) ),
+                              Lane::Set( transform( r, 2 ) ) );
+        };
+        const auto resultX = row( 0 );
+        const auto resultY = row( 1 );
+        Lane::Store( outX + i, resultX );
+        Lane::Store( outY + i, resultY );
+    } );
+}
+
+void TransformPointsBatch( Mat4f const& transform, Vec3fSoA const& points, Vec3fSoA& out,
+                           std::size_t begin, std::size_t end )
+{
+    end = ( std::min )( end, points.Size() );
+
+    SoADetail::ForEachLane< float >( begin, end, [ & ]( std::size_t i, auto lane )
+    {
+        using Lane = decltype( lane );
+        const auto x = Lane::Load( points.Component( 0 ) + i );
+        const auto y = Lane::Load( points.Component( 1 ) + i );
+        const auto z = Lane::Load( points.Component( 2 ) + i );
+
+        for ( std::size_t r = 0; r < 3; ++r )
+        {
+            const auto result = Lane::Add(
+                Lane::Add( Lane::Mul( Lane::Set( transform( r, 0 ) ), x ), Lane::Mul( Lane::Set( transform( r, 1 ) ), y ) ),
+                Lane::Add( Lane::Mul( Lane::Set( transform( r, 2 ) ), z ), Lane::Set( transform( r, 3 ) ) ) );
+            Lane::Store( out.Component( r ) + i, result );
+        }
+    } );
+}
@@ -0,0 +1,176 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: Matrix
+* Description:
+*     Column-major 3x3 and 4x4 float matrices. Every column is a Vec4f, so a column fills
+*     one SSE register and multiplication, inversion and point transformation work a
+*     column at a time. Mat3f doubles as a 2D homogeneous transform and Mat4f as a 3D
+*     one; both convert from Affine2f.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef MATRIX_H
+#define MATRIX_H
+
+#include <pch.h>
+#include <Core/Math/Affine2.h>
+#include <Core/Vector/VectorSoA.h>
+
+//-----------------------------------------------------------------------------
+// Mat3f
+//-----------------------------------------------------------------------------
+
+/// @brief  3x3 matrix; as a 2D transform it maps ( x, y, 1 ), with the translation in
+///         the third column
+class Mat3f
+{
+public:
+    /// @brief  constructs the identity
+    Mat3f() : Mat3f( Vec3f::Unit( 0 ), Vec3f::Unit( 1 ), Vec3f::Unit( 2 ) ) {}
+
+    /// @brief  constructs a matrix from its columns
+    Mat3f( Vec3f const& column0, Vec3f const& column1, Vec3f const& column2 );
+
+    /// @brief  gets the identity matrix
+    static Mat3f Identity() { return {}; }
+
+    /// @brief  builds a 2D transform that scales, then rotates, then translates
+    /// @param  translation the translation
+    /// @param  rotation    the rotation in degrees, counter-clockwise
+    /// @param  scale       the scale along each axis
+    static Mat3f FromTRS( Vec2f const& translation, float rotation, Vec2f const& scale );
+
+    /// @brief  widens a 2D affine transform
+    static Mat3f FromAffine( Affine2f const& transform );
+
+    /// @brief  narrows to a 2D affine transform, dropping the bottom row
+    Affine2f ToAffine() const;
+
+    /// @brief  gets an element
+    float& operator ()( std::size_t row, std::size_t column ) { return m_Columns[ column ][ row ]; }
+    float operator ()( std::size_t row, std::size_t column ) const { return m_Columns[ column ][ row ]; }
+
+    /// @brief  gets a column
+    Vec3f GetColumn( std::size_t column ) const { return Vec3f( m_Columns[ column ].begin() ); }
+
+    /// @brief  multiplies two matrices; the result applies rhs first, then this
+    Mat3f operator *( Mat3f const& rhs ) const;
+
+    /// @brief  multiplies a column vector
+    Vec3f operator *( Vec3f const& v ) const;
+
+    /// @brief  transforms a 2D point, assuming the bottom row is ( 0, 0, 1 )
+    Vec2f TransformPoint( Vec2f const& point ) const;
+
+    /// @brief  transforms a 2D direction, ignoring the translation
+    Vec2f TransformVector( Vec2f const& vector ) const;
+
+    Mat3f Transposed() const;
+
+    float Determinant() const;
+
+    /// @brief  gets the inverse
+    /// @note   the matrix must be invertible; a singular one gives non-finite elements
+    Mat3f Inverse() const;
+
+    /// @brief  compares every element within a tolerance
+    bool AlmostEqual( Mat3f const& other, float eps = 1e-5f ) const;
+
+private:
+    friend class Mat4f;
+
+    /// @brief  columns, each with w kept at zero
+    Vec4f m_Columns[ 3 ];
+};
+
+//-----------------------------------------------------------------------------
+// Mat4f
+//-----------------------------------------------------------------------------
+
+/// @brief  4x4 matrix; as a 3D transform it maps ( x, y, z, 1 ), with the translation
+///         in the fourth column
+class Mat4f
+{
+public:
+    /// @brief  constructs the identity
+    Mat4f() : Mat4f( Vec4f::Unit( 0 ), Vec4f::Unit( 1 ), Vec4f::Unit( 2 ), Vec4f::Unit( 3 ) ) {}
+
+    /// @brief  constructs a matrix from its columns
+    Mat4f( Vec4f const& column0, Vec4f const& column1, Vec4f const& column2, Vec4f const& column3 ) :
+        m_Columns{ column0, column1, column2, column3 }
+    {}
+
+    /// @brief  gets the identity matrix
+    static Mat4f Identity() { return {}; }
+
+    static Mat4f Translation( Vec3f const& translation );
+    static Mat4f Scaling( Vec3f const& scale );
+
+    /// @brief  builds a rotation about one axis
+    /// @param  degrees the angle, counter-clockwise when looking down the axis
+    static Mat4f RotationX( float degrees );
+    static Mat4f RotationY( float degrees );
+    static Mat4f RotationZ( float degrees );
+
+    /// @brief  builds a transform that scales, rotates about x, then y, then z, then translates
+    /// @param  translation the translation
+    /// @param  rotation    the rotation about each axis in degrees
+    /// @param  scale       the scale along each axis
+    static Mat4f FromTRS( Vec3f const& translation, Vec3f const& rotation, Vec3f const& scale );
+
+    /// @brief  embeds a 2D affine transform in the xy plane
+    static Mat4f FromAffine( Affine2f const& transform );
+
+    /// @brief  gets an element
+    float& operator ()( std::size_t row, std::size_t column ) { return m_Columns[ column ][ row ]; }
+    float operator ()( std::size_t row, std::size_t column ) const { return m_Columns[ column ][ row ]; }
+
+    /// @brief  gets a column
+    Vec4f const& GetColumn( std::size_t column ) const { return m_Columns[ column ]; }
+
+    /// @brief  multiplies two matrices; the result applies rhs first, then this
+    Mat4f operator *( Mat4f const& rhs ) const;
+
+    /// @brief  multiplies a column vector
+    Vec4f operator *( Vec4f const& v ) const;
+
+    /// @brief  transforms a 3D point, assuming the bottom row is ( 0, 0, 0, 1 )
+    Vec3f TransformPoint( Vec3f const& point ) const;
+
+    /// @brief  transforms a 3D direction, ignoring the translation
+    Vec3f TransformVector( Vec3f const& vector ) const;
+
+    Mat4f Transposed() const;
+
+    float Determinant() const;
+
+    /// @brief  gets the inverse
+    /// @note   the matrix must be invertible; a singular one gives non-finite elements
+    Mat4f Inverse() const;
+
+    /// @brief  compares every element within a tolerance
+    bool AlmostEqual( Mat4f const& other, float eps = 1e-5f ) const;
+
+private:
+    Vec4f m_Columns[ 4 ];
+};
+
+//-----------------------------------------------------------------------------
+// Batches
+//-----------------------------------------------------------------------------
+
+/// @brief  transforms points[ i ] into out[ i ] for every i in [begin, end), four at a time
+/// @param  transform   the transform to apply, assumed affine
+/// @param  points      the points to transform
+/// @param  out         receives the results; already sized like points, and may be points
+void TransformPointsBatch( Mat3f const& transform, Vec2fSoA const& points, Vec2fSoA& out,
+                           std::size_t begin = 0, std::size_t end = kBatchEnd );
+
+/// @copydoc TransformPointsBatch
+void TransformPointsBatch( Mat4f const& transform, Vec3fSoA const& points, Vec3fSoA& out,
+                           std::size_t begin = 0, std::size_t end = kBatchEnd );
+
+#endif //MATRIX_H
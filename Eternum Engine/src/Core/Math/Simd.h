@@ -0,0 +1,38 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: Simd
+* Description:
+*     Detects the SIMD instruction sets available to the build and pulls in their
+*     intrinsics. Kernels check ETERNUM_SIMD_SSE (and ETERNUM_SIMD_AVX for 256-bit
+*     registers) and keep a scalar path otherwise.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef SIMD_H
+#define SIMD_H
+
+#include <pch.h>
+
+// MSVC never defines __SSE2__; x64 always has SSE2 and x86 reports it via _M_IX86_FP
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+    #define ETERNUM_SIMD_SSE 1
+    #include <emmintrin.h>
+#else
+    #define ETERNUM_SIMD_SSE 0
+#endif
+
+// only when the compiler is allowed to emit AVX (-mavx, /arch:AVX)
+#if ETERNUM_SIMD_SSE && defined( __AVX__ )
+    #define ETERNUM_SIMD_AVX 1
+    #include <immintrin.h>
+#else
+    #define ETERNUM_SIMD_AVX 0
+#endif
+
+/// @brief  number of float lanes processed per SIMD step
+constexpr std::size_t kSimdFloatLanes = ETERNUM_SIMD_SSE ? 4 : 1;
+
+#endif //SIMD_H
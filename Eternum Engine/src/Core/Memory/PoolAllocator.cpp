@@ -0,0 +1,167 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: PoolAllocator
+* Description:
+*     Implements the slab-backed PoolAllocator and the size-classed ObjectPools.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+
+#include <pch.h>
+#include "PoolAllocator.h"
+
+//-----------------------------------------------------------------------------
+// PoolAllocator
+//-----------------------------------------------------------------------------
+
+PoolAllocator::PoolAllocator( std::size_t blockSize, std::size_t blocksPerSlab ) :
+    // blocks double as free list nodes, so they must fit a pointer and keep its alignment
+    m_BlockSize( ( ( std::max )( blockSize, sizeof( FreeNode ) ) + alignof( std::max_align_t ) - 1 )
+                 & ~( alignof( std::max_align_t ) - 1 ) ),
+    m_BlocksPerSlab( blocksPerSlab )
+{}
+
+PoolAllocator::~PoolAllocator()
+{
+    for ( std::byte* slab : m_Slabs )
+        ::operator delete( slab );
+}
+
+void* PoolAllocator::Allocate()
+{
+    std::lock_guard< std::mutex > lock( m_Mutex );
+
+    void* block;
+    if ( m_FreeList )
+    {
+        block = m_FreeList;
+        m_FreeList = m_FreeList->m_Next;
+    }
+    else
+    {
+        if ( m_BumpCursor == m_BumpEnd )
+            addSlab( m_BlocksPerSlab );
+
+        block = m_BumpCursor;
+        m_BumpCursor += m_BlockSize;
+    }
+
+    m_LiveCount.fetch_add( 1, std::memory_order_relaxed );
+    return block;
+}
+
+void PoolAllocator::Deallocate( void* block )
+{
+    if ( block == nullptr )
+        return;
+
+    std::lock_guard< std::mutex > lock( m_Mutex );
+
+    FreeNode* node = static_cast< FreeNode* >( block );
+    node->m_Next = m_FreeList;
+    m_FreeList = node;
+
+    m_LiveCount.fetch_sub( 1, std::memory_order_relaxed );
+}
+
+void PoolAllocator::AllocateBatch( std::size_t count, void** out )
+{
+    if ( count == 0 )
+        return;
+
+    std::lock_guard< std::mutex > lock( m_Mutex );
+
+    // batches always come from the bump region so they are contiguous
+    const std::size_t available = static_cast< std::size_t >( m_BumpEnd - m_BumpCursor ) / m_BlockSize;
+    if ( available < count )
+        addSlab( ( std::max )( count, m_BlocksPerSlab ) );
+
+    for ( std::size_t i = 0; i < count; ++i )
+    {
+        out[ i ] = m_BumpCursor;
+        m_BumpCursor += m_BlockSize;
+    }
+
+    m_LiveCount.fetch_add( count, std::memory_order_relaxed );
+}
+
+void PoolAllocator::DeallocateBatch( void* const* blocks, std::size_t count )
+{
+    std::lock_guard< std::mutex > lock( m_Mutex );
+
+    std::size_t released = 0;
+    for ( std::size_t i = count; i-- > 0; )
+    {
+        if ( blocks[ i ] == nullptr )
+            continue;
+
+        // push in reverse so the next allocations reuse the blocks in their original order
+        FreeNode* node = static_cast< FreeNode* >( blocks[ i ] );
+        node->m_Next = m_FreeList;
+        m_FreeList = node;
+        ++released;
+    }
+
+    m_LiveCount.fetch_sub( released, std::memory_order_relaxed );
+}
+
+std::size_t PoolAllocator::GetSlabCount() const
+{
+    std::lock_guard< std::mutex > lock( m_Mutex );
+    return m_Slabs.size();
+}
+
+void PoolAllocator::addSlab( std::size_t minBlocks )
+{
+    // whatever is left of the old bump region goes to the free list
+    while ( m_BumpCursor != m_BumpEnd )
+    {
+        FreeNode* node = reinterpret_cast< FreeNode* >( m_BumpCursor );
+        node->m_Next = m_FreeList;
+        m_FreeList = node;
+        m_BumpCursor += m_BlockSize;
+    }
+
+    const std::size_t bytes = minBlocks * m_BlockSize;
+    std::byte* slab = static_cast< std::byte* >( ::operator new( bytes ) );
+    m_Slabs.push_back( slab );
+
+    m_BumpCursor = slab;
+    m_BumpEnd = slab + bytes;
+}
+
+//-----------------------------------------------------------------------------
+// ObjectPools
+//-----------------------------------------------------------------------------
+
+ObjectPools::ObjectPools()
+{
+    for ( std::size_t i = 0; i < kClassCount; ++i )
+        m_Pools[ i ] = std::make_unique< PoolAllocator >( ( i + 1 ) * kGranularity );
+}
+
+PoolAllocator* ObjectPools::GetPool( std::size_t size )
+{
+    if ( size == 0 || size > kMaxPooledSize )
+        return nullptr;
+
+    return m_Pools[ ( size - 1 ) / kGranularity ].get();
+}
+
+void* ObjectPools::Allocate( std::size_t size )
+{
+    PoolAllocator* pool = GetPool( size );
+    return pool ? pool->Allocate() : ::operator new( size );
+}
+
+void ObjectPools::Deallocate( void* block, std::size_t size )
+{
+    PoolAllocator* pool = GetPool( size );
+    if ( pool )
+        pool->Deallocate( block );
+    else
+        ::operator delete( block );
+}
@@ -0,0 +1,153 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: PoolAllocator
+* Description:
+*     Fixed-size slab allocators. Blocks are carved from large slabs in address order and
+*     recycled through an intrusive free list, so objects spawned together stay close in
+*     memory and churn never reaches malloc.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef POOLALLOCATOR_H
+#define POOLALLOCATOR_H
+
+#include <pch.h>
+
+/// @brief  thread-safe allocator for blocks of a single size
+class PoolAllocator
+{
+public:
+//-----------------------------------------------------------------------------
+// Constructor / Destructor
+//-----------------------------------------------------------------------------
+
+    /// @brief  constructor
+    /// @param  blockSize       size of every block handed out
+    /// @param  blocksPerSlab   number of blocks in each slab requested from the system
+    explicit PoolAllocator( std::size_t blockSize, std::size_t blocksPerSlab = 1024 );
+
+    /// @brief  destructor, returns every slab to the system
+    ~PoolAllocator();
+
+    // Prevent copy construction and assignment
+    PoolAllocator( PoolAllocator const& ) = delete;
+    PoolAllocator& operator=( PoolAllocator const& ) = delete;
+
+//-----------------------------------------------------------------------------
+// Public Methods
+//-----------------------------------------------------------------------------
+
+    /// @brief  allocates one block
+    /// @return the block
+    void* Allocate();
+
+    /// @brief  returns one block to the pool
+    /// @param  block   the block to free (nullptr is ignored)
+    void Deallocate( void* block );
+
+    /// @brief  allocates several blocks that are contiguous in memory, in address order
+    /// @param  count   number of blocks to allocate
+    /// @param  out     receives the blocks
+    void AllocateBatch( std::size_t count, void** out );
+
+    /// @brief  returns several blocks to the pool under a single lock
+    /// @param  blocks  the blocks to free
+    /// @param  count   number of blocks
+    void DeallocateBatch( void* const* blocks, std::size_t count );
+
+//-----------------------------------------------------------------------------
+// Public Accessors
+//-----------------------------------------------------------------------------
+
+    /// @brief  gets the size of the blocks in this pool
+    std::size_t GetBlockSize() const { return m_BlockSize; }
+
+    /// @brief  gets the number of blocks currently handed out
+    std::size_t GetLiveCount() const { return m_LiveCount.load( std::memory_order_relaxed ); }
+
+    /// @brief  gets the number of slabs requested from the system
+    std::size_t GetSlabCount() const;
+
+//-----------------------------------------------------------------------------
+// Private Types / Methods
+//-----------------------------------------------------------------------------
+private:
+
+    struct FreeNode
+    {
+        FreeNode* m_Next;
+    };
+
+    /// @brief  requests a new slab and makes it the bump region (lock must be held)
+    /// @param  minBlocks   the slab must hold at least this many blocks
+    void addSlab( std::size_t minBlocks );
+
+//-----------------------------------------------------------------------------
+// Private Members
+//-----------------------------------------------------------------------------
+
+    std::size_t const m_BlockSize;
+    std::size_t const m_BlocksPerSlab;
+
+    /// @brief  every slab owned by this pool
+    std::vector< std::byte* > m_Slabs;
+
+    /// @brief  recycled blocks
+    FreeNode* m_FreeList = nullptr;
+
+    /// @brief  untouched region at the end of the newest slab
+    std::byte* m_BumpCursor = nullptr;
+    std::byte* m_BumpEnd = nullptr;
+
+    std::atomic< std::size_t > m_LiveCount{ 0 };
+
+    mutable std::mutex m_Mutex;
+};
+
+/// @brief  set of PoolAllocators bucketed by size class, used as the backing store for
+///         engine objects that override operator new
+class ObjectPools
+{
+public:
+    /// @brief  granularity of the size classes
+    static constexpr std::size_t kGranularity = 16;
+
+    /// @brief  largest pooled size; bigger requests go straight to the system
+    static constexpr std::size_t kMaxPooledSize = 1024;
+
+    /// @brief  gets the global ObjectPools
+    /// @note   intentionally never destroyed so objects released during static
+    ///         destruction still have a pool to return to
+    static ObjectPools& Instance()
+    {
+        static ObjectPools* instance = new ObjectPools();
+        return *instance;
+    }
+
+    /// @brief  allocates a block of at least the given size
+    void* Allocate( std::size_t size );
+
+    /// @brief  frees a block previously returned by Allocate with the same size
+    void Deallocate( void* block, std::size_t size );
+
+    /// @brief  gets the pool that serves a size, or nullptr if the size is not pooled
+    PoolAllocator* GetPool( std::size_t size );
+
+private:
+    ObjectPools();
+
+    static constexpr std::size_t kClassCount = kMaxPooledSize / kGranularity;
+
+    std::array< std::unique_ptr< PoolAllocator >, kClassCount > m_Pools;
+};
+
+/// @brief  gets the global ObjectPools
+inline ObjectPools* Pools()
+{
+    return &ObjectPools::Instance();
+}
+
+#endif //POOLALLOCATOR_H
@@ -0,0 +1,76 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: Random
+* Description:
+*     The engine's single source of randomness. Everything random is drawn from one
+*     generator seeded by a master seed, so a run can be reproduced exactly by replaying
+*     its seed and input.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <pch.h>
+
+class RandomGenerator
+{
+public:
+    /// @brief  gets the global RandomGenerator
+    static RandomGenerator& Instance()
+    {
+        static RandomGenerator instance;
+        return instance;
+    }
+
+    /// @brief  restarts the generator from a master seed
+    /// @param  seed    the master seed
+    void SetSeed( uint64_t seed )
+    {
+        m_Seed = seed;
+        m_Engine.seed( seed );
+    }
+
+    /// @brief  gets the master seed the generator was last started from
+    uint64_t GetSeed() const { return m_Seed; }
+
+    /// @brief  gets the generator, for use with standard distributions
+    /// @note   only draw from the main thread, so the order of draws is reproducible
+    std::mt19937_64& GetEngine() { return m_Engine; }
+
+    /// @brief  draws a uniformly distributed integer
+    /// @param  min the smallest value (inclusive)
+    /// @param  max the largest value (inclusive)
+    int NextInt( int min, int max )
+    {
+        return std::uniform_int_distribution< int >( min, max )( m_Engine );
+    }
+
+    /// @brief  makes a fresh, unpredictable master seed
+    static uint64_t MakeSeed()
+    {
+        std::random_device device;
+        return ( static_cast< uint64_t >( device() ) << 32 ) ^ device();
+    }
+
+    // Prevent copy construction and assignment
+    RandomGenerator( RandomGenerator const& ) = delete;
+    RandomGenerator& operator=( RandomGenerator const& ) = delete;
+
+private:
+    RandomGenerator() { SetSeed( MakeSeed() ); }
+
+    uint64_t m_Seed = 0;
+    std::mt19937_64 m_Engine;
+};
+
+/// @brief  gets the global RandomGenerator
+inline RandomGenerator* Rng()
+{
+    return &RandomGenerator::Instance();
+}
+
+#endif //RANDOM_H
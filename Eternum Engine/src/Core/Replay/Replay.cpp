@@ -0,0 +1,338 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: Replay
+* Description:
+*     Implements the session log format, state checksums and recording.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+
+#include <pch.h>
+#include "Replay.h"
+#include <Core/ECS/Entity/Entity.h>
+#include <Core/ECS/Hierarchy/EntityHierarchy.h>
+#include <Core/ECS/Component/Transform/Transform.h>
+#include <Systems/Grid System/GridSystem.h>
+#include <bit>
+
+namespace {
+
+constexpr char kMagic[ 4 ] = { 'E', 'T', 'R', 'P' };
+constexpr uint8_t kVersion = 1;
+
+/// @brief  bytes buffered before the recorder writes to its file
+constexpr std::size_t kFlushThreshold = 64 * 1024;
+
+enum class RecordType : uint8_t
+{
+    Frame,
+    Checksum,
+    End
+};
+
+/// @brief  64-bit FNV-1a over the values fed to it
+class Fnv1a64
+{
+public:
+    void Add( void const* data, std::size_t size )
+    {
+        auto const* bytes = static_cast< uint8_t const* >( data );
+        for ( std::size_t i = 0; i < size; ++i )
+        {
+            m_Hash ^= bytes[ i ];
+            m_Hash *= 1099511628211ull;
+        }
+    }
+
+    template < typename T >
+    void Add( T value )
+    {
+        static_assert( std::is_trivially_copyable_v< T > );
+        Add( &value, sizeof( T ) );
+    }
+
+    uint64_t Get() const { return m_Hash; }
+
+private:
+    uint64_t m_Hash = 14695981039346656037ull;
+};
+
+void writeVarint( std::vector< uint8_t >& out, uint64_t value )
+{
+    while ( value >= 0x80 )
+    {
+        out.push_back( static_cast< uint8_t >( value | 0x80 ) );
+        value >>= 7;
+    }
+    out.push_back( static_cast< uint8_t >( value ) );
+}
+
+void writeU64( std::vector< uint8_t >& out, uint64_t value )
+{
+    for ( int i = 0; i < 8; ++i )
+        out.push_back( static_cast< uint8_t >( value >> ( 8 * i ) ) );
+}
+
+/// @brief  reads the values of a loaded log, remembering whether it ran out
+class Reader
+{
+public:
+    explicit Reader( std::vector< uint8_t > const& bytes ) :
+        m_Bytes( bytes )
+    {}
+
+    bool AtEnd() const { return m_Position == m_Bytes.size(); }
+    bool Failed() const { return m_Failed; }
+
+    uint8_t U8()
+    {
+        if ( m_Position >= m_Bytes.size() )
+        {
+            m_Failed = true;
+            return 0;
+        }
+        return m_Bytes[ m_Position++ ];
+    }
+
+    uint64_t U64()
+    {
+        uint64_t value = 0;
+        for ( int i = 0; i < 8; ++i )
+            value |= static_cast< uint64_t >( U8() ) << ( 8 * i );
+        return value;
+    }
+
+    uint64_t Varint()
+    {
+        uint64_t value = 0;
+        for ( int shift = 0; shift < 64; shift += 7 )
+        {
+            const uint8_t byte = U8();
+            value |= static_cast< uint64_t >( byte & 0x7F ) << shift;
+            if ( ( byte & 0x80 ) == 0 )
+                return value;
+        }
+        m_Failed = true;
+        return 0;
+    }
+
+private:
+    std::vector< uint8_t > const& m_Bytes;
+    std::size_t m_Position = 0;
+    bool m_Failed = false;
+};
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+// State Checksum
+//-----------------------------------------------------------------------------
+
+uint64_t ComputeStateChecksum()
+{
+    Fnv1a64 hash;
+
+    auto const grid = GridSystem::GetInstance();
+    hash.Add( grid->GetActiveMap().GetHash() );
+    if ( GridSystem::Grid const* map = grid->GetActiveGrid() )
+    {
+        hash.Add( map->m_Dimension.m_Width );
+        hash.Add( map->m_Dimension.m_Height );
+        hash.Add( map->cells.data(), map->cells.size() );
+    }
+
+    hash.Add( Entities()->GetLiveCount() );
+
+    EntityHierarchy const& hierarchy = *Hierarchy();
+    for ( uint32_t position = 0; position < hierarchy.GetSlotCount(); ++position )
+    {
+        Entity const* entity = hierarchy.GetEntityAt( position );
+        if ( entity == nullptr )
+            continue;
+
+        hash.Add( entity->GetId() );
+        hash.Add( hierarchy.GetDepthAt( position ) );
+        hash.Add( entity->GetNameId().GetHash() );
+        hash.Add( entity->GetSignature().to_ullong() );
+
+        if ( auto const* transform = static_cast< Transform const* >( entity->FindComponent( typeid( Transform ) ) ) )
+        {
+            Affine2f const& world = transform->GetWorldMatrix();
+            for ( float value : { world.m_A, world.m_B, world.m_C, world.m_D, world.m_Tx, world.m_Ty } )
+                hash.Add( std::bit_cast< uint32_t >( value ) );
+        }
+    }
+
+    return hash.Get();
+}
+
+//-----------------------------------------------------------------------------
+// Recording
+//-----------------------------------------------------------------------------
+
+ReplayRecorder::~ReplayRecorder()
+{
+    Close();
+}
+
+bool ReplayRecorder::Open( std::string const& path, uint64_t seed, uint32_t checksumInterval )
+{
+    Close();
+
+    m_File.open( path, std::ios::binary | std::ios::trunc );
+    if ( !m_File )
+    {
+        ETERNUM_LOG_ERROR( "cannot create replay log \"", path, "\"" );
+        return false;
+    }
+
+    m_ChecksumInterval = ( std::max )( checksumInterval, 1u );
+    m_Tick = 0;
+    m_LastRecordTick = 0;
+    m_TickKeys.clear();
+    m_Buffer.clear();
+
+    for ( char c : kMagic )
+        m_Buffer.push_back( static_cast< uint8_t >( c ) );
+    m_Buffer.push_back( kVersion );
+    writeU64( m_Buffer, seed );
+    writeVarint( m_Buffer, m_ChecksumInterval );
+    return true;
+}
+
+void ReplayRecorder::AddKey( Key key )
+{
+    if ( IsOpen() )
+        m_TickKeys.push_back( key );
+}
+
+void ReplayRecorder::EndTick( uint32_t fixedSteps )
+{
+    if ( !IsOpen() )
+        return;
+
+    if ( fixedSteps != 0 || !m_TickKeys.empty() )
+    {
+        beginRecord( static_cast< uint8_t >( RecordType::Frame ) );
+        writeVarint( m_Buffer, fixedSteps );
+        writeVarint( m_Buffer, m_TickKeys.size() );
+        for ( Key key : m_TickKeys )
+            writeVarint( m_Buffer, static_cast< uint32_t >( key ) );
+        m_TickKeys.clear();
+    }
+
+    ++m_Tick;
+    if ( m_Tick % m_ChecksumInterval == 0 )
+    {
+        beginRecord( static_cast< uint8_t >( RecordType::Checksum ) );
+        writeU64( m_Buffer, ComputeStateChecksum() );
+    }
+
+    if ( m_Buffer.size() >= kFlushThreshold )
+        flush();
+}
+
+void ReplayRecorder::Close()
+{
+    if ( !IsOpen() )
+        return;
+
+    beginRecord( static_cast< uint8_t >( RecordType::End ) );
+    writeU64( m_Buffer, ComputeStateChecksum() );
+    flush();
+    m_File.close();
+}
+
+void ReplayRecorder::flush()
+{
+    m_File.write( reinterpret_cast< char const* >( m_Buffer.data() ), static_cast< std::streamsize >( m_Buffer.size() ) );
+    m_Buffer.clear();
+}
+
+void ReplayRecorder::beginRecord( uint8_t type )
+{
+    // a frame record describes the tick in progress, the others the ticks finished
+    m_Buffer.push_back( type );
+    writeVarint( m_Buffer, m_Tick - m_LastRecordTick );
+    m_LastRecordTick = m_Tick;
+}
+
+//-----------------------------------------------------------------------------
+// Playback
+//-----------------------------------------------------------------------------
+
+std::unique_ptr< ReplayLog > ReplayLog::Load( std::string const& path )
+{
+    std::ifstream file( path, std::ios::binary );
+    if ( !file )
+    {
+        ETERNUM_LOG_ERROR( "cannot open replay log \"", path, "\"" );
+        return nullptr;
+    }
+    const std::vector< uint8_t > bytes( ( std::istreambuf_iterator< char >( file ) ), std::istreambuf_iterator< char >() );
+
+    Reader reader( bytes );
+    bool isLog = true;
+    for ( char c : kMagic )
+        isLog = reader.U8() == static_cast< uint8_t >( c ) && isLog;
+    if ( !isLog || reader.U8() != kVersion || reader.Failed() )
+    {
+        ETERNUM_LOG_ERROR( "\"", path, "\" is not a replay log this build can read" );
+        return nullptr;
+    }
+
+    auto log = std::make_unique< ReplayLog >();
+    log->m_Seed = reader.U64();
+    log->m_ChecksumInterval = static_cast< uint32_t >( reader.Varint() );
+
+    uint64_t tick = 0;
+    bool ended = false;
+    while ( !ended && !reader.Failed() && !reader.AtEnd() )
+    {
+        const auto type = static_cast< RecordType >( reader.U8() );
+        tick += reader.Varint();
+
+        switch ( type )
+        {
+            case RecordType::Frame:
+            {
+                Frame frame{ tick, static_cast< uint32_t >( reader.Varint() ), {} };
+                const uint64_t keyCount = reader.Varint();
+                for ( uint64_t i = 0; i < keyCount && !reader.Failed(); ++i )
+                    frame.m_Keys.push_back( static_cast< Key >( reader.Varint() ) );
+                log->m_Frames.push_back( std::move( frame ) );
+                break;
+            }
+            case RecordType::Checksum:
+                log->m_Checksums.emplace_back( tick, reader.U64() );
+                break;
+            case RecordType::End:
+                log->m_TickCount = tick;
+                log->m_FinalChecksum = reader.U64();
+                ended = true;
+                break;
+            default:
+                ETERNUM_LOG_ERROR( "replay log \"", path, "\" has an unknown record" );
+                return nullptr;
+        }
+    }
+
+    if ( reader.Failed() || !ended )
+    {
+        ETERNUM_LOG_ERROR( "replay log \"", path, "\" is truncated" );
+        return nullptr;
+    }
+    return log;
+}
+
+std::unique_ptr< InputSource > ReplayLog::MakeInputSource() const
+{
+    auto source = std::make_unique< ScriptedInputSource >();
+    for ( Frame const& frame : m_Frames )
+        for ( Key key : frame.m_Keys )
+            source->Add( frame.m_Tick, key );
+    return source;
+}
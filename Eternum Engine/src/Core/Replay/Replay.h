@@ -0,0 +1,174 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: Replay
+* Description:
+*     Recording and replay of whole sessions. A recording holds the master seed, the keys
+*     read and fixed steps run on each tick, and checksums of the grid and ECS state at
+*     regular ticks, in a compact binary log. Replaying feeds the same seed and input
+*     back through the Runtime at full speed and checks the state against the checksums.
+*
+*     Log layout (integers are little-endian; "varint" is LEB128):
+*         "ETRP", u8 version, u64 seed, varint checksum interval
+*         records, each a u8 type then:
+*             Frame       varint tick delta, varint fixed steps, varint key count, varint keys
+*             Checksum    varint tick delta, u64 checksum
+*             End         varint tick delta, u64 final checksum
+*     Tick deltas count from the previous record, and ticks with no keys and no fixed
+*     steps have no record at all.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <pch.h>
+#include <Systems/Input/InputSource.h>
+#include <fstream>
+
+/// @brief  hashes the state a replay must reproduce: the active grid and every Entity in
+///         hierarchy order with its Components and world Transform
+/// @return the checksum
+uint64_t ComputeStateChecksum();
+
+//-----------------------------------------------------------------------------
+// Recording
+//-----------------------------------------------------------------------------
+
+class ReplayRecorder
+{
+public:
+    /// @brief  default number of ticks between checksums
+    static constexpr uint32_t kDefaultChecksumInterval = 256;
+
+    ReplayRecorder() = default;
+
+    /// @brief  destructor, closes the log if still open
+    ~ReplayRecorder();
+
+    // Prevent copy construction and assignment
+    ReplayRecorder( ReplayRecorder const& ) = delete;
+    ReplayRecorder& operator=( ReplayRecorder const& ) = delete;
+
+    /// @brief  starts a new log
+    /// @param  path                the file to write
+    /// @param  seed                the master seed of the session
+    /// @param  checksumInterval    ticks between checksums
+    /// @return whether the file could be created
+    bool Open( std::string const& path, uint64_t seed, uint32_t checksumInterval = kDefaultChecksumInterval );
+
+    /// @brief  records a key read during the current tick
+    void AddKey( Key key );
+
+    /// @brief  finishes the current tick
+    /// @param  fixedSteps  the number of fixed updates the tick ran
+    /// @note   computes a checksum on every checksum interval
+    void EndTick( uint32_t fixedSteps );
+
+    /// @brief  writes the final checksum and closes the log
+    void Close();
+
+    /// @brief  gets whether a log is being written
+    bool IsOpen() const { return m_File.is_open(); }
+
+    /// @brief  gets the number of finished ticks
+    uint64_t GetTickCount() const { return m_Tick; }
+
+private:
+    /// @brief  writes the buffered bytes to the file
+    void flush();
+
+    /// @brief  appends a record header with the ticks since the previous record
+    void beginRecord( uint8_t type );
+
+    std::ofstream m_File;
+    std::vector< uint8_t > m_Buffer;
+    std::vector< Key > m_TickKeys;
+
+    uint32_t m_ChecksumInterval = kDefaultChecksumInterval;
+    uint64_t m_Tick = 0;
+    uint64_t m_LastRecordTick = 0;
+};
+
+/// @brief  passes another source's events through while recording them
+class RecordingInputSource final : public InputSource
+{
+public:
+    /// @param  inner       the source to read from
+    /// @param  recorder    the recorder to record into; must outlive this source
+    RecordingInputSource( std::unique_ptr< InputSource > inner, ReplayRecorder& recorder ) :
+        m_Inner( std::move( inner ) ),
+        m_Recorder( recorder )
+    {}
+
+    bool Start() override { return m_Inner->Start(); }
+    void Stop() override { m_Inner->Stop(); }
+    void BeginFrame() override { m_Inner->BeginFrame(); }
+
+    bool Poll( KeyEvent& event ) override
+    {
+        if ( !m_Inner->Poll( event ) )
+            return false;
+        m_Recorder.AddKey( event.m_Key );
+        return true;
+    }
+
+    /// @brief  takes back the wrapped source
+    std::unique_ptr< InputSource > Release() { return std::move( m_Inner ); }
+
+private:
+    std::unique_ptr< InputSource > m_Inner;
+    ReplayRecorder& m_Recorder;
+};
+
+//-----------------------------------------------------------------------------
+// Playback
+//-----------------------------------------------------------------------------
+
+/// @brief  a recording loaded back into memory
+class ReplayLog
+{
+public:
+    /// @brief  one tick that had keys or fixed steps
+    struct Frame
+    {
+        uint64_t m_Tick;
+        uint32_t m_FixedSteps;
+        std::vector< Key > m_Keys;
+    };
+
+    /// @brief  loads a log
+    /// @param  path    the file to read
+    /// @return the log, or nullptr if the file is missing or malformed
+    static std::unique_ptr< ReplayLog > Load( std::string const& path );
+
+    uint64_t GetSeed() const { return m_Seed; }
+    uint32_t GetChecksumInterval() const { return m_ChecksumInterval; }
+
+    /// @brief  gets the number of ticks the session ran
+    uint64_t GetTickCount() const { return m_TickCount; }
+
+    /// @brief  gets the ticks that had keys or fixed steps, in tick order
+    std::vector< Frame > const& GetFrames() const { return m_Frames; }
+
+    /// @brief  gets the recorded checksums as (ticks finished, checksum), in tick order
+    std::vector< std::pair< uint64_t, uint64_t > > const& GetChecksums() const { return m_Checksums; }
+
+    /// @brief  gets the checksum of the state at the end of the session
+    uint64_t GetFinalChecksum() const { return m_FinalChecksum; }
+
+    /// @brief  builds an input source that replays the recorded keys
+    std::unique_ptr< InputSource > MakeInputSource() const;
+
+private:
+    uint64_t m_Seed = 0;
+    uint32_t m_ChecksumInterval = 0;
+    uint64_t m_TickCount = 0;
+    uint64_t m_FinalChecksum = 0;
+    std::vector< Frame > m_Frames;
+    std::vector< std::pair< uint64_t, uint64_t > > m_Checksums;
+};
+
+#endif //REPLAY_H
@@ -14,12 +14,31 @@
 
 #include "Runtime.h"
 #include <Systems/AllSystems.h>
+#include <Core/ECS/Commands/CommandBuffer.h>
+#include <Core/ECS/Hierarchy/EntityHierarchy.h>
+#include <Core/ECS/Component/ChangeTracker.h>
+#include <Core/Events/EventBus.h>
+#include <Core/Random/Random.h>
+#include <Core/Replay/Replay.h>
 
 Runtime::~Runtime() = default;
 Runtime::Runtime() = default;
 
 // Runs the game loop, managing the main update/render cycle
 void Runtime::Run() {
+    if (!m_RecordPath.empty()) {
+        m_Recorder = std::make_unique<ReplayRecorder>();
+        if (m_Recorder->Open(m_RecordPath, Rng()->GetSeed())) {
+            // every key the current source reads goes through the recorder as well
+            std::unique_ptr<InputSource> source = Input()->SetSource(nullptr);
+            Input()->SetSource(std::make_unique<RecordingInputSource>(std::move(source), *m_Recorder));
+            ETERNUM_LOG_INFO("Recording to \"", m_RecordPath, "\" with seed ", Rng()->GetSeed());
+        }
+        else {
+            m_Recorder.reset();
+        }
+    }
+
     Init();
     m_Running = true;
 
@@ -37,37 +56,130 @@ void Runtime::Run() {
 
         m_Accumulator += deltaTime;
 
-        Update(deltaTime);
-
+        // the number of fixed steps is all a replay needs to reproduce the timing
+        uint32_t fixedSteps = 0;
         while (m_Accumulator >= deltaTime)
         {
-            FixedUpdate();
+            ++fixedSteps;
             m_Accumulator -= m_FixedDeltaTime;
         }
 
-        Render();
+        Tick(deltaTime, fixedSteps, true);
+
+        if (m_Recorder)
+            m_Recorder->EndTick(fixedSteps);
+    }
+
+    if (m_Recorder) {
+        m_Recorder->Close();
+        ETERNUM_LOG_INFO("Recorded ", m_Recorder->GetTickCount(), " ticks");
     }
 
     Shutdown();
+
+    if (m_Recorder) {
+        // the recorder must outlive the input source wrapping it
+        std::unique_ptr<InputSource> recording = Input()->SetSource(nullptr);
+        Input()->SetSource(static_cast<RecordingInputSource&>(*recording).Release());
+        m_Recorder.reset();
+    }
 }
 
-// Stops the game loop, cleaning up resources and shutting down systems
+// Stops the game loop
 void Runtime::Stop() {
     m_Running = false;
 }
 
+void Runtime::SetRecording(std::string path) {
+    m_RecordPath = std::move(path);
+}
+
+// Replays a recorded session tick by tick without a terminal or any rendering
+bool Runtime::Replay(std::string const& path) {
+    const std::unique_ptr<ReplayLog> log = ReplayLog::Load(path);
+    if (!log)
+        return false;
+
+    Rng()->SetSeed(log->GetSeed());
+    Input()->SetSource(log->MakeInputSource());
+
+    Init();
+    m_Running = true;
+
+    auto const& frames = log->GetFrames();
+    auto const& checksums = log->GetChecksums();
+    auto frame = frames.begin();
+    auto checksum = checksums.begin();
+    bool matched = true;
+
+    // systems only see dt through Update, where nothing depends on it, so every tick uses
+    // the fixed delta
+    auto const start = std::chrono::steady_clock::now();
+    uint64_t tick = 0;
+    for (; tick < log->GetTickCount(); ++tick) {
+        uint32_t fixedSteps = 0;
+        if (frame != frames.end() && frame->m_Tick == tick)
+            fixedSteps = (frame++)->m_FixedSteps;
+
+        Tick(m_FixedDeltaTime, fixedSteps, false);
+
+        if (checksum != checksums.end() && checksum->first == tick + 1) {
+            const uint64_t expected = (checksum++)->second;
+            if (ComputeStateChecksum() != expected) {
+                ETERNUM_LOG_ERROR("Replay diverged from the recording by tick ", tick + 1);
+                matched = false;
+                break;
+            }
+        }
+    }
+
+    if (matched && ComputeStateChecksum() != log->GetFinalChecksum()) {
+        ETERNUM_LOG_ERROR("Replay ended in a different state than the recording");
+        matched = false;
+    }
+    if (matched && m_Running) {
+        ETERNUM_LOG_WARNING("Replay ran out of input before the session stopped");
+    }
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    ETERNUM_LOG_INFO("Replayed ", tick, " ticks in ", elapsed.count(), "s (",
+                     elapsed.count() > 0.0 ? tick / elapsed.count() : 0.0, " ticks/s)");
+
+    m_Running = false;
+    Shutdown();
+    return matched;
+}
+
+// Runs one frame of the loop
+void Runtime::Tick(double deltaTime, uint32_t fixedSteps, bool render) {
+    Update(deltaTime);
+    SyncPoint();
+
+    for (uint32_t step = 0; step < fixedSteps; ++step)
+    {
+        FixedUpdate();
+        SyncPoint();
+    }
+
+    if (render)
+        Render();
+}
+
 // Initializes the runtime, setting up necessary systems and resources
 void Runtime::Init() {
-    std::cout << "Initializing Runtime..." << std::endl;
+    ETERNUM_LOG_INFO("Initializing Runtime...");
 
     // Print the user's system name windows or linux
 #ifdef _WIN32
-    std::cout << "Running on Windows" << std::endl;
+    ETERNUM_LOG_INFO("Running on Windows");
 #else
-    std::cout << "Running on Linux" << std::endl;
+    ETERNUM_LOG_INFO("Running on Linux");
 #endif
 
-   auto systems = Registry()->GetSystems();
+    // engine systems go first, in EngineSystems order, ahead of any registered by macro
+    Registry()->RegisterList(EngineSystems{});
+
+    auto systems = Registry()->GetSystems();
 
     for (auto& system : systems) {
         if (system) {
@@ -79,7 +191,7 @@ void Runtime::Init() {
 
 // Shuts down the runtime, cleaning up resources and shutting down systems
 void Runtime::Shutdown() {
-    std::cout << "Shutting down..." << std::endl;
+    ETERNUM_LOG_INFO("Shutting down...");
 
     auto systems = Registry()->GetSystems();
 
@@ -88,6 +200,11 @@ void Runtime::Shutdown() {
             system->Shutdown();
         }
     }
+
+    // release anything systems destroyed while shutting down
+    SyncPoint();
+
+    Log()->Flush();
 }
 
 // Updates the game state, applying logic and changes based on the elapsed time
@@ -114,6 +231,16 @@ void Runtime::FixedUpdate() {
     }
 }
 
+// Delivers queued events, plays back every command buffer (including commands recorded
+// by event handlers), frees destroyed hierarchies, squeezes their tombstones out of the
+// flattened hierarchy and starts a new change version
+void Runtime::SyncPoint() {
+    Events()->Dispatch();
+    Commands()->Playback();
+    Hierarchy()->Compact();
+    Changes()->Advance();
+}
+
 // Renders the current frame, drawing the game state to the screen
 void Runtime::Render() {
     auto systems = Registry()->GetSystems();
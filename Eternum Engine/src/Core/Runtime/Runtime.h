@@ -19,6 +19,8 @@
 
 #include <Systems/system.h>
 
+class ReplayRecorder;
+
 class Runtime
 {
 
@@ -42,6 +44,14 @@ public:
     // Stops the game loop
     void Stop();
 
+    // Records the next Run (master seed, input and fixed steps of each tick, periodic state
+    // checksums) into a replay log; an empty path turns recording off
+    void SetRecording(std::string path);
+
+    // Re-runs a recorded session headless and as fast as possible, checking the state
+    // against the recorded checksums; returns whether every checksum matched
+    bool Replay(std::string const& path);
+
     // ------------------------------------------------------------------
     // === Private methods for the Runtime class ===
     // --------------------------------------------------------------------
@@ -52,11 +62,18 @@ private:
     void Init();
     void Shutdown();
 
+    // Runs one frame: Update, then the given number of fixed steps, then optionally Render,
+    // with a sync point after every update
+    void Tick(double deltaTime, uint32_t fixedSteps, bool render);
+
     // Core loop stages
     void Update(double deltaTime);
     void FixedUpdate();
     void Render();
 
+    // Delivers events and applies deferred structural changes once no system is iterating the world
+    void SyncPoint();
+
     double GetDeltaTime() const {
         return m_LastTime;
     }
@@ -85,6 +102,10 @@ private:
     double m_Accumulator = 0.0;
     const double m_FixedDeltaTime = 0.016;
 
+    // Recording
+    std::string m_RecordPath;
+    std::unique_ptr<ReplayRecorder> m_Recorder;
+
 };
 
 // Static Runtime instance call
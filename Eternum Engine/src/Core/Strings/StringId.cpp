@@ -0,0 +1,71 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: StringId
+* Description:
+*     Implements the global string intern table and the interning of literals.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+
+#include <pch.h>
+#include "StringId.h"
+#include <unordered_set>
+
+namespace {
+
+/// @brief  two texts hashing to one ID would make them equal keys everywhere
+std::string const& checkCollision( std::string const& stored, std::string_view text )
+{
+    if ( stored != text )
+    {
+        throw std::runtime_error( "StringId collision between \"" + stored + "\" and \""
+                                  + std::string( text ) + "\"" );
+    }
+    return stored;
+}
+
+} // namespace
+
+void StringId::internLiteral( std::string_view text ) const
+{
+    // literals are built over and over; only the first per thread goes to the table
+    thread_local std::unordered_set< uint32_t > s_Interned;
+
+    if ( m_Hash == 0 || s_Interned.contains( m_Hash ) )
+        return;
+
+    StringTable::Instance().Intern( *this, text );
+    s_Interned.insert( m_Hash );
+}
+
+std::string const& StringTable::Intern( StringId id, std::string_view text )
+{
+    {
+        std::shared_lock< std::shared_mutex > lock( m_Mutex );
+        auto const it = m_Strings.find( id.GetHash() );
+        if ( it != m_Strings.end() )
+            return checkCollision( it->second, text );
+    }
+
+    std::unique_lock< std::shared_mutex > lock( m_Mutex );
+    auto const [ it, inserted ] = m_Strings.try_emplace( id.GetHash(), text );
+    return inserted ? it->second : checkCollision( it->second, text );
+}
+
+std::string const& StringTable::Find( StringId id ) const
+{
+    static std::string const s_Empty;
+
+    std::shared_lock< std::shared_mutex > lock( m_Mutex );
+    auto const it = m_Strings.find( id.GetHash() );
+    return it != m_Strings.end() ? it->second : s_Empty;
+}
+
+std::size_t StringTable::Size() const
+{
+    std::shared_lock< std::shared_mutex > lock( m_Mutex );
+    return m_Strings.size();
+}
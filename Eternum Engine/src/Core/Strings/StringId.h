@@ -0,0 +1,205 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: StringId
+* Description:
+*     Compact identifiers for strings used as keys. An ID is the FNV-1a hash of its
+*     text, so IDs of literals are computed at compile time and comparing IDs is an
+*     integer compare. IDs made at runtime intern their text in a global table that keeps
+*     the original string for display and logging; each thread adds a literal to it only
+*     once. Two texts with the same hash are an error when interning, never on lookup.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef STRINGID_H
+#define STRINGID_H
+
+#include <cstdint>
+#include <iostream>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+
+class StringId
+{
+public:
+    /// @brief  the ID of the empty string
+    constexpr StringId() = default;
+
+    /// @brief  gets the ID of a string literal
+    /// @param  text    the literal to identify
+    /// @note   hashed at compile time in constant expressions, which intern nothing; at
+    ///         runtime the text is interned the first time each thread sees it
+    template < std::size_t N >
+    constexpr StringId( char const ( &text )[ N ] ) :
+        m_Hash( Hash( text ) )
+    {
+        if ( !std::is_constant_evaluated() )
+            internLiteral( text );
+    }
+
+    /// @brief  gets the ID of a C string, interning it
+    /// @param  text    the text to identify; it is copied, so it need not outlive the ID
+    template < typename Pointer >
+        requires std::is_same_v< Pointer, char const* > || std::is_same_v< Pointer, char* >
+    constexpr StringId( Pointer text ) :
+        m_Hash( Hash( text != nullptr ? std::string_view( text ) : std::string_view() ) )
+    {
+        if ( !std::is_constant_evaluated() && text != nullptr )
+            intern( text );
+    }
+
+    /// @brief  gets the ID of runtime text, interning it
+    /// @param  text    the text to identify
+    StringId( std::string_view text ) :
+        m_Hash( Hash( text ) )
+    {
+        intern( text );
+    }
+
+    /// @brief  gets the ID of runtime text, interning it
+    /// @param  text    the text to identify
+    StringId( std::string const& text ) :
+        StringId( std::string_view( text ) )
+    {}
+
+    /// @brief  interns text so its ID can be turned back into the text
+    /// @param  text    the text to intern
+    /// @return the ID of the text
+    static StringId Intern( std::string_view text ) { return StringId( text ); }
+
+    /// @brief  gets the ID of text without interning it, for names that come and go
+    /// @param  text    the text to identify
+    /// @return the ID; its GetString is empty unless the text is interned elsewhere
+    static constexpr StringId Hashed( std::string_view text )
+    {
+        StringId id;
+        id.m_Hash = Hash( text );
+        return id;
+    }
+
+    /// @brief  hashes text with 32-bit FNV-1a; the empty string hashes to 0
+    /// @param  text    the text to hash
+    /// @return the hash
+    static constexpr uint32_t Hash( std::string_view text )
+    {
+        if ( text.empty() )
+            return 0;
+
+        uint32_t hash = 2166136261u;
+        for ( char const c : text )
+        {
+            hash ^= static_cast< uint8_t >( c );
+            hash *= 16777619u;
+        }
+
+        // keep 0 reserved for the empty string
+        return hash != 0 ? hash : 1;
+    }
+
+//-----------------------------------------------------------------------------
+// Public Accessors
+//-----------------------------------------------------------------------------
+
+    /// @brief  gets the hash value of this ID
+    constexpr uint32_t GetHash() const { return m_Hash; }
+
+    /// @brief  gets whether this is the ID of the empty string
+    constexpr bool IsEmpty() const { return m_Hash == 0; }
+
+    /// @brief  gets the interned text of this ID
+    /// @return the text; empty if the ID was never interned
+    std::string const& GetString() const;
+
+    constexpr bool operator ==( StringId const& other ) const { return m_Hash == other.m_Hash; }
+    constexpr bool operator !=( StringId const& other ) const { return m_Hash != other.m_Hash; }
+    constexpr bool operator <( StringId const& other ) const { return m_Hash < other.m_Hash; }
+
+//-----------------------------------------------------------------------------
+// Private Methods
+//-----------------------------------------------------------------------------
+private:
+
+    /// @brief  adds text to the intern table
+    /// @throws std::runtime_error if different text is already interned under this ID
+    void intern( std::string_view text ) const;
+
+    /// @brief  adds a literal to the intern table unless this thread already has
+    void internLiteral( std::string_view text ) const;
+
+    uint32_t m_Hash = 0;
+};
+
+static_assert( sizeof( StringId ) == sizeof( uint32_t ) );
+
+/// @brief  the table mapping interned StringIds back to their text
+class StringTable
+{
+public:
+    /// @brief  gets the global StringTable
+    /// @note   intentionally never destroyed since names may be looked up during static
+    ///         destruction
+    static StringTable& Instance()
+    {
+        static StringTable* instance = new StringTable();
+        return *instance;
+    }
+
+    /// @brief  adds text under its ID if it is not there already
+    /// @param  id      the ID of the text
+    /// @param  text    the text
+    /// @return the stored text
+    /// @throws std::runtime_error if different text is already stored under the ID
+    std::string const& Intern( StringId id, std::string_view text );
+
+    /// @brief  gets the text of an ID
+    /// @param  id  the ID to look up
+    /// @return the text, or the empty string if the ID was never interned
+    /// @note   the reference stays valid for the life of the program
+    std::string const& Find( StringId id ) const;
+
+    /// @brief  gets the number of interned strings
+    std::size_t Size() const;
+
+    // Prevent copy construction and assignment
+    StringTable( StringTable const& ) = delete;
+    StringTable& operator=( StringTable const& ) = delete;
+
+private:
+    StringTable() = default;
+
+    /// @brief  text by hash; nodes never move, so references into it stay valid
+    std::unordered_map< uint32_t, std::string > m_Strings;
+
+    mutable std::shared_mutex m_Mutex;
+};
+
+inline std::string const& StringId::GetString() const
+{
+    return StringTable::Instance().Find( *this );
+}
+
+inline void StringId::intern( std::string_view text ) const
+{
+    if ( m_Hash != 0 )
+        StringTable::Instance().Intern( *this, text );
+}
+
+/// @brief  hashes StringIds for unordered containers; the ID already is a hash
+template<>
+struct std::hash< StringId >
+{
+    std::size_t operator ()( StringId id ) const noexcept { return id.GetHash(); }
+};
+
+/// @brief  writes the interned text of a StringId
+inline std::ostream& operator <<( std::ostream& stream, StringId id )
+{
+    return stream << id.GetString();
+}
+
+#endif //STRINGID_H
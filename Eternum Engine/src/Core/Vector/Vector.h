@@ -5,6 +5,19 @@
 * Description:
 *     A fixed-size mathematical vector that supports any dimension N > 0 and
 *     common vector operations (add/sub, scalar ops, dot, length, normalize).
+*     Everything except the square roots works in constant expressions.
+*
+*     Binary +/-, scalar * and /, and unary - build lazy expressions instead of
+*     Vectors, so a chain like a + b * s - c is only evaluated when it is assigned,
+*     and then in a single loop over the elements with no intermediate Vectors.
+*     In-place operations between Vectors and Dot go through VectorKernel<T, N>, which
+*     maps the common float and double sizes onto SIMD registers.
+*
+*     Expressions refer to the named Vectors they were built from and copy temporary
+*     ones, so an expression kept in auto stays valid while its named operands do.
+*
+*     Fixed-point Vectors (see Core/Math/Fixed.h) get integer kernels, including an
+*     integer Length, so they stay bit-identical across machines.
 *
 * Author:     Jax Clayton
 * Created:    8/8/2025
@@ -13,10 +26,152 @@
 #ifndef VECTOR_H
 #define VECTOR_H
 
+#include <Core/Vector/VectorKernels.h>
+
+template <typename T, std::size_t N>
+class Vector;
+
+// -----------------------------------------------------------------------------
+// Expressions
+// -----------------------------------------------------------------------------
+
+/// @brief  base of everything that evaluates to a Vector<T, N> one element at a time
+/// @tparam E   the expression type, which provides constexpr T operator[](i) const
+/// @note   every expression is element-wise: element i depends only on element i of its
+///         operands, which is what makes evaluating straight into an operand safe
+template <typename E, typename T, std::size_t N>
+struct VectorExpression
+{
+    using value_type = T;
+    static constexpr std::size_t kSize = N;
+
+    constexpr E const& Self() const { return static_cast<E const&>(*this); }
+
+    /// @brief  evaluates the expression into a Vector
+    constexpr Vector<T, N> Eval() const { return Vector<T, N>(*this); }
+
+    constexpr T x() const { static_assert(N >= 1, "No x in this vector"); return Self()[0]; }
+    constexpr T y() const { static_assert(N >= 2, "No y in this vector"); return Self()[1]; }
+    constexpr T z() const { static_assert(N >= 3, "No z in this vector"); return Self()[2]; }
+    constexpr T w() const { static_assert(N >= 4, "No w in this vector"); return Self()[3]; }
+
+    constexpr T Dot(const Vector<T, N>& rhs) const { return Eval().Dot(rhs); }
+    constexpr T LengthSq() const { return Eval().LengthSq(); }
+    auto Length() const { return Eval().Length(); }
+    Vector<T, N> Normalized() const { return Eval().Normalized(); }
+};
+
+namespace VectorDetail {
+
+/// @brief  how an expression holds an operand, given the type its operator deduced:
+///         lvalue Vectors by reference, since they outlive the expression, and rvalue
+///         Vectors and other expressions by value, so an expression stored in auto never
+///         refers to a temporary
+template <typename E>
+struct Operand { using Type = std::remove_cvref_t<E>; };
+template <typename T, std::size_t N>
+struct Operand<Vector<T, N>&> { using Type = Vector<T, N> const&; };
+template <typename T, std::size_t N>
+struct Operand<Vector<T, N> const&> { using Type = Vector<T, N> const&; };
+
+template <typename E>
+using OperandType = typename Operand<E>::Type;
+
+/// @brief  a Vector or an expression over Vectors, under any reference
+template <typename E>
+concept Expression = requires {
+    typename std::remove_cvref_t<E>::value_type;
+    std::remove_cvref_t<E>::kSize;
+} && std::derived_from<std::remove_cvref_t<E>,
+                       VectorExpression<std::remove_cvref_t<E>,
+                                        typename std::remove_cvref_t<E>::value_type,
+                                        std::remove_cvref_t<E>::kSize>>;
+
+template <typename E>
+using ValueType = typename std::remove_cvref_t<E>::value_type;
+
+template <typename E>
+inline constexpr bool kIsVector = false;
+template <typename T, std::size_t N>
+inline constexpr bool kIsVector<Vector<T, N>> = true;
+
+template <typename E>
+inline constexpr std::size_t kSizeOf = std::remove_cvref_t<E>::kSize;
+
+/// @brief  two expressions that can be combined element by element
+template <typename L, typename R>
+concept SameShape = Expression<L> && Expression<R>
+    && std::same_as<ValueType<L>, ValueType<R>> && kSizeOf<L> == kSizeOf<R>;
+
+/// @brief  whether the kernel computes Length itself, as the fixed-point kernels do with
+///         an integer square root
+template <typename Kernel, typename T>
+concept KernelLength = requires(T const* p) { Kernel::Length(p); };
+
+} // namespace VectorDetail
+
+/// @brief  lhs + rhs
+/// @tparam L, R    operand storage, see VectorDetail::Operand
+template <typename L, typename R, typename T, std::size_t N>
+struct VectorSum : VectorExpression<VectorSum<L, R, T, N>, T, N>
+{
+    L m_Lhs;
+    R m_Rhs;
+
+    constexpr VectorSum(L lhs, R rhs) : m_Lhs(std::forward<L>(lhs)), m_Rhs(std::forward<R>(rhs)) {}
+    constexpr T operator[](std::size_t i) const { return m_Lhs[i] + m_Rhs[i]; }
+};
+
+/// @brief  lhs - rhs
+template <typename L, typename R, typename T, std::size_t N>
+struct VectorDifference : VectorExpression<VectorDifference<L, R, T, N>, T, N>
+{
+    L m_Lhs;
+    R m_Rhs;
+
+    constexpr VectorDifference(L lhs, R rhs) : m_Lhs(std::forward<L>(lhs)), m_Rhs(std::forward<R>(rhs)) {}
+    constexpr T operator[](std::size_t i) const { return m_Lhs[i] - m_Rhs[i]; }
+};
+
+/// @brief  v * s
+template <typename E, typename T, std::size_t N>
+struct VectorScaled : VectorExpression<VectorScaled<E, T, N>, T, N>
+{
+    E m_Vector;
+    T m_Scalar;
+
+    constexpr VectorScaled(E v, T s) : m_Vector(std::forward<E>(v)), m_Scalar(s) {}
+    constexpr T operator[](std::size_t i) const { return m_Vector[i] * m_Scalar; }
+};
+
+/// @brief  v / s
+template <typename E, typename T, std::size_t N>
+struct VectorQuotient : VectorExpression<VectorQuotient<E, T, N>, T, N>
+{
+    E m_Vector;
+    T m_Scalar;
+
+    constexpr VectorQuotient(E v, T s) : m_Vector(std::forward<E>(v)), m_Scalar(s) {}
+    constexpr T operator[](std::size_t i) const { return m_Vector[i] / m_Scalar; }
+};
+
+/// @brief  -v
+template <typename E, typename T, std::size_t N>
+struct VectorNegated : VectorExpression<VectorNegated<E, T, N>, T, N>
+{
+    E m_Vector;
+
+    constexpr explicit VectorNegated(E v) : m_Vector(std::forward<E>(v)) {}
+    constexpr T operator[](std::size_t i) const { return -m_Vector[i]; }
+};
+
+// -----------------------------------------------------------------------------
+// Vector
+// -----------------------------------------------------------------------------
 
 /// @brief Fixed-size vector with N components of type T.
 template <typename T, std::size_t N>
-class Vector
+class Vector : public VectorExpression<Vector<T, N>, T, N>
 {
     static_assert(N > 0, "Vector<N>: N must be > 0");
 
@@ -27,45 +182,60 @@ public:
     //-----------------------------------------------------------------------------
     // Constructors
     //-----------------------------------------------------------------------------
-    Vector()
-    {
-        if constexpr (std::is_arithmetic_v<T>)
-            m_Data.fill(static_cast<T>(0));
-        else
-            m_Data = {};
-    }
+    constexpr Vector() : m_Data{} {}
 
-    explicit Vector(const T& v)
+    constexpr explicit Vector(const T& v) : m_Data{}
     {
         m_Data.fill(v);
     }
 
-    Vector(std::initializer_list<T> list)
+    /// @note   throws std::invalid_argument at runtime, and fails to compile in a
+    ///         constant expression, when the list does not hold exactly N values
+    constexpr Vector(std::initializer_list<T> list) : m_Data{}
     {
         if (list.size() != N)
             throw std::invalid_argument("Vector: initializer_list size must equal N");
         std::copy(list.begin(), list.end(), m_Data.begin());
     }
 
-    template <typename It>
-    explicit Vector(It first)
+    template <std::input_iterator It>
+    constexpr explicit Vector(It first) : m_Data{}
     {
         for (std::size_t i = 0; i < N; ++i, ++first)
             m_Data[i] = static_cast<T>(*first);
     }
 
+    /// @brief  evaluates a whole expression in one loop over the elements
+    template <typename E>
+    constexpr Vector(const VectorExpression<E, T, N>& expression) : m_Data{}
+    {
+        for (std::size_t i = 0; i < N; ++i)
+            m_Data[i] = expression.Self()[i];
+    }
+
+    /// @brief  evaluates a whole expression straight into this Vector, in one loop
+    /// @note   the expression may refer to this Vector: element i is read before it is
+    ///         written, and no other element is read for it
+    template <typename E>
+    constexpr Vector& operator=(const VectorExpression<E, T, N>& expression)
+    {
+        for (std::size_t i = 0; i < N; ++i)
+            m_Data[i] = expression.Self()[i];
+        return *this;
+    }
+
     //-----------------------------------------------------------------------------
     // Element access (index-based)
     //-----------------------------------------------------------------------------
-    T& operator[](std::size_t i) { return m_Data[i]; }
-    const T& operator[](std::size_t i) const { return m_Data[i]; }
+    constexpr T& operator[](std::size_t i) { return m_Data[i]; }
+    constexpr const T& operator[](std::size_t i) const { return m_Data[i]; }
 
-    T& at(std::size_t i)
+    constexpr T& at(std::size_t i)
     {
         if (i >= N) throw std::out_of_range("Vector::at out of range");
         return m_Data[i];
     }
-    const T& at(std::size_t i) const
+    constexpr const T& at(std::size_t i) const
     {
         if (i >= N) throw std::out_of_range("Vector::at out of range");
         return m_Data[i];
@@ -74,75 +244,100 @@ public:
     //-----------------------------------------------------------------------------
     // Named accessors
     //-----------------------------------------------------------------------------
-    T& x() { static_assert(N >= 1, "No x in this vector"); return m_Data[0]; }
-    T& y() { static_assert(N >= 2, "No y in this vector"); return m_Data[1]; }
-    T& z() { static_assert(N >= 3, "No z in this vector"); return m_Data[2]; }
-    T& w() { static_assert(N >= 4, "No w in this vector"); return m_Data[3]; }
+    constexpr T& x() { static_assert(N >= 1, "No x in this vector"); return m_Data[0]; }
+    constexpr T& y() { static_assert(N >= 2, "No y in this vector"); return m_Data[1]; }
+    constexpr T& z() { static_assert(N >= 3, "No z in this vector"); return m_Data[2]; }
+    constexpr T& w() { static_assert(N >= 4, "No w in this vector"); return m_Data[3]; }
 
-    const T& x() const { static_assert(N >= 1, "No x in this vector"); return m_Data[0]; }
-    const T& y() const { static_assert(N >= 2, "No y in this vector"); return m_Data[1]; }
-    const T& z() const { static_assert(N >= 3, "No z in this vector"); return m_Data[2]; }
-    const T& w() const { static_assert(N >= 4, "No w in this vector"); return m_Data[3]; }
+    constexpr const T& x() const { static_assert(N >= 1, "No x in this vector"); return m_Data[0]; }
+    constexpr const T& y() const { static_assert(N >= 2, "No y in this vector"); return m_Data[1]; }
+    constexpr const T& z() const { static_assert(N >= 3, "No z in this vector"); return m_Data[2]; }
+    constexpr const T& w() const { static_assert(N >= 4, "No w in this vector"); return m_Data[3]; }
 
     //-----------------------------------------------------------------------------
     // Iteration
     //-----------------------------------------------------------------------------
-    auto begin() noexcept { return m_Data.begin(); }
-    auto end() noexcept { return m_Data.end(); }
-    auto begin() const noexcept { return m_Data.begin(); }
-    auto end() const noexcept { return m_Data.end(); }
+    constexpr auto begin() noexcept { return m_Data.begin(); }
+    constexpr auto end() noexcept { return m_Data.end(); }
+    constexpr auto begin() const noexcept { return m_Data.begin(); }
+    constexpr auto end() const noexcept { return m_Data.end(); }
 
     //-----------------------------------------------------------------------------
     // Arithmetic (in-place)
     //-----------------------------------------------------------------------------
-    Vector& operator+=(const Vector& rhs)
+    constexpr Vector& operator+=(const Vector& rhs)
+    {
+        if (std::is_constant_evaluated())
+            ScalarVectorKernel<T, N>::Add(m_Data.data(), rhs.m_Data.data());
+        else
+            Kernel::Add(m_Data.data(), rhs.m_Data.data());
+        return *this;
+    }
+    constexpr Vector& operator-=(const Vector& rhs)
     {
-        for (std::size_t i = 0; i < N; ++i) m_Data[i] += rhs.m_Data[i];
+        if (std::is_constant_evaluated())
+            ScalarVectorKernel<T, N>::Subtract(m_Data.data(), rhs.m_Data.data());
+        else
+            Kernel::Subtract(m_Data.data(), rhs.m_Data.data());
         return *this;
     }
-    Vector& operator-=(const Vector& rhs)
+    constexpr Vector& operator*=(const T& s)
     {
-        for (std::size_t i = 0; i < N; ++i) m_Data[i] -= rhs.m_Data[i];
+        if (std::is_constant_evaluated())
+            ScalarVectorKernel<T, N>::Multiply(m_Data.data(), s);
+        else
+            Kernel::Multiply(m_Data.data(), s);
+        return *this;
+    }
+    constexpr Vector& operator/=(const T& s)
+    {
+        if (std::is_constant_evaluated())
+            ScalarVectorKernel<T, N>::Divide(m_Data.data(), s);
+        else
+            Kernel::Divide(m_Data.data(), s);
         return *this;
     }
-    Vector& operator*=(const T& s)
+
+    /// @brief  adds a whole expression in one loop, without evaluating it into a Vector
+    template <typename E>
+    constexpr Vector& operator+=(const VectorExpression<E, T, N>& rhs)
     {
-        for (auto& v : m_Data) v *= s;
+        for (std::size_t i = 0; i < N; ++i)
+            m_Data[i] += rhs.Self()[i];
         return *this;
     }
-    Vector& operator/=(const T& s)
+    /// @brief  subtracts a whole expression in one loop, without evaluating it into a Vector
+    template <typename E>
+    constexpr Vector& operator-=(const VectorExpression<E, T, N>& rhs)
     {
-        for (auto& v : m_Data) v /= s;
+        for (std::size_t i = 0; i < N; ++i)
+            m_Data[i] -= rhs.Self()[i];
         return *this;
     }
 
     //-----------------------------------------------------------------------------
     // Unary
     //-----------------------------------------------------------------------------
-    Vector operator+() const { return *this; }
-    Vector operator-() const
-    {
-        Vector out;
-        for (std::size_t i = 0; i < N; ++i) out[i] = -m_Data[i];
-        return out;
-    }
+    constexpr Vector operator+() const { return *this; }
 
     //-----------------------------------------------------------------------------
     // Norms & Products
     //-----------------------------------------------------------------------------
-    T Dot(const Vector& rhs) const
+    constexpr T Dot(const Vector& rhs) const
     {
-        T acc = static_cast<T>(0);
-        for (std::size_t i = 0; i < N; ++i) acc += m_Data[i] * rhs.m_Data[i];
-        return acc;
+        if (std::is_constant_evaluated())
+            return ScalarVectorKernel<T, N>::Dot(m_Data.data(), rhs.m_Data.data());
+        return Kernel::Dot(m_Data.data(), rhs.m_Data.data());
     }
 
-    T LengthSq() const { return this->Dot(*this); }
+    constexpr T LengthSq() const { return this->Dot(*this); }
 
     auto Length() const
     {
         using std::sqrt;
-        if constexpr (std::is_floating_point_v<T>)
+        if constexpr (VectorDetail::KernelLength<Kernel, T>)
+            return Kernel::Length(m_Data.data());
+        else if constexpr (std::is_floating_point_v<T>)
             return sqrt(LengthSq());
         else
             return std::sqrt(static_cast<long double>(LengthSq()));
@@ -153,7 +348,7 @@ public:
         const auto len = Length();
         if (len == static_cast<decltype(len)>(0)) return *this;
         Vector out(*this);
-        if constexpr (std::is_floating_point_v<T>)
+        if constexpr (std::is_floating_point_v<T> || VectorDetail::KernelLength<Kernel, T>)
             out /= static_cast<T>(len);
         else
         {
@@ -167,7 +362,7 @@ public:
     {
         const auto len = Length();
         if (len == static_cast<decltype(len)>(0)) return;
-        if constexpr (std::is_floating_point_v<T>)
+        if constexpr (std::is_floating_point_v<T> || VectorDetail::KernelLength<Kernel, T>)
             *this /= static_cast<T>(len);
         else
         {
@@ -176,16 +371,36 @@ public:
         }
     }
 
+    /// @brief  normalizes with an approximate reciprocal square root (opt-in; about
+    ///         1e-6 relative error for float instead of a correctly rounded sqrt and divide)
+    template <typename U = T>
+    std::enable_if_t<std::is_floating_point_v<U>, Vector>
+    NormalizedFast() const
+    {
+        Vector out(*this);
+        out.NormalizeFast();
+        return out;
+    }
+
+    template <typename U = T>
+    std::enable_if_t<std::is_floating_point_v<U>>
+    NormalizeFast()
+    {
+        const T lengthSq = LengthSq();
+        if (lengthSq == static_cast<T>(0)) return;
+        Kernel::Multiply(m_Data.data(), FastInverseSqrt(lengthSq));
+    }
+
     //-----------------------------------------------------------------------------
     // Comparisons
     //-----------------------------------------------------------------------------
-    bool operator==(const Vector& rhs) const
+    constexpr bool operator==(const Vector& rhs) const
     {
         for (std::size_t i = 0; i < N; ++i)
             if (!(m_Data[i] == rhs.m_Data[i])) return false;
         return true;
     }
-    bool operator!=(const Vector& rhs) const { return !(*this == rhs); }
+    constexpr bool operator!=(const Vector& rhs) const { return !(*this == rhs); }
 
     template <typename U = T>
     std::enable_if_t<std::is_floating_point_v<U>, bool>
@@ -202,9 +417,9 @@ public:
     //-----------------------------------------------------------------------------
     // Named Constructors
     //-----------------------------------------------------------------------------
-    static Vector Zero() { return Vector(static_cast<T>(0)); }
+    static constexpr Vector Zero() { return Vector(static_cast<T>(0)); }
 
-    static Vector Unit(std::size_t i)
+    static constexpr Vector Unit(std::size_t i)
     {
         Vector v(static_cast<T>(0));
         if (i < N) v[i] = static_cast<T>(1);
@@ -212,32 +427,77 @@ public:
     }
 
 private:
-    std::array<T, N> m_Data;
+    using Kernel = VectorKernel<T, N>;
+
+    alignas(Kernel::kAlignment) std::array<T, N> m_Data;
 };
 
 // -----------------------------------------------------------------------------
 // Free Operators
 // -----------------------------------------------------------------------------
-template <typename T, std::size_t N>
-inline Vector<T, N> operator+(Vector<T, N> lhs, const Vector<T, N>& rhs) { lhs += rhs; return lhs; }
-template <typename T, std::size_t N>
-inline Vector<T, N> operator-(Vector<T, N> lhs, const Vector<T, N>& rhs) { lhs -= rhs; return lhs; }
-template <typename T, std::size_t N>
-inline Vector<T, N> operator*(Vector<T, N> v, const T& s) { v *= s; return v; }
-template <typename T, std::size_t N>
-inline Vector<T, N> operator*(const T& s, Vector<T, N> v) { v *= s; return v; }
-template <typename T, std::size_t N>
-inline Vector<T, N> operator/(Vector<T, N> v, const T& s) { v /= s; return v; }
+template <typename L, typename R>
+    requires VectorDetail::SameShape<L, R>
+constexpr auto operator+(L&& lhs, R&& rhs)
+{
+    using Sum = VectorSum<VectorDetail::OperandType<L>, VectorDetail::OperandType<R>,
+                          VectorDetail::ValueType<L>, VectorDetail::kSizeOf<L>>;
+    return Sum(std::forward<L>(lhs), std::forward<R>(rhs));
+}
+template <typename L, typename R>
+    requires VectorDetail::SameShape<L, R>
+constexpr auto operator-(L&& lhs, R&& rhs)
+{
+    using Difference = VectorDifference<VectorDetail::OperandType<L>, VectorDetail::OperandType<R>,
+                                        VectorDetail::ValueType<L>, VectorDetail::kSizeOf<L>>;
+    return Difference(std::forward<L>(lhs), std::forward<R>(rhs));
+}
+template <typename E, typename T>
+    requires VectorDetail::Expression<E> && std::same_as<T, VectorDetail::ValueType<E>>
+constexpr auto operator*(E&& v, const T& s)
+{
+    return VectorScaled<VectorDetail::OperandType<E>, T, VectorDetail::kSizeOf<E>>(std::forward<E>(v), s);
+}
+template <typename E, typename T>
+    requires VectorDetail::Expression<E> && std::same_as<T, VectorDetail::ValueType<E>>
+constexpr auto operator*(const T& s, E&& v)
+{
+    return VectorScaled<VectorDetail::OperandType<E>, T, VectorDetail::kSizeOf<E>>(std::forward<E>(v), s);
+}
+template <typename E, typename T>
+    requires VectorDetail::Expression<E> && std::same_as<T, VectorDetail::ValueType<E>>
+constexpr auto operator/(E&& v, const T& s)
+{
+    return VectorQuotient<VectorDetail::OperandType<E>, T, VectorDetail::kSizeOf<E>>(std::forward<E>(v), s);
+}
+template <typename E>
+    requires VectorDetail::Expression<E>
+constexpr auto operator-(E&& v)
+{
+    return VectorNegated<VectorDetail::OperandType<E>, VectorDetail::ValueType<E>, VectorDetail::kSizeOf<E>>(std::forward<E>(v));
+}
+
+/// @brief  compares an expression with a Vector or another expression element by
+///         element; two Vectors use Vector::operator== directly
+template <typename L, typename R>
+    requires VectorDetail::SameShape<L, R> && (!VectorDetail::kIsVector<L> || !VectorDetail::kIsVector<R>)
+constexpr bool operator==(const L& lhs, const R& rhs)
+{
+    for (std::size_t i = 0; i < VectorDetail::kSizeOf<L>; ++i)
+        if (!(lhs[i] == rhs[i])) return false;
+    return true;
+}
 
 // -----------------------------------------------------------------------------
 // Helpers
 // -----------------------------------------------------------------------------
-template <typename T, std::size_t N>
-inline T Dot(const Vector<T, N>& a, const Vector<T, N>& b) { return a.Dot(b); }
-template <typename T, std::size_t N>
-inline auto Length(const Vector<T, N>& a) { return a.Length(); }
-template <typename T, std::size_t N>
-inline Vector<T, N> Normalize(const Vector<T, N>& a) { return a.Normalized(); }
+template <typename L, typename R, typename T, std::size_t N>
+constexpr T Dot(const VectorExpression<L, T, N>& a, const VectorExpression<R, T, N>& b) { return a.Eval().Dot(b.Eval()); }
+template <typename E, typename T, std::size_t N>
+inline auto Length(const VectorExpression<E, T, N>& a) { return a.Eval().Length(); }
+template <typename E, typename T, std::size_t N>
+inline Vector<T, N> Normalize(const VectorExpression<E, T, N>& a) { return a.Eval().Normalized(); }
+template <typename E, typename T, std::size_t N>
+inline Vector<T, N> NormalizeFast(const VectorExpression<E, T, N>& a) { return a.Eval().NormalizedFast(); }
 
 // -----------------------------------------------------------------------------
 // Stream Output
@@ -271,4 +531,87 @@ using Vec2i = Vector<int, 2>;
 using Vec3i = Vector<int, 3>;
 using Vec4i = Vector<int, 4>;
 
+// -----------------------------------------------------------------------------
+// Padded Vectors
+// -----------------------------------------------------------------------------
+
+/// @brief  Vec3f stored in a full Vec4f with w kept at zero, so every operation is a
+///         single aligned SIMD instruction; use it for hot arrays, and Vec3f where the
+///         extra 4 bytes matter
+class PaddedVec3f
+{
+public:
+    using value_type = float;
+    static constexpr std::size_t kSize = 3;
+
+    PaddedVec3f() = default;
+
+    PaddedVec3f(float x, float y, float z)
+    {
+        m_Data[0] = x; m_Data[1] = y; m_Data[2] = z;
+    }
+
+    explicit PaddedVec3f(const Vec3f& v) : PaddedVec3f(v[0], v[1], v[2]) {}
+
+    /// @brief  gets the unpadded vector
+    Vec3f ToVec3f() const { return Vec3f(m_Data.begin()); }
+
+    float& operator[](std::size_t i) { return m_Data[i]; }
+    const float& operator[](std::size_t i) const { return m_Data[i]; }
+
+    float& x() { return m_Data[0]; }
+    float& y() { return m_Data[1]; }
+    float& z() { return m_Data[2]; }
+    const float& x() const { return m_Data[0]; }
+    const float& y() const { return m_Data[1]; }
+    const float& z() const { return m_Data[2]; }
+
+    auto begin() noexcept { return m_Data.begin(); }
+    auto end() noexcept { return m_Data.begin() + kSize; }
+    auto begin() const noexcept { return m_Data.begin(); }
+    auto end() const noexcept { return m_Data.begin() + kSize; }
+
+    PaddedVec3f& operator+=(const PaddedVec3f& rhs) { m_Data += rhs.m_Data; return *this; }
+    PaddedVec3f& operator-=(const PaddedVec3f& rhs) { m_Data -= rhs.m_Data; return *this; }
+    PaddedVec3f& operator*=(float s) { m_Data *= s; return *this; }
+    PaddedVec3f& operator/=(float s)
+    {
+        // 0 / 0 would leave a NaN in w and poison every later Dot
+        m_Data /= s;
+        m_Data[3] = 0.0f;
+        return *this;
+    }
+
+    PaddedVec3f operator+() const { return *this; }
+    PaddedVec3f operator-() const { PaddedVec3f out; out.m_Data = -m_Data; return out; }
+
+    float Dot(const PaddedVec3f& rhs) const { return m_Data.Dot(rhs.m_Data); }
+    float LengthSq() const { return m_Data.LengthSq(); }
+    float Length() const { return m_Data.Length(); }
+
+    PaddedVec3f Normalized() const { PaddedVec3f out(*this); out.Normalize(); return out; }
+    void Normalize() { m_Data.Normalize(); }
+    PaddedVec3f NormalizedFast() const { PaddedVec3f out(*this); out.NormalizeFast(); return out; }
+    void NormalizeFast() { m_Data.NormalizeFast(); }
+
+    bool operator==(const PaddedVec3f& rhs) const { return m_Data == rhs.m_Data; }
+    bool operator!=(const PaddedVec3f& rhs) const { return !(*this == rhs); }
+
+    bool AlmostEqual(const PaddedVec3f& rhs, float eps = 1e-6f) const { return m_Data.AlmostEqual(rhs.m_Data, eps); }
+
+private:
+    Vec4f m_Data;
+};
+
+inline PaddedVec3f operator+(PaddedVec3f lhs, const PaddedVec3f& rhs) { lhs += rhs; return lhs; }
+inline PaddedVec3f operator-(PaddedVec3f lhs, const PaddedVec3f& rhs) { lhs -= rhs; return lhs; }
+inline PaddedVec3f operator*(PaddedVec3f v, float s) { v *= s; return v; }
+inline PaddedVec3f operator*(float s, PaddedVec3f v) { v *= s; return v; }
+inline PaddedVec3f operator/(PaddedVec3f v, float s) { v /= s; return v; }
+
+inline std::ostream& operator<<(std::ostream& os, const PaddedVec3f& v)
+{
+    return os << v.ToVec3f();
+}
+
 #endif // VECTOR_H
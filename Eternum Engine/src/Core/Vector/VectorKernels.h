@@ -0,0 +1,203 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: VectorKernels
+* Description:
+*     The loops behind the in-place operations and Dot of Vector<T, N>. The primary
+*     template is plain scalar code; Vec2f, Vec3f, Vec4f and Vec2d are specialized onto
+*     single SSE registers, and Vec4d onto an AVX register when the build targets AVX.
+*     Builds without SSE use the scalar loops for every size.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef VECTORKERNELS_H
+#define VECTORKERNELS_H
+
+#include <Core/Math/Simd.h>
+
+/// @brief  the scalar loops; also what a Vector uses during constant evaluation
+template < typename T, std::size_t N >
+struct ScalarVectorKernel
+{
+    /// @brief  alignment the Vector gives its storage
+    static constexpr std::size_t kAlignment = alignof( T );
+
+    static constexpr void Add( T* a, T const* b )      { for ( std::size_t i = 0; i < N; ++i ) a[ i ] += b[ i ]; }
+    static constexpr void Subtract( T* a, T const* b ) { for ( std::size_t i = 0; i < N; ++i ) a[ i ] -= b[ i ]; }
+    static constexpr void Multiply( T* a, T s )        { for ( std::size_t i = 0; i < N; ++i ) a[ i ] *= s; }
+    static constexpr void Divide( T* a, T s )          { for ( std::size_t i = 0; i < N; ++i ) a[ i ] /= s; }
+
+    static constexpr T Dot( T const* a, T const* b )
+    {
+        T acc = static_cast< T >( 0 );
+        for ( std::size_t i = 0; i < N; ++i ) acc += a[ i ] * b[ i ];
+        return acc;
+    }
+};
+
+/// @brief  element-wise operations on the storage of a Vector<T, N>
+/// @note   pointers always come from a Vector, so they are aligned to kAlignment
+template < typename T, std::size_t N >
+struct VectorKernel : ScalarVectorKernel< T, N > {};
+
+/// @brief  approximates 1 / sqrt( x ) for x > 0
+/// @note   the float version is the SSE estimate refined by one Newton-Raphson step,
+///         accurate to about 1e-6 relative; other types compute it exactly
+template < typename T >
+inline T FastInverseSqrt( T x )
+{
+    return static_cast< T >( 1 ) / std::sqrt( x );
+}
+
+#if ETERNUM_SIMD_SSE
+
+template <>
+inline float FastInverseSqrt< float >( float x )
+{
+    const __m128 value = _mm_set_ss( x );
+    const __m128 estimate = _mm_rsqrt_ss( value );
+
+    // estimate * ( 1.5 - 0.5 * x * estimate^2 )
+    const __m128 halfValue = _mm_mul_ss( _mm_set_ss( 0.5f ), value );
+    const __m128 correction = _mm_sub_ss( _mm_set_ss( 1.5f ), _mm_mul_ss( halfValue, _mm_mul_ss( estimate, estimate ) ) );
+    return _mm_cvtss_f32( _mm_mul_ss( estimate, correction ) );
+}
+
+namespace SimdDetail {
+
+/// @brief  sums the low two lanes
+inline float SumLow2( __m128 v )
+{
+    return _mm_cvtss_f32( _mm_add_ss( v, _mm_shuffle_ps( v, v, _MM_SHUFFLE( 1, 1, 1, 1 ) ) ) );
+}
+
+/// @brief  sums the low three lanes
+inline float SumLow3( __m128 v )
+{
+    const __m128 sum = _mm_add_ss( v, _mm_shuffle_ps( v, v, _MM_SHUFFLE( 1, 1, 1, 1 ) ) );
+    return _mm_cvtss_f32( _mm_add_ss( sum, _mm_movehl_ps( v, v ) ) );
+}
+
+/// @brief  sums all four lanes
+inline float Sum4( __m128 v )
+{
+    const __m128 pairs = _mm_add_ps( v, _mm_movehl_ps( v, v ) );
+    return _mm_cvtss_f32( _mm_add_ss( pairs, _mm_shuffle_ps( pairs, pairs, _MM_SHUFFLE( 1, 1, 1, 1 ) ) ) );
+}
+
+} // namespace SimdDetail
+
+/// @brief  Vec4f, one aligned SSE register
+template <>
+struct VectorKernel< float, 4 >
+{
+    static constexpr std::size_t kAlignment = 16;
+
+    static __m128 Load( float const* a )     { return _mm_load_ps( a ); }
+    static void Store( float* a, __m128 v )  { _mm_store_ps( a, v ); }
+
+    static void Add( float* a, float const* b )      { Store( a, _mm_add_ps( Load( a ), Load( b ) ) ); }
+    static void Subtract( float* a, float const* b ) { Store( a, _mm_sub_ps( Load( a ), Load( b ) ) ); }
+    static void Multiply( float* a, float s )        { Store( a, _mm_mul_ps( Load( a ), _mm_set1_ps( s ) ) ); }
+    static void Divide( float* a, float s )          { Store( a, _mm_div_ps( Load( a ), _mm_set1_ps( s ) ) ); }
+
+    static float Dot( float const* a, float const* b ) { return SimdDetail::Sum4( _mm_mul_ps( Load( a ), Load( b ) ) ); }
+};
+
+/// @brief  Vec3f, the low three lanes of an SSE register; stays 12 bytes so it can be
+///         packed tightly, and never touches the memory after the third element
+template <>
+struct VectorKernel< float, 3 >
+{
+    static constexpr std::size_t kAlignment = alignof( float );
+
+    static __m128 Load( float const* a )
+    {
+        const __m128 xy = _mm_loadl_pi( _mm_setzero_ps(), reinterpret_cast< __m64 const* >( a ) );
+        return _mm_movelh_ps( xy, _mm_load_ss( a + 2 ) );
+    }
+    static void Store( float* a, __m128 v )
+    {
+        _mm_storel_pi( reinterpret_cast< __m64* >( a ), v );
+        _mm_store_ss( a + 2, _mm_movehl_ps( v, v ) );
+    }
+
+    static void Add( float* a, float const* b )      { Store( a, _mm_add_ps( Load( a ), Load( b ) ) ); }
+    static void Subtract( float* a, float const* b ) { Store( a, _mm_sub_ps( Load( a ), Load( b ) ) ); }
+    static void Multiply( float* a, float s )        { Store( a, _mm_mul_ps( Load( a ), _mm_set1_ps( s ) ) ); }
+    static void Divide( float* a, float s )          { Store( a, _mm_div_ps( Load( a ), _mm_set1_ps( s ) ) ); }
+
+    static float Dot( float const* a, float const* b ) { return SimdDetail::SumLow3( _mm_mul_ps( Load( a ), Load( b ) ) ); }
+};
+
+/// @brief  Vec2f, the low two lanes of an SSE register moved as one 64-bit value
+/// @note   the 64-bit moves go through __m64, which may alias the floats; reading them
+///         through a double* would let the optimizer reorder them around float stores
+template <>
+struct VectorKernel< float, 2 >
+{
+    static constexpr std::size_t kAlignment = 8;
+
+    static __m128 Load( float const* a )     { return _mm_loadl_pi( _mm_setzero_ps(), reinterpret_cast< __m64 const* >( a ) ); }
+    static void Store( float* a, __m128 v )  { _mm_storel_pi( reinterpret_cast< __m64* >( a ), v ); }
+
+    static void Add( float* a, float const* b )      { Store( a, _mm_add_ps( Load( a ), Load( b ) ) ); }
+    static void Subtract( float* a, float const* b ) { Store( a, _mm_sub_ps( Load( a ), Load( b ) ) ); }
+    static void Multiply( float* a, float s )        { Store( a, _mm_mul_ps( Load( a ), _mm_set1_ps( s ) ) ); }
+    static void Divide( float* a, float s )          { Store( a, _mm_div_ps( Load( a ), _mm_set1_ps( s ) ) ); }
+
+    static float Dot( float const* a, float const* b ) { return SimdDetail::SumLow2( _mm_mul_ps( Load( a ), Load( b ) ) ); }
+};
+
+/// @brief  Vec2d, one aligned SSE2 register
+template <>
+struct VectorKernel< double, 2 >
+{
+    static constexpr std::size_t kAlignment = 16;
+
+    static __m128d Load( double const* a )    { return _mm_load_pd( a ); }
+    static void Store( double* a, __m128d v ) { _mm_store_pd( a, v ); }
+
+    static void Add( double* a, double const* b )      { Store( a, _mm_add_pd( Load( a ), Load( b ) ) ); }
+    static void Subtract( double* a, double const* b ) { Store( a, _mm_sub_pd( Load( a ), Load( b ) ) ); }
+    static void Multiply( double* a, double s )        { Store( a, _mm_mul_pd( Load( a ), _mm_set1_pd( s ) ) ); }
+    static void Divide( double* a, double s )          { Store( a, _mm_div_pd( Load( a ), _mm_set1_pd( s ) ) ); }
+
+    static double Dot( double const* a, double const* b )
+    {
+        const __m128d product = _mm_mul_pd( Load( a ), Load( b ) );
+        return _mm_cvtsd_f64( _mm_add_sd( product, _mm_unpackhi_pd( product, product ) ) );
+    }
+};
+
+#endif // ETERNUM_SIMD_SSE
+
+#if ETERNUM_SIMD_AVX
+
+/// @brief  Vec4d, one aligned AVX register
+template <>
+struct VectorKernel< double, 4 >
+{
+    static constexpr std::size_t kAlignment = 32;
+
+    static __m256d Load( double const* a )    { return _mm256_load_pd( a ); }
+    static void Store( double* a, __m256d v ) { _mm256_store_pd( a, v ); }
+
+    static void Add( double* a, double const* b )      { Store( a, _mm256_add_pd( Load( a ), Load( b ) ) ); }
+    static void Subtract( double* a, double const* b ) { Store( a, _mm256_sub_pd( Load( a ), Load( b ) ) ); }
+    static void Multiply( double* a, double s )        { Store( a, _mm256_mul_pd( Load( a ), _mm256_set1_pd( s ) ) ); }
+    static void Divide( double* a, double s )          { Store( a, _mm256_div_pd( Load( a ), _mm256_set1_pd( s ) ) ); }
+
+    static double Dot( double const* a, double const* b )
+    {
+        const __m256d product = _mm256_mul_pd( Load( a ), Load( b ) );
+        const __m128d pairs = _mm_add_pd( _mm256_castpd256_pd128( product ), _mm256_extractf128_pd( product, 1 ) );
+        return _mm_cvtsd_f64( _mm_add_sd( pairs, _mm_unpackhi_pd( pairs, pairs ) ) );
+    }
+};
+
+#endif // ETERNUM_SIMD_AVX
+
+#endif //VECTORKERNELS_H
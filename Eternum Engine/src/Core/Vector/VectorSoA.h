@@ -0,0 +1,362 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: VectorSoA
+* Description:
+*     Many Vector<T, N> stored one array per component, with batch kernels that work
+*     through them a SIMD register at a time (four floats or two doubles with SSE) and
+*     finish the remainder with the same operations one element at a time, so every
+*     element gets the same result whichever path it takes.
+*
+*     Kernels take an optional [begin, end) range so jobs can split a batch. Outputs must
+*     already have the size of the inputs, and may be the inputs themselves.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef VECTORSOA_H
+#define VECTORSOA_H
+
+#include <pch.h>
+#include <Core/Math/Simd.h>
+
+//-----------------------------------------------------------------------------
+// Lanes
+//-----------------------------------------------------------------------------
+
+/// @brief  the operations batch kernels need, on a single T
+template < typename T >
+struct ScalarLane
+{
+    using Register = T;
+    static constexpr std::size_t kWidth = 1;
+
+    static Register Load( T const* p )             { return *p; }
+    static void Store( T* p, Register v )          { *p = v; }
+    static Register Set( T v )                     { return v; }
+    static Register Add( Register a, Register b )  { return a + b; }
+    static Register Sub( Register a, Register b )  { return a - b; }
+    static Register Mul( Register a, Register b )  { return a * b; }
+    static Register Min( Register a, Register b )  { return ( std::min )( a, b ); }
+    static Register Sqrt( Register a )             { return static_cast< T >( std::sqrt( a ) ); }
+
+    /// @brief  1 / a where a > 0, and 0 elsewhere
+    static Register SafeInverse( Register a )      { return a > 0 ? static_cast< T >( 1 ) / a : static_cast< T >( 0 ); }
+};
+
+/// @brief  the widest register of T the build supports; the scalar lane by default
+template < typename T >
+struct SoALane : ScalarLane< T > {};
+
+#if ETERNUM_SIMD_SSE
+
+template <>
+struct SoALane< float >
+{
+    using Register = __m128;
+    static constexpr std::size_t kWidth = 4;
+
+    static Register Load( float const* p )         { return _mm_loadu_ps( p ); }
+    static void Store( float* p, Register v )      { _mm_storeu_ps( p, v ); }
+    static Register Set( float v )                 { return _mm_set1_ps( v ); }
+    static Register Add( Register a, Register b )  { return _mm_add_ps( a, b ); }
+    static Register Sub( Register a, Register b )  { return _mm_sub_ps( a, b ); }
+    static Register Mul( Register a, Register b )  { return _mm_mul_ps( a, b ); }
+    static Register Min( Register a, Register b )  { return _mm_min_ps( a, b ); }
+    static Register Sqrt( Register a )             { return _mm_sqrt_ps( a ); }
+
+    static Register SafeInverse( Register a )
+    {
+        return _mm_and_ps( _mm_cmpgt_ps( a, _mm_setzero_ps() ), _mm_div_ps( _mm_set1_ps( 1.0f ), a ) );
+    }
+};
+
+template <>
+struct SoALane< double >
+{
+    using Register = __m128d;
+    static constexpr std::size_t kWidth = 2;
+
+    static Register Load( double const* p )        { return _mm_loadu_pd( p ); }
+    static void Store( double* p, Register v )     { _mm_storeu_pd( p, v ); }
+    static Register Set( double v )                { return _mm_set1_pd( v ); }
+    static Register Add( Register a, Register b )  { return _mm_add_pd( a, b ); }
+    static Register Sub( Register a, Register b )  { return _mm_sub_pd( a, b ); }
+    static Register Mul( Register a, Register b )  { return _mm_mul_pd( a, b ); }
+    static Register Min( Register a, Register b )  { return _mm_min_pd( a, b ); }
+    static Register Sqrt( Register a )             { return _mm_sqrt_pd( a ); }
+
+    static Register SafeInverse( Register a )
+    {
+        return _mm_and_pd( _mm_cmpgt_pd( a, _mm_setzero_pd() ), _mm_div_pd( _mm_set1_pd( 1.0 ), a ) );
+    }
+};
+
+#endif // ETERNUM_SIMD_SSE
+
+//-----------------------------------------------------------------------------
+// Container
+//-----------------------------------------------------------------------------
+
+/// @brief  many Vector<T, N> stored one contiguous array per component
+template < typename T, std::size_t N >
+class VectorSoA
+{
+public:
+    using VectorType = Vector< T, N >;
+
+    VectorSoA() = default;
+
+    /// @brief  creates count zero vectors
+    explicit VectorSoA( std::size_t count ) { Resize( count ); }
+
+    /// @brief  resizes every component array, zero-filling new vectors
+    void Resize( std::size_t count )
+    {
+        for ( auto& component : m_Components )
+            component.resize( count, static_cast< T >( 0 ) );
+    }
+
+    /// @brief  reserves room in every component array
+    void Reserve( std::size_t count )
+    {
+        for ( auto& component : m_Components )
+            component.reserve( count );
+    }
+
+    void Clear()
+    {
+        for ( auto& component : m_Components )
+            component.clear();
+    }
+
+    /// @brief  gets the number of vectors
+    std::size_t Size() const { return m_Components[ 0 ].size(); }
+
+    bool Empty() const { return m_Components[ 0 ].empty(); }
+
+    /// @brief  appends one vector
+    void PushBack( VectorType const& v )
+    {
+        for ( std::size_t axis = 0; axis < N; ++axis )
+            m_Components[ axis ].push_back( v[ axis ] );
+    }
+
+    /// @brief  writes one vector
+    void Set( std::size_t i, VectorType const& v )
+    {
+        for ( std::size_t axis = 0; axis < N; ++axis )
+            m_Components[ axis ][ i ] = v[ axis ];
+    }
+
+    /// @brief  reads one vector
+    VectorType Get( std::size_t i ) const
+    {
+        VectorType v;
+        for ( std::size_t axis = 0; axis < N; ++axis )
+            v[ axis ] = m_Components[ axis ][ i ];
+        return v;
+    }
+
+    /// @brief  gets the array of one component (0 for x, 1 for y, ...)
+    T* Component( std::size_t axis ) { return m_Components[ axis ].data(); }
+    T const* Component( std::size_t axis ) const { return m_Components[ axis ].data(); }
+
+private:
+    std::array< std::vector< T >, N > m_Components;
+};
+
+using Vec2fSoA = VectorSoA< float, 2 >;
+using Vec3fSoA = VectorSoA< float, 3 >;
+using Vec2dSoA = VectorSoA< double, 2 >;
+using Vec3dSoA = VectorSoA< double, 3 >;
+
+//-----------------------------------------------------------------------------
+// Batch Kernels
+//-----------------------------------------------------------------------------
+
+/// @brief  range end meaning "to the end of the batch"
+inline constexpr std::size_t kBatchEnd = static_cast< std::size_t >( -1 );
+
+namespace SoADetail {
+
+/// @brief  calls step( i, lane ) over [begin, end), a full register at a time and then
+///         one element at a time for the remainder
+template < typename T, typename Step >
+void ForEachLane( std::size_t begin, std::size_t end, Step&& step )
+{
+    std::size_t i = begin;
+    if constexpr ( SoALane< T >::kWidth > 1 )
+    {
+        for ( ; i + SoALane< T >::kWidth <= end; i += SoALane< T >::kWidth )
+            step( i, SoALane< T >{} );
+    }
+    for ( ; i < end; ++i )
+        step( i, ScalarLane< T >{} );
+}
+
+/// @brief  sums the squares of every component at i
+template < typename Lane, typename T, std::size_t N >
+typename Lane::Register LengthSq( VectorSoA< T, N > const& v, std::size_t i )
+{
+    typename Lane::Register sum = Lane::Set( 0 );
+    for ( std::size_t axis = 0; axis < N; ++axis )
+    {
+        const auto component = Lane::Load( v.Component( axis ) + i );
+        sum = Lane::Add( sum, Lane::Mul( component, component ) );
+    }
+    return sum;
+}
+
+/// @brief  multiplies every component at i by a per-element factor
+template < typename Lane, typename T, std::size_t N >
+void Scale( VectorSoA< T, N > const& v, typename Lane::Register factor, VectorSoA< T, N >& out, std::size_t i )
+{
+    for ( std::size_t axis = 0; axis < N; ++axis )
+        Lane::Store( out.Component( axis ) + i, Lane::Mul( Lane::Load( v.Component( axis ) + i ), factor ) );
+}
+
+} // namespace SoADetail
+
+/// @brief  out = a + b
+template < typename T, std::size_t N >
+void AddBatch( VectorSoA< T, N > const& a, VectorSoA< T, N > const& b, VectorSoA< T, N >& out,
+               std::size_t begin = 0, std::size_t end = kBatchEnd )
+{
+    end = ( std::min )( end, a.Size() );
+    for ( std::size_t axis = 0; axis < N; ++axis )
+    {
+        T const* pa = a.Component( axis );
+        T const* pb = b.Component( axis );
+        T* po = out.Component( axis );
+        SoADetail::ForEachLane< T >( begin, end, [ = ]( std::size_t i, auto lane )
+        {
+            using Lane = decltype( lane );
+            Lane::Store( po + i, Lane::Add( Lane::Load( pa + i ), Lane::Load( pb + i ) ) );
+        } );
+    }
+}
+
+/// @brief  out = a * s
+template < typename T, std::size_t N >
+void ScaleBatch( VectorSoA< T, N > const& a, T s, VectorSoA< T, N >& out,
+                 std::size_t begin = 0, std::size_t end = kBatchEnd )
+{
+    end = ( std::min )( end, a.Size() );
+    for ( std::size_t axis = 0; axis < N; ++axis )
+    {
+        T const* pa = a.Component( axis );
+        T* po = out.Component( axis );
+        SoADetail::ForEachLane< T >( begin, end, [ = ]( std::size_t i, auto lane )
+        {
+            using Lane = decltype( lane );
+            Lane::Store( po + i, Lane::Mul( Lane::Load( pa + i ), Lane::Set( s ) ) );
+        } );
+    }
+}
+
+/// @brief  out = a + b * s in one pass, e.g. position += velocity * dt
+template < typename T, std::size_t N >
+void MultiplyAddBatch( VectorSoA< T, N > const& a, VectorSoA< T, N > const& b, T s, VectorSoA< T, N >& out,
+                       std::size_t begin = 0, std::size_t end = kBatchEnd )
+{
+    end = ( std::min )( end, a.Size() );
+    for ( std::size_t axis = 0; axis < N; ++axis )
+    {
+        T const* pa = a.Component( axis );
+        T const* pb = b.Component( axis );
+        T* po = out.Component( axis );
+        SoADetail::ForEachLane< T >( begin, end, [ = ]( std::size_t i, auto lane )
+        {
+            using Lane = decltype( lane );
+            Lane::Store( po + i, Lane::Add( Lane::Load( pa + i ), Lane::Mul( Lane::Load( pb + i ), Lane::Set( s ) ) ) );
+        } );
+    }
+}
+
+/// @brief  out[ i ] = Dot( a[ i ], b[ i ] )
+/// @param  out the results, already sized like the inputs
+template < typename T, std::size_t N >
+void DotBatch( VectorSoA< T, N > const& a, VectorSoA< T, N > const& b, std::vector< T >& out,
+               std::size_t begin = 0, std::size_t end = kBatchEnd )
+{
+    end = ( std::min )( end, a.Size() );
+    T* po = out.data();
+    SoADetail::ForEachLane< T >( begin, end, [ & ]( std::size_t i, auto lane )
+    {
+        using Lane = decltype( lane );
+        typename Lane::Register sum = Lane::Set( 0 );
+        for ( std::size_t axis = 0; axis < N; ++axis )
+            sum = Lane::Add( sum, Lane::Mul( Lane::Load( a.Component( axis ) + i ), Lane::Load( b.Component( axis ) + i ) ) );
+        Lane::Store( po + i, sum );
+    } );
+}
+
+/// @brief  out[ i ] = Length( a[ i ] )
+/// @param  out the results, already sized like the input
+template < typename T, std::size_t N >
+void LengthBatch( VectorSoA< T, N > const& a, std::vector< T >& out,
+                  std::size_t begin = 0, std::size_t end = kBatchEnd )
+{
+    end = ( std::min )( end, a.Size() );
+    T* po = out.data();
+    SoADetail::ForEachLane< T >( begin, end, [ & ]( std::size_t i, auto lane )
+    {
+        using Lane = decltype( lane );
+        Lane::Store( po + i, Lane::Sqrt( SoADetail::LengthSq< Lane >( a, i ) ) );
+    } );
+}
+
+/// @brief  out = Normalize( a ); zero vectors stay zero
+template < typename T, std::size_t N >
+void NormalizeBatch( VectorSoA< T, N > const& a, VectorSoA< T, N >& out,
+                     std::size_t begin = 0, std::size_t end = kBatchEnd )
+{
+    end = ( std::min )( end, a.Size() );
+    SoADetail::ForEachLane< T >( begin, end, [ & ]( std::size_t i, auto lane )
+    {
+        using Lane = decltype( lane );
+        const auto inverse = Lane::SafeInverse( Lane::Sqrt( SoADetail::LengthSq< Lane >( a, i ) ) );
+        SoADetail::Scale< Lane >( a, inverse, out, i );
+    } );
+}
+
+/// @brief  out = a, shortened where needed so no vector is longer than maxLength (the
+///         usual truncation of steering forces and velocities)
+template < typename T, std::size_t N >
+void ClampLengthBatch( VectorSoA< T, N > const& a, T maxLength, VectorSoA< T, N >& out,
+                       std::size_t begin = 0, std::size_t end = kBatchEnd )
+{
+    end = ( std::min )( end, a.Size() );
+    SoADetail::ForEachLane< T >( begin, end, [ & ]( std::size_t i, auto lane )
+    {
+        using Lane = decltype( lane );
+        const auto length = Lane::Sqrt( SoADetail::LengthSq< Lane >( a, i ) );
+        const auto factor = Lane::Min( Lane::Set( 1 ), Lane::Mul( Lane::Set( maxLength ), Lane::SafeInverse( length ) ) );
+        SoADetail::Scale< Lane >( a, factor, out, i );
+    } );
+}
+
+/// @brief  out[ i ] = Length( a[ i ] - point )
+/// @param  out the results, already sized like the input
+template < typename T, std::size_t N >
+void DistanceToPointBatch( VectorSoA< T, N > const& a, Vector< T, N > const& point, std::vector< T >& out,
+                           std::size_t begin = 0, std::size_t end = kBatchEnd )
+{
+    end = ( std::min )( end, a.Size() );
+    T* po = out.data();
+    SoADetail::ForEachLane< T >( begin, end, [ & ]( std::size_t i, auto lane )
+    {
+        using Lane = decltype( lane );
+        typename Lane::Register sum = Lane::Set( 0 );
+        for ( std::size_t axis = 0; axis < N; ++axis )
+        {
+            const auto delta = Lane::Sub( Lane::Load( a.Component( axis ) + i ), Lane::Set( point[ axis ] ) );
+            sum = Lane::Add( sum, Lane::Mul( delta, delta ) );
+        }
+        Lane::Store( po + i, Lane::Sqrt( sum ) );
+    } );
+}
+
+#endif //VECTORSOA_H
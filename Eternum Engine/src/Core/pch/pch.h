@@ -32,6 +32,10 @@
 #include <thread>
 #include <cstdlib>
 #include <ctime>
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <mutex>
 
 
 #ifdef _WIN32
@@ -44,26 +48,40 @@
 #endif // ifdef _WIN32
 
 // Internal headers
+#include <Core/Strings/StringId.h>
+#include <Core/Logging/Logger.h>
 #include <Systems/system.h>
+#include <Core/Math/Simd.h>
 #include <Core/Vector/Vector.h>
 
 // Global utility functions
 
 inline unsigned GetUniqueId()
 {
-    static unsigned nextId = 0;
-    return nextId++;
+    static std::atomic<unsigned> nextId = 0;
+    return nextId.fetch_add(1, std::memory_order_relaxed);
 }
 
-inline std::string PrefixlessName(const std::type_index& type) {
-    const std::string name = type.name();
+// Strips the length prefix from a mangled type name; each type is parsed only once
+inline std::string const& PrefixlessName(const std::type_index& type) {
+    // never destroyed, since names may be printed during static destruction
+    static auto* names = new std::unordered_map<std::type_index, std::string>();
+    static std::mutex mutex;
 
-    size_t i = 0;
-    while (i < name.size() && std::isdigit(name[i])) {
-        ++i;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto const [it, inserted] = names->try_emplace(type);
+    if (inserted) {
+        const std::string name = type.name();
+
+        size_t i = 0;
+        while (i < name.size() && std::isdigit(static_cast<unsigned char>(name[i]))) {
+            ++i;
+        }
+
+        it->second = name.substr(i);
     }
 
-    return name.substr(i);
+    return it->second;
 }
 
 
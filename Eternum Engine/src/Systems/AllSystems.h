@@ -3,7 +3,8 @@
 * -----------------------------------------------------------------------------------------
 * File: AllSystems
 * Description:
-*     Includes all systems in the Eternum Engine for easy access.
+*     Includes all systems in the Eternum Engine for easy access, and lists them in
+*     update order for the SystemRegistry.
 *
 * Author:     Jax Clayton
 * Created:    8/2/2025
@@ -16,11 +17,22 @@
 #include <Systems/Input/InputSystem.h>
 #include <Systems/Grid System/GridSystem.h>
 #include <Systems/Dungeon System/DungeonSystem.h>
+#include <Systems/Transform System/TransformSystem.h>
 
 
 // Component Systems
 #include <Core/ECS/Component/Transform/Transform.h>
 
+/// @brief  every engine system, in the order the Runtime updates them; registered once
+///         by Runtime::Init
+using EngineSystems = SystemList<
+    InputSystem,
+    GridSystem,
+    DungeonSystem,
+    TransformSystem,
+    ComponentSystem< Component >,
+    ComponentSystem< Transform >
+>;
 
 
 #endif //ALLSYSTEMS_H
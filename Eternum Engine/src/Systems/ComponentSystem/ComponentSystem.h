@@ -37,7 +37,7 @@ class ComponentSystem : public System
 public:
     void Init() override
     {
-        std::cout << "Number of Components in system: " <<  GetComponents().size() << "\n";
+        ETERNUM_LOG_INFO("Number of Components in ", GetName(), ": ", GetComponents().size());
     }
     void Update(double deltaTime) override {};
     void FixedUpdate() override {};
@@ -118,5 +118,11 @@ inline ComponentSystem< ComponentType >* Components()
     return ComponentSystem< ComponentType >::GetInstance();
 }
 
-REGISTER_COMPONENT_SYSTEM(Component)
+/// @brief  reaches a ComponentSystem through Components(), since its constructor is private
+template< class ComponentType >
+struct SystemInstance< ComponentSystem< ComponentType > >
+{
+    static System* Get() { return Components< ComponentType >(); }
+};
+
 #endif //COMPONENTSYSTEM_H
@@ -12,6 +12,7 @@
 #include "DungeonSystem.h"
 #include <Systems/Input/Key/Key.h>
 #include <Systems/Input/InputSystem.h>
+#include <Core/Random/Random.h>
 
 // ----------------------------------------------------------------
 // Constructor
@@ -30,7 +31,7 @@ Dimension DungeonSystem::GetRandomRoomCenter() const
     if (m_Rooms.empty())
         return { -1, -1 }; // No valid rooms
 
-    static std::mt19937 rng(static_cast<unsigned>(time(nullptr)));
+    auto& rng = Rng()->GetEngine();
     std::uniform_int_distribution<size_t> dist(0, m_Rooms.size() - 1);
 
     const Room& chosen = m_Rooms[dist(rng)];
@@ -42,7 +43,7 @@ Dimension DungeonSystem::GetRandomRoomCenter() const
     if (m_Rooms.empty())
         return { -1, -1 };
 
-    static std::mt19937 rng(static_cast<unsigned>(time(nullptr)));
+    auto& rng = Rng()->GetEngine();
     std::uniform_int_distribution<size_t> roomDist(0, m_Rooms.size() - 1);
     const Room& chosen = m_Rooms[roomDist(rng)];
 
@@ -67,7 +68,7 @@ Dimension DungeonSystem::GetRandomRoomCenter() const
 
  Dimension DungeonSystem::GetRandomTileInRoom(const Room& room)
 {
-    static std::mt19937 rng(static_cast<unsigned>(time(nullptr)));
+    auto& rng = Rng()->GetEngine();
     std::uniform_int_distribution<int> xDist(room.m_X + 1, room.m_X + room.m_Width - 2);
     std::uniform_int_distribution<int> yDist(room.m_Y + 1, room.m_Y + room.m_Height - 2);
 
@@ -101,7 +102,7 @@ void DungeonSystem::Shutdown()
 
 void DungeonSystem::Update(double deltaTime)
 {
-    if (Input()->IsKeyPressed(Key::M))
+    if (Input()->IsActionPressed(Actions::GenerateDungeon))
     {
         GenerateRoomAndCorridor(40, 20, '.', '#');
         SendToGridSystem("GeneratedDungeon");
@@ -124,7 +125,7 @@ void DungeonSystem::GenerateRoomAndCorridor(int width, int height, char floorCha
     m_Rooms.clear();
 
     // Random generator
-    std::mt19937 rng(static_cast<unsigned>(time(nullptr)));
+    auto& rng = Rng()->GetEngine();
     std::uniform_int_distribution<int> roomWidthDist(4, 8);
     std::uniform_int_distribution<int> roomHeightDist(4, 8);
     std::uniform_int_distribution<int> posXDist(1, width - 10);
@@ -175,7 +176,7 @@ void DungeonSystem::GenerateCave(int width, int height, int smoothSteps)
     m_Height = height;
     m_CurrentGrid = GridSystem::Grid(width, height, '#'); // start all walls
 
-    std::mt19937 rng(static_cast<unsigned>(time(nullptr)));
+    auto& rng = Rng()->GetEngine();
     std::uniform_int_distribution<int> fillChance(0, 100);
 
     const int initialFillPercent = 45; // percentage of walls
@@ -249,7 +250,8 @@ int DungeonSystem::CountWallNeighbors(int gridX, int gridY) const
 }
 void DungeonSystem::SendToGridSystem(const std::string& mapName)
 {
-    GridSystem::GetInstance()->CreateMap(mapName, { m_Width, m_Height }, '#');
-    GridSystem::GetInstance()->AddMap(mapName, m_CurrentGrid);
-    GridSystem::GetInstance()->LoadMap(mapName);
+    const StringId id(mapName);
+    GridSystem::GetInstance()->CreateMap(id, { m_Width, m_Height }, '#');
+    GridSystem::GetInstance()->AddMap(id, m_CurrentGrid);
+    GridSystem::GetInstance()->LoadMap(id);
 }
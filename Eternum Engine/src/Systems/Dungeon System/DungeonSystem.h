@@ -14,7 +14,6 @@
 
 #include <pch.h>
 #include <Systems/system.h>
-#include <Systems/System Registry/SystemRegistry.h>
 #include <Systems/Grid System/GridSystem.h>
 
 #define Dimension GridSystem::Dimension
@@ -90,7 +89,4 @@ private:
     std::vector<Room> m_Rooms;
 };
 
-// Register the DungeonSystem with the SystemRegistry
-REGISTER_SYSTEM(DungeonSystem)
-
 #endif // DUNGEONSYSTEM_H
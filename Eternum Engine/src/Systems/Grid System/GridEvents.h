@@ -0,0 +1,31 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: GridEvents
+* Description:
+*     Events published by the GridSystem through the EventBus.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef GRIDEVENTS_H
+#define GRIDEVENTS_H
+
+/// @brief  a cell of the active map changed value
+struct CellChanged
+{
+    int m_X;
+    int m_Y;
+    char m_Previous;
+    char m_Value;
+};
+
+/// @brief  a different map became the active one
+struct GridMapLoaded
+{
+    int m_Width;
+    int m_Height;
+};
+
+#endif //GRIDEVENTS_H
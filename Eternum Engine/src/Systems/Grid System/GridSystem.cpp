@@ -14,13 +14,15 @@
 #include "GridSystem.h"
 #include <gtest/internal/gtest-internal.h>
 #include "Systems/Input/InputSystem.h"
+#include <Core/Events/EventBus.h>
+#include <Core/Random/Random.h>
 
 
 // --------------------------------------------------------
 // Constructor / Destructor
 // --------------------------------------------------------
 GridSystem::GridSystem()
-    :  System("Grid System") , m_activeMapName("")
+    :  System("Grid System")
 {
 }
 
@@ -41,24 +43,24 @@ void GridSystem::Update(double deltaTime)
 {
 
     // G Key to Generate a new map
-    if (Input()->IsKeyPressed(Key::G))
+    if (Input()->IsActionPressed(Actions::NewMap))
     {
         Dimension dim(50, 10); // Example dimensions
         CreateMap("NewMap", dim, '.');
         LoadMap("NewMap");
-        std::cout << "Created and loaded new map: NewMap" << std::endl;
+        ETERNUM_LOG_INFO("Created and loaded new map: NewMap");
     }
 
     // H to Generate a random map
-    if (Input()->IsKeyPressed(Key::H))
+    if (Input()->IsActionPressed(Actions::RandomMap))
     {
-        const auto width = 20 + rand() % 80; // Random width between 20 and 100
-        const auto height = 5 + rand() % 20; // Random height between 5 and 25
+        const auto width = Rng()->NextInt(20, 99); // Random width between 20 and 100
+        const auto height = Rng()->NextInt(5, 24); // Random height between 5 and 25
 
         const Dimension dim(width, height); // Example dimensions
         CreateMap("RandomMap", dim, '.');
         LoadMap("RandomMap");
-        std::cout << "Created and loaded random map: RandomMap" << std::endl;
+        ETERNUM_LOG_INFO("Created and loaded random map: RandomMap");
     }
 
 }
@@ -71,7 +73,7 @@ void GridSystem::FixedUpdate()
 void GridSystem::Render()
 {
     // nothing to draw or map invalid? skip
-    if (m_activeMapName.empty() ||
+    if (m_activeMapName.IsEmpty() ||
         m_maps.find(m_activeMapName) == m_maps.end() ||
         !m_needsRedraw)
     {
@@ -110,66 +112,82 @@ void GridSystem::Render()
 // --------------------------------------------------------
 // Map Management
 // --------------------------------------------------------
-void GridSystem::CreateMap(const std::string& name, const Dimension& dimensions, const char fill)
+void GridSystem::CreateMap(StringId name, const Dimension& dimensions, const char fill)
 {
     m_maps[name] = Grid(dimensions.m_Width, dimensions.m_Height, fill);
     MarkDirty();
 }
 
-void GridSystem::AddMap(const std::string& name, const Grid& map)
+void GridSystem::AddMap(StringId name, const Grid& map)
 {
     m_maps[name] = map;
 }
 
-bool GridSystem::LoadMap(const std::string& name)
+bool GridSystem::LoadMap(StringId name)
 {
     if (m_maps.find(name) == m_maps.end())
         return false;
 
     m_activeMapName = name;
+
+    Grid const& map = m_maps.at(name);
+    Events()->Publish(GridMapLoaded{ map.m_Dimension.m_Width, map.m_Dimension.m_Height });
     return true;
 }
 
-void GridSystem::DeleteMap(const std::string& name)
+void GridSystem::DeleteMap(StringId name)
 {
     m_maps.erase(name);
     if (m_activeMapName == name)
-        m_activeMapName.clear();
+        m_activeMapName = {};
     MarkDirty();
 }
 
 void GridSystem::ClearMaps()
 {
     m_maps.clear();
-    m_activeMapName.clear();
+    m_activeMapName = {};
     MarkDirty();
 }
 
 // --------------------------------------------------------
 // Cell Access
 // --------------------------------------------------------
+const GridSystem::Grid* GridSystem::GetActiveGrid() const
+{
+    auto const it = m_maps.find(m_activeMapName);
+    return it == m_maps.end() ? nullptr : &it->second;
+}
+
 int GridSystem::GetWidth() const
 {
-    if (m_activeMapName.empty()) return 0;
+    if (m_activeMapName.IsEmpty()) return 0;
     return m_maps.at(m_activeMapName).m_Dimension.m_Width;
 }
 
 int GridSystem::GetHeight() const
 {
-    if (m_activeMapName.empty()) return 0;
+    if (m_activeMapName.IsEmpty()) return 0;
     return m_maps.at(m_activeMapName).m_Dimension.m_Height;
 }
 
 char GridSystem::GetCell(const int x, const int y) const
 {
-    if (m_activeMapName.empty()) return ' ';
+    if (m_activeMapName.IsEmpty()) return ' ';
     return m_maps.at(m_activeMapName).GetCell(x, y);
 }
 
 void GridSystem::SetCell(const int x, const int y, const char value)
 {
-    if (m_activeMapName.empty()) return;
-    m_maps.at(m_activeMapName).SetCell(x, y, value);
+    if (m_activeMapName.IsEmpty()) return;
+
+    Grid& map = m_maps.at(m_activeMapName);
+    const char previous = map.GetCell(x, y);
+    map.SetCell(x, y, value);
     MarkDirty();
+
+    // out-of-bounds writes are ignored by the grid, so only report real changes
+    if (previous != value && map.GetCell(x, y) == value)
+        Events()->Publish(CellChanged{ x, y, previous, value });
 }
 
@@ -13,6 +13,8 @@
 #define GRIDSYSTEM_H
 
 #include <Systems/system.h>
+#include <Systems/Grid System/GridEvents.h>
+#include <Core/Strings/StringId.h>
 
 class GridSystem final : public System
 {
@@ -64,13 +66,19 @@ public:
     void FixedUpdate() override;
     void Render() override;
 
-    // Map management
-    void CreateMap(const std::string& name, const Dimension& dimensions, char fill = '.');
-    void AddMap(const std::string& name, const Grid& map);
-    bool LoadMap(const std::string& name);
-    void DeleteMap(const std::string& name);
+    // Map management, keyed by interned name
+    void CreateMap(StringId name, const Dimension& dimensions, char fill = '.');
+    void AddMap(StringId name, const Grid& map);
+    bool LoadMap(StringId name);
+    void DeleteMap(StringId name);
     void ClearMaps();
 
+    // name of the active map (empty when none is loaded)
+    StringId GetActiveMap() const { return m_activeMapName; }
+
+    // the active map, or nullptr when none is loaded
+    const Grid* GetActiveGrid() const;
+
     // whenever anything mutates the grid
     void MarkDirty() { m_needsRedraw = true; }
 
@@ -78,6 +86,8 @@ public:
     int GetWidth() const;
     int GetHeight() const;
     char GetCell(int x, int y) const;
+
+    // publishes CellChanged when the value actually changes
     void SetCell(int x, int y, char value);
 
     // Console Commands
@@ -108,11 +118,10 @@ public:
     }
 
 private:
-    std::unordered_map<std::string, Grid> m_maps;
-    std::string m_activeMapName;
+    std::unordered_map<StringId, Grid> m_maps;
+    StringId m_activeMapName;
     bool m_needsRedraw = true;
 };
 
-REGISTER_SYSTEM(GridSystem)
 
 #endif //GRIDSYSTEM_H
@@ -0,0 +1,27 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: InputActions
+* Description:
+*       Names of the game actions the engine's systems respond to. Systems ask the
+*       InputSystem about actions rather than keys, so keys can be rebound freely.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+
+#ifndef INPUTACTIONS_H
+#define INPUTACTIONS_H
+
+#include <pch.h>
+
+namespace Actions
+{
+    inline constexpr StringId Exit( "Exit" );
+    inline constexpr StringId NewMap( "NewMap" );
+    inline constexpr StringId RandomMap( "RandomMap" );
+    inline constexpr StringId GenerateDungeon( "GenerateDungeon" );
+}
+
+#endif //INPUTACTIONS_H
@@ -0,0 +1,65 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: InputSource
+* Description:
+*       Implements the scripted input source and loading of recorded input.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+
+#include <pch.h>
+#include "InputSource.h"
+#include <fstream>
+
+void ScriptedInputSource::Add( uint64_t frame, Key key )
+{
+    m_Keys.push_back( { frame, key } );
+}
+
+std::unique_ptr< ScriptedInputSource > ScriptedInputSource::Load( std::string const& path )
+{
+    std::ifstream file( path );
+    if ( !file )
+    {
+        ETERNUM_LOG_ERROR( "cannot open input recording \"", path, "\"" );
+        return nullptr;
+    }
+
+    auto source = std::make_unique< ScriptedInputSource >();
+    uint64_t frame = 0;
+    int key = 0;
+    while ( file >> frame >> key )
+    {
+        if ( !source->m_Keys.empty() && frame < source->m_Keys.back().m_Frame )
+        {
+            ETERNUM_LOG_ERROR( "input recording \"", path, "\" goes back in time at frame ", frame );
+            return nullptr;
+        }
+        source->Add( frame, static_cast< Key >( key ) );
+    }
+
+    if ( !file.eof() )
+    {
+        ETERNUM_LOG_ERROR( "input recording \"", path, "\" is malformed" );
+        return nullptr;
+    }
+    return source;
+}
+
+void ScriptedInputSource::BeginFrame()
+{
+    ++m_Frame;
+}
+
+bool ScriptedInputSource::Poll( KeyEvent& event )
+{
+    if ( m_Next == m_Keys.size() || m_Keys[ m_Next ].m_Frame != m_Frame )
+        return false;
+
+    event = { m_Keys[ m_Next ].m_Key, 0 };
+    ++m_Next;
+    return true;
+}
@@ -0,0 +1,91 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: InputSource
+* Description:
+*       Where the InputSystem gets its key events from. The terminal is one source; a
+*       scripted source replays keys on given frames, so tests and headless benchmarks
+*       can drive the game at full speed, and it can be loaded from a recorded file.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+
+#ifndef INPUTSOURCE_H
+#define INPUTSOURCE_H
+
+#include <pch.h>
+#include <Systems/Input/Key/Key.h>
+
+/// @brief  one key read from an input source
+struct KeyEvent
+{
+    Key m_Key;
+
+    /// @brief  when the key was read, in steady_clock nanoseconds (0 for scripted keys)
+    int64_t m_Time;
+};
+
+class InputSource
+{
+public:
+    virtual ~InputSource() = default;
+
+    /// @brief  starts producing events, e.g. by opening a device
+    /// @return whether the source started
+    virtual bool Start() { return true; }
+
+    /// @brief  stops producing events and releases whatever Start acquired
+    virtual void Stop() {}
+
+    /// @brief  called once at the start of every frame, before the frame's events are polled
+    virtual void BeginFrame() {}
+
+    /// @brief  takes the next event of the current frame
+    /// @param  event   receives the event
+    /// @return whether there was an event; false ends the frame's input
+    virtual bool Poll( KeyEvent& event ) = 0;
+};
+
+/// @brief  replays keys on fixed frames
+class ScriptedInputSource final : public InputSource
+{
+public:
+    ScriptedInputSource() = default;
+
+    /// @brief  schedules a key
+    /// @param  frame   the frame the key is read on, counting the first BeginFrame as 0
+    /// @param  key     the key
+    /// @note   keys must be added in non-decreasing frame order
+    void Add( uint64_t frame, Key key );
+
+    /// @brief  loads a recording of "frame key-code" lines
+    /// @param  path    the file to load
+    /// @return the source, or nullptr if the file cannot be read or is malformed
+    static std::unique_ptr< ScriptedInputSource > Load( std::string const& path );
+
+    void BeginFrame() override;
+    bool Poll( KeyEvent& event ) override;
+
+    /// @brief  gets whether every scheduled key has been read
+    bool IsFinished() const { return m_Next == m_Keys.size(); }
+
+    /// @brief  gets the frame being read (the number of BeginFrame calls minus one)
+    uint64_t GetFrame() const { return m_Frame; }
+
+private:
+    struct ScheduledKey
+    {
+        uint64_t m_Frame;
+        Key m_Key;
+    };
+
+    std::vector< ScheduledKey > m_Keys;
+    std::size_t m_Next = 0;
+
+    /// @brief  starts one before frame 0 so the first BeginFrame moves to it
+    uint64_t m_Frame = ~uint64_t{ 0 };
+};
+
+#endif //INPUTSOURCE_H
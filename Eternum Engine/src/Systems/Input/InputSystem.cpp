@@ -12,96 +12,166 @@
 #include <pch.h>
 #include "InputSystem.h"
 #include <Core/Runtime/Runtime.h>
+#include <Systems/Input/TerminalReader.h>
 
 InputSystem::InputSystem()
   : System("Input System")
-{}
+  , m_Source(std::make_unique<TerminalReader>())
+{
+    BindAction(Actions::Exit, Key::ESC);
+    BindAction(Actions::NewMap, Key::G);
+    BindAction(Actions::RandomMap, Key::H);
+    BindAction(Actions::GenerateDungeon, Key::M);
+}
+
+void InputSystem::Init()
+{
+    System::Init();
+    m_Source->Start();
+    m_IsRunning = true;
+}
 
-void InputSystem::Init()    { System::Init(); }
 void InputSystem::FixedUpdate() {}
 void InputSystem::Render()  {}
-void InputSystem::Shutdown(){ System::Shutdown(); }
+
+void InputSystem::Shutdown()
+{
+    m_Source->Stop();
+    m_IsRunning = false;
+    System::Shutdown();
+}
 
 void InputSystem::Update(double dt)
 {
-    // Copy current state to previous state
-    m_PreviousState = m_CurrentState;
+    // Only keys read since the last frame count as down; every key of a burst is kept
+    m_Previous = m_Current;
+    m_Current.reset();
+    m_LastKey = Key::INVALID;
 
-    // Check for a key press this frame
-    const Key pressedKey = KeyPressed();
-    if (pressedKey != Key::INVALID && pressedKey != Key::UNKNOWN)
+    m_Source->BeginFrame();
+    KeyEvent event;
+    while (m_Source->Poll(event))
     {
-        m_CurrentState[pressedKey] = true;
+        const std::size_t bit = keyBit(event.m_Key);
+        if (bit == kKeyCount)
+            continue;
+
+        m_Current.set(bit);
+        m_LastKey = event.m_Key;
     }
-    else
+
+    const KeySet changed = m_Current ^ m_Previous;
+    m_Pressed = changed & m_Current;
+    m_Released = changed & m_Previous;
+
+    if (IsActionPressed(Actions::Exit))
+    {
+        ETERNUM_LOG_INFO("Exiting...");
+        RuntimeSystem()->Stop();
+    }
+}
+
+// --------------------------------------------------------
+// Key State
+// --------------------------------------------------------
+
+bool InputSystem::IsKeyPressed(const Key key) const
+{
+    // Key was not down the last frame but is down this frame
+    return test(m_Pressed, key);
+}
+
+bool InputSystem::IsKeyDown(const Key key) const
+{
+    // Key is currently down this frame
+    return test(m_Current, key);
+}
+
+bool InputSystem::IsKeyReleased(const Key key) const
+{
+    // Key was down the last frame but is not down this frame
+    return test(m_Released, key);
+}
+
+std::size_t InputSystem::keyBit(const Key key)
+{
+    const int code = static_cast<int>(key);
+    return code >= 0 && code < static_cast<int>(kKeyCount) ? static_cast<std::size_t>(code) : kKeyCount;
+}
+
+bool InputSystem::test(KeySet const& keys, const Key key)
+{
+    if (key == Key::ANY)
+        return keys.any();
+
+    const std::size_t bit = keyBit(key);
+    return bit != kKeyCount && keys.test(bit);
+}
+
+// --------------------------------------------------------
+// Actions
+// --------------------------------------------------------
+
+void InputSystem::BindAction(StringId action, const Key key)
+{
+    const std::size_t bit = keyBit(key);
+    if (bit == kKeyCount)
     {
-        // Reset keys not pressed in this frame
-        m_CurrentState.clear();
+        ETERNUM_LOG_WARNING("cannot bind key ", key, " to action \"", action, "\"");
+        return;
     }
 
-    if (IsKeyPressed(Key::ESC))
+    for (auto& [id, keys] : m_Actions)
     {
-        std::cout << "Exiting..." << std::endl;
-        RuntimeSystem()->Stop();
+        if (id == action)
+        {
+            keys.set(bit);
+            return;
+        }
     }
+
+    KeySet keys;
+    keys.set(bit);
+    m_Actions.emplace_back(action, keys);
 }
-//— read, normalize, log, return
-Key InputSystem::KeyPressed()
+
+void InputSystem::UnbindAction(StringId action)
 {
-    int raw = -1;
-
-#ifdef _WIN32
-    if (!_kbhit()) return Key::INVALID;
-    raw = _getch();
-#else
-    termios orig, mod;
-    int flags;
-
-    // save & set noncanonical, no-echo
-    tcgetattr(STDIN_FILENO, &orig);
-    mod = orig;
-    mod.c_lflag &= ~(ICANON|ECHO);
-    tcsetattr(STDIN_FILENO, TCSANOW, &mod);
-
-    // nonblocking
-    flags = fcntl(STDIN_FILENO, F_GETFL, 0);
-    fcntl(STDIN_FILENO, F_SETFL, flags | O_NONBLOCK);
-
-    raw = getchar();
-
-    // restore
-    tcsetattr(STDIN_FILENO, TCSANOW, &orig);
-    fcntl(STDIN_FILENO, F_SETFL, flags);
-
-    if (raw == EOF) return Key::UNKNOWN;
-#endif
-    const Key k = NormalizeKey(raw);
-    MapKey(k);
-    return k;
+    std::erase_if(m_Actions, [action](auto const& binding) { return binding.first == action; });
 }
 
-Key InputSystem::NormalizeKey(int raw)
+bool InputSystem::IsActionPressed(StringId action) const
 {
-    // turn a–z into A–Z
-    if (raw >= 'a' && raw <= 'z')
-        raw -= ('a' - 'A');
-    return static_cast<Key>(raw);
+    KeySet const* keys = findAction(action);
+    return keys != nullptr && (*keys & m_Pressed).any();
 }
 
-char InputSystem::MapKey(Key k)
+bool InputSystem::IsActionDown(StringId action) const
 {
-    const char c = static_cast<char>(static_cast<int>(k));
-    return c;
+    KeySet const* keys = findAction(action);
+    return keys != nullptr && (*keys & m_Current).any();
 }
 
-bool InputSystem::IsKeyPressed(const Key key)
+InputSystem::KeySet const* InputSystem::findAction(StringId action) const
 {
-    // Key was not down the last frame but is down this frame
-    return m_CurrentState[key] && !m_PreviousState[key];
+    for (auto const& [id, keys] : m_Actions)
+        if (id == action)
+            return &keys;
+    return nullptr;
 }
 
-bool InputSystem::IsKeyDown(const Key key)
+// --------------------------------------------------------
+// Input Sources
+// --------------------------------------------------------
+
+std::unique_ptr<InputSource> InputSystem::SetSource(std::unique_ptr<InputSource> source)
 {
-    // Key is currently down this frame
-    return m_CurrentState[key];
-}
\ No newline at end of file
+    if (m_IsRunning && m_Source)
+        m_Source->Stop();
+
+    std::swap(m_Source, source);
+
+    if (m_IsRunning && m_Source)
+        m_Source->Start();
+    return source;
+}
@@ -15,10 +15,18 @@
 #pragma once
 #include <Systems/system.h>
 #include <Systems/Input/Key/Key.h>
+#include <Systems/Input/InputSource.h>
+#include <Systems/Input/InputActions.h>
+#include <bitset>
 
 class InputSystem final : public System
 {
 public:
+    /// @brief  number of key codes tracked; every Key below this has a bit
+    static constexpr std::size_t kKeyCount = 256;
+
+    using KeySet = std::bitset< kKeyCount >;
+
     static std::shared_ptr<InputSystem> GetInstance()
     {
         static std::shared_ptr<InputSystem> instance(new InputSystem());
@@ -31,26 +39,74 @@ public:
     void Render() override;
     void Shutdown() override;
 
-    /// @return last key read, or INVALID/UNKNOWN if none
-    static Key KeyPressed();
+    /// @return last key read this frame, or INVALID if none
+    Key KeyPressed() const { return m_LastKey; }
+
+    /// @return true on the frame the key first goes down (Key::ANY for any key)
+    bool IsKeyPressed(Key key = Key::ANY) const;
+
+    /// @return true as long as the key stays down (Key::ANY for any key)
+    bool IsKeyDown(Key key = Key::ANY) const;
+
+    /// @return true on the frame the key goes back up (Key::ANY for any key)
+    bool IsKeyReleased(Key key = Key::ANY) const;
+
+//-----------------------------------------------------------------------------
+// Actions
+//-----------------------------------------------------------------------------
+
+    /// @brief  binds a key to an action; an action may have several keys
+    /// @param  action  the action
+    /// @param  key     the key that triggers it
+    void BindAction(StringId action, Key key);
+
+    /// @brief  removes every key bound to an action
+    void UnbindAction(StringId action);
 
-    /// @return true on the frame the key first goes down
-    bool    IsKeyPressed(Key key = Key::UNKNOWN);
+    /// @return true on the frame any key bound to the action first goes down
+    bool IsActionPressed(StringId action) const;
 
-    /// @return true as long as the key stays down
-    bool IsKeyDown(Key key = Key::UNKNOWN);
+    /// @return true as long as any key bound to the action stays down
+    bool IsActionDown(StringId action) const;
+
+//-----------------------------------------------------------------------------
+// Input Sources
+//-----------------------------------------------------------------------------
+
+    /// @brief  replaces where key events come from (the terminal by default)
+    /// @param  source  the new source; started right away if the system is running
+    /// @return the previous source, already stopped
+    std::unique_ptr<InputSource> SetSource(std::unique_ptr<InputSource> source);
+
+    /// @brief  gets the current input source
+    InputSource* GetSource() const { return m_Source.get(); }
 
 private:
     explicit InputSystem();
 
-    /// map raw int → uppercase Key
-    static Key  NormalizeKey(int raw);
+    /// @brief  gets the bit of a key, or kKeyCount if it has none
+    static std::size_t keyBit(Key key);
+
+    /// @brief  tests a key (or Key::ANY) against a set
+    static bool test(KeySet const& keys, Key key);
+
+    /// @brief  gets the keys bound to an action, or nullptr if it has none
+    KeySet const* findAction(StringId action) const;
+
+    // key state this frame and last frame; edges are found by XOR
+    KeySet m_Current;
+    KeySet m_Previous;
+    KeySet m_Pressed;
+    KeySet m_Released;
+
+    // keys bound to each action; a short flat list, searched linearly
+    std::vector<std::pair<StringId, KeySet>> m_Actions;
 
-    /// log it and return the char
-    static char MapKey(Key k);
+    std::unique_ptr<InputSource> m_Source;
+    bool m_IsRunning = false;
 
-    std::unordered_map<Key, bool> m_CurrentState;
-    std::unordered_map<Key, bool> m_PreviousState;
+    // last key read this frame
+    Key m_LastKey = Key::INVALID;
 };
 
 static InputSystem* Input()
@@ -58,7 +114,5 @@ static InputSystem* Input()
     return InputSystem::GetInstance().get();
 }
 
-// Register the InputSystem with the SystemRegistry
-REGISTER_SYSTEM(InputSystem)
 
 #endif //INPUTSYSTEM_H
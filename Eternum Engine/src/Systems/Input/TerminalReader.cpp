@@ -0,0 +1,364 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: TerminalReader
+* Description:
+*       Implements escape-sequence decoding and the terminal reader thread.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+
+#include <pch.h>
+#include "TerminalReader.h"
+#include <cerrno>
+
+#ifndef _WIN32
+    #include <poll.h>
+#endif
+
+namespace {
+
+/// @brief  key events held between frames before new ones are dropped
+constexpr std::size_t kEventCapacity = 256;
+
+/// @brief  how long to wait for the rest of an escape sequence before treating the
+///         escape as a key of its own
+constexpr int kEscapeTimeoutMs = 25;
+
+constexpr unsigned char kEscape = 27;
+
+int64_t now()
+{
+    return std::chrono::duration_cast< std::chrono::nanoseconds >(
+        std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+// TerminalKeyParser
+//-----------------------------------------------------------------------------
+
+Key TerminalKeyParser::Feed( unsigned char byte )
+{
+    switch ( m_State )
+    {
+        case State::Ground:
+            if ( byte == kEscape )
+            {
+                m_State = State::Escape;
+                return Key::INVALID;
+            }
+            return FromByte( byte );
+
+        case State::Escape:
+            if ( byte == '[' )
+            {
+                m_State = State::Csi;
+                m_Param = 0;
+                m_InFirstParam = true;
+                return Key::INVALID;
+            }
+            if ( byte == 'O' )
+            {
+                m_State = State::Ss3;
+                return Key::INVALID;
+            }
+            if ( byte == kEscape )
+                return Key::ESC; // the first escape stood alone; the second may start a sequence
+
+            m_State = State::Ground;
+            return FromByte( byte );
+
+        case State::Csi:
+            if ( byte == '[' && m_InFirstParam && m_Param == 0 )
+            {
+                m_State = State::LinuxFn;
+                return Key::INVALID;
+            }
+            if ( byte >= '0' && byte <= '9' )
+            {
+                if ( m_InFirstParam )
+                    m_Param = m_Param * 10 + ( byte - '0' );
+                return Key::INVALID;
+            }
+            if ( byte >= 0x20 && byte <= 0x3F )
+            {
+                // ';' and other intermediates end the first parameter (modifiers are ignored)
+                m_InFirstParam = false;
+                return Key::INVALID;
+            }
+            m_State = State::Ground;
+            return finishCsi( byte );
+
+        case State::Ss3:
+            m_State = State::Ground;
+            switch ( byte )
+            {
+                case 'A': return Key::ARROW_UP;
+                case 'B': return Key::ARROW_DOWN;
+                case 'C': return Key::ARROW_RIGHT;
+                case 'D': return Key::ARROW_LEFT;
+                case 'H': return Key::HOME;
+                case 'F': return Key::END;
+                case 'P': return Key::F1;
+                case 'Q': return Key::F2;
+                case 'R': return Key::F3;
+                case 'S': return Key::F4;
+                default:  return Key::INVALID;
+            }
+
+        case State::LinuxFn:
+            m_State = State::Ground;
+            if ( byte >= 'A' && byte <= 'E' )
+                return static_cast< Key >( static_cast< int >( Key::F1 ) + ( byte - 'A' ) );
+            return Key::INVALID;
+    }
+    return Key::INVALID;
+}
+
+Key TerminalKeyParser::Flush()
+{
+    const bool loneEscape = m_State == State::Escape;
+    m_State = State::Ground;
+    return loneEscape ? Key::ESC : Key::INVALID;
+}
+
+Key TerminalKeyParser::FromByte( unsigned char byte )
+{
+    switch ( byte )
+    {
+        case '\n':  return Key::ENTER;  // Enter arrives as '\n' while ICRNL is on
+        case 127:   return Key::BACKSPACE;
+        default:    break;
+    }
+
+    // bytes of UTF-8 and other 8-bit input would land on the extended Key values
+    if ( byte >= 128 )
+        return Key::INVALID;
+
+    // turn a–z into A–Z
+    if ( byte >= 'a' && byte <= 'z' )
+        byte -= ( 'a' - 'A' );
+    return static_cast< Key >( byte );
+}
+
+Key TerminalKeyParser::finishCsi( unsigned char final ) const
+{
+    switch ( final )
+    {
+        case 'A': return Key::ARROW_UP;
+        case 'B': return Key::ARROW_DOWN;
+        case 'C': return Key::ARROW_RIGHT;
+        case 'D': return Key::ARROW_LEFT;
+        case 'H': return Key::HOME;
+        case 'F': return Key::END;
+        case 'P': return Key::F1;   // modified F1-F4, e.g. ESC [ 1 ; 2 P
+        case 'Q': return Key::F2;
+        case 'R': return Key::F3;
+        case 'S': return Key::F4;
+        case '~': break;
+        default:  return Key::INVALID;
+    }
+
+    switch ( m_Param )
+    {
+        case 1: case 7:     return Key::HOME;
+        case 2:             return Key::INSERT;
+        case 3:             return Key::DELETE_KEY;
+        case 4: case 8:     return Key::END;
+        case 5:             return Key::PAGE_UP;
+        case 6:             return Key::PAGE_DOWN;
+        case 11:            return Key::F1;
+        case 12:            return Key::F2;
+        case 13:            return Key::F3;
+        case 14:            return Key::F4;
+        case 15:            return Key::F5;
+        case 17:            return Key::F6;
+        case 18:            return Key::F7;
+        case 19:            return Key::F8;
+        case 20:            return Key::F9;
+        case 21:            return Key::F10;
+        case 23:            return Key::F11;
+        case 24:            return Key::F12;
+        default:            return Key::INVALID;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// TerminalReader
+//-----------------------------------------------------------------------------
+
+TerminalReader::TerminalReader() :
+    m_Events( kEventCapacity )
+{}
+
+TerminalReader::~TerminalReader()
+{
+    Stop();
+}
+
+bool TerminalReader::Start()
+{
+    if ( m_Running )
+        return true;
+
+#ifndef _WIN32
+    if ( pipe( m_WakePipe ) != 0 )
+    {
+        ETERNUM_LOG_ERROR( "TerminalReader: cannot create wake pipe" );
+        return false;
+    }
+
+    // raw mode once for the whole run; without a terminal (e.g. piped input) keys are
+    // still read, just line-buffered by whatever feeds stdin
+    if ( isatty( STDIN_FILENO ) && tcgetattr( STDIN_FILENO, &m_Original ) == 0 )
+    {
+        termios raw = m_Original;
+        raw.c_lflag &= ~( ICANON | ECHO );
+        raw.c_cc[ VMIN ] = 1;
+        raw.c_cc[ VTIME ] = 0;
+        m_IsRaw = tcsetattr( STDIN_FILENO, TCSANOW, &raw ) == 0;
+    }
+#endif
+
+    m_Stopping = false;
+    m_Thread = std::thread( [ this ] { readLoop(); } );
+    m_Running = true;
+    return true;
+}
+
+void TerminalReader::Stop()
+{
+    if ( !m_Running )
+        return;
+
+    m_Stopping = true;
+#ifndef _WIN32
+    const char wake = 0;
+    [[maybe_unused]] const auto written = write( m_WakePipe[ 1 ], &wake, 1 );
+#endif
+    m_Thread.join();
+    m_Running = false;
+
+#ifndef _WIN32
+    close( m_WakePipe[ 0 ] );
+    close( m_WakePipe[ 1 ] );
+    m_WakePipe[ 0 ] = m_WakePipe[ 1 ] = -1;
+
+    if ( m_IsRaw )
+    {
+        tcsetattr( STDIN_FILENO, TCSANOW, &m_Original );
+        m_IsRaw = false;
+    }
+#endif
+}
+
+void TerminalReader::push( Key key )
+{
+    if ( key == Key::INVALID )
+        return;
+
+    if ( !m_Events.TryPush( { key, now() } ) )
+        m_Dropped.fetch_add( 1, std::memory_order_relaxed );
+}
+
+#ifdef _WIN32
+
+void TerminalReader::readLoop()
+{
+    while ( !m_Stopping )
+    {
+        if ( !_kbhit() )
+        {
+            std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+            continue;
+        }
+
+        const int raw = _getch();
+        if ( raw != 0 && raw != 0xE0 )
+        {
+            push( TerminalKeyParser::FromByte( static_cast< unsigned char >( raw ) ) );
+            continue;
+        }
+
+        // extended keys arrive as a prefix followed by a scan code; F1-F10 use the 0 prefix
+        switch ( _getch() )
+        {
+            case 59:  push( Key::F1 );          break;
+            case 60:  push( Key::F2 );          break;
+            case 61:  push( Key::F3 );          break;
+            case 62:  push( Key::F4 );          break;
+            case 63:  push( Key::F5 );          break;
+            case 64:  push( Key::F6 );          break;
+            case 65:  push( Key::F7 );          break;
+            case 66:  push( Key::F8 );          break;
+            case 67:  push( Key::F9 );          break;
+            case 68:  push( Key::F10 );         break;
+            case 72:  push( Key::ARROW_UP );    break;
+            case 80:  push( Key::ARROW_DOWN );  break;
+            case 75:  push( Key::ARROW_LEFT );  break;
+            case 77:  push( Key::ARROW_RIGHT ); break;
+            case 71:  push( Key::HOME );        break;
+            case 79:  push( Key::END );         break;
+            case 73:  push( Key::PAGE_UP );     break;
+            case 81:  push( Key::PAGE_DOWN );   break;
+            case 82:  push( Key::INSERT );      break;
+            case 83:  push( Key::DELETE_KEY );  break;
+            case 133: push( Key::F11 );         break;
+            case 134: push( Key::F12 );         break;
+            default:
+                break;
+        }
+    }
+}
+
+#else
+
+void TerminalReader::readLoop()
+{
+    TerminalKeyParser parser;
+    unsigned char bytes[ 64 ];
+
+    pollfd fds[ 2 ] = {
+        { STDIN_FILENO, POLLIN, 0 },
+        { m_WakePipe[ 0 ], POLLIN, 0 }
+    };
+
+    while ( !m_Stopping )
+    {
+        // block until input arrives; with half an escape sequence read, only wait a moment
+        // for the rest before taking the escape as a key of its own
+        const int ready = poll( fds, 2, parser.HasPending() ? kEscapeTimeoutMs : -1 );
+        if ( ready < 0 )
+        {
+            if ( errno == EINTR )
+                continue;
+            break;
+        }
+        if ( ready == 0 )
+        {
+            push( parser.Flush() );
+            continue;
+        }
+        if ( fds[ 1 ].revents != 0 )
+            break;
+        if ( ( fds[ 0 ].revents & ( POLLIN | POLLHUP ) ) == 0 )
+            continue;
+
+        const ssize_t count = read( STDIN_FILENO, bytes, sizeof( bytes ) );
+        if ( count <= 0 )
+        {
+            // stdin closed; nothing more will arrive
+            push( parser.Flush() );
+            break;
+        }
+
+        for ( ssize_t i = 0; i < count; ++i )
+            push( parser.Feed( bytes[ i ] ) );
+    }
+}
+
+#endif
@@ -0,0 +1,123 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: TerminalReader
+* Description:
+*       Reads the keyboard on a dedicated thread. The terminal is switched to raw mode
+*       once when the reader starts and restored when it stops; the thread blocks until
+*       input arrives, decodes multi-byte escape sequences into Keys and queues them as
+*       timestamped events for the InputSystem to drain once per frame.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+
+#ifndef TERMINALREADER_H
+#define TERMINALREADER_H
+
+#include <pch.h>
+#include <Systems/Input/Key/Key.h>
+#include <Systems/Input/InputSource.h>
+#include <Core/Events/MpmcQueue.h>
+
+/// @brief  turns the bytes a terminal sends into Keys, one byte at a time
+class TerminalKeyParser
+{
+public:
+    /// @brief  feeds the next byte
+    /// @param  byte    the byte read from the terminal
+    /// @return the Key the byte completes, or Key::INVALID while a sequence is still
+    ///         open or if the sequence is not recognised
+    /// @note   an escape followed by a printable byte (Alt+key) yields just that key
+    Key Feed( unsigned char byte );
+
+    /// @brief  ends an unfinished sequence, e.g. when no more bytes follow an escape
+    /// @return Key::ESC for a lone escape, otherwise Key::INVALID
+    Key Flush();
+
+    /// @brief  gets whether an escape sequence has been started but not finished
+    bool HasPending() const { return m_State != State::Ground; }
+
+    /// @brief  maps a single byte outside of any sequence to a Key (letters are upper-cased)
+    /// @return Key::INVALID for bytes of 128 and above
+    static Key FromByte( unsigned char byte );
+
+private:
+    enum class State : uint8_t
+    {
+        Ground,     // plain bytes
+        Escape,     // after ESC
+        Csi,        // after ESC [
+        Ss3,        // after ESC O
+        LinuxFn     // after ESC [ [ (Linux console F1-F5)
+    };
+
+    /// @brief  maps a finished CSI sequence to a Key
+    Key finishCsi( unsigned char final ) const;
+
+    State m_State = State::Ground;
+
+    /// @brief  first numeric parameter of the current CSI sequence
+    int m_Param = 0;
+
+    /// @brief  whether the first parameter is still being read
+    bool m_InFirstParam = true;
+};
+
+class TerminalReader final : public InputSource
+{
+public:
+    TerminalReader();
+
+    /// @brief  destructor, stops the reader if it is running
+    ~TerminalReader() override;
+
+    // Prevent copy construction and assignment
+    TerminalReader( TerminalReader const& ) = delete;
+    TerminalReader& operator=( TerminalReader const& ) = delete;
+
+    /// @brief  switches the terminal to raw mode and starts the reader thread
+    /// @return whether the reader started
+    bool Start() override;
+
+    /// @brief  stops the reader thread and restores the terminal
+    void Stop() override;
+
+    /// @brief  gets whether the reader thread is running
+    bool IsRunning() const { return m_Running; }
+
+    /// @brief  takes the next key event queued by the reader thread
+    /// @param  event   receives the event
+    /// @return whether there was an event
+    bool Poll( KeyEvent& event ) override { return m_Events.TryPop( event ); }
+
+    /// @brief  gets the number of key events dropped because the queue was full
+    uint64_t GetDroppedCount() const { return m_Dropped.load( std::memory_order_relaxed ); }
+
+private:
+    /// @brief  main loop of the reader thread
+    void readLoop();
+
+    /// @brief  queues a key read from the terminal
+    void push( Key key );
+
+    /// @brief  events read but not yet drained
+    MpmcQueue< KeyEvent > m_Events;
+
+    std::atomic< uint64_t > m_Dropped = 0;
+    std::atomic< bool > m_Stopping = false;
+    bool m_Running = false;
+    std::thread m_Thread;
+
+#ifndef _WIN32
+    /// @brief  terminal settings to restore, valid when m_IsRaw is set
+    termios m_Original = {};
+    bool m_IsRaw = false;
+
+    /// @brief  self-pipe that wakes the reader out of poll() when stopping
+    int m_WakePipe[ 2 ] = { -1, -1 };
+#endif
+};
+
+#endif //TERMINALREADER_H
@@ -0,0 +1,365 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: DistanceField
+* Description:
+*     Implements Dijkstra maps and clearance transforms.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+
+#include <pch.h>
+#include "DistanceField.h"
+#include <Core/Math/Fixed.h>
+#include <Core/Jobs/JobSystem.h>
+
+namespace {
+
+/// @brief  stands in for infinity in the transforms; small enough that adding a step
+///         never overflows
+constexpr int32_t kFar = 1 << 29;
+
+/// @brief  the largest cost of one step, which bounds the bucket queue
+constexpr uint32_t kMaxStepCost = kDiagonalStepCost * 255;
+
+/// @brief  rows per chunk of the Euclidean transform
+constexpr std::size_t kRowGrain = 16;
+
+/// @brief  one forward or backward chamfer step over a row: first the three cells of
+///         the row before, then along the row itself
+/// @param  row         the row being updated, with one padding cell at each end
+/// @param  previous    the row already finished, padded the same way
+/// @param  count       the number of real cells
+/// @param  forward     whether the row pass runs left to right
+void chamferRow( int32_t* row, int32_t const* previous, std::size_t count, bool forward )
+{
+    constexpr int32_t straight = static_cast< int32_t >( kStraightStepCost );
+    constexpr int32_t diagonal = static_cast< int32_t >( kDiagonalStepCost );
+
+    // the row before is finished, so every cell takes from it independently
+    std::size_t x = 1;
+#if ETERNUM_SIMD_SSE
+    const __m128i straightStep = _mm_set1_epi32( straight );
+    const __m128i diagonalStep = _mm_set1_epi32( diagonal );
+    auto min = []( __m128i a, __m128i b )
+    {
+        const __m128i less = _mm_cmplt_epi32( a, b );
+        return _mm_or_si128( _mm_and_si128( less, a ), _mm_andnot_si128( less, b ) );
+    };
+    for ( ; x + 4 <= count + 1; x += 4 )
+    {
+        __m128i best = _mm_loadu_si128( reinterpret_cast< __m128i const* >( row + x ) );
+        const __m128i above = _mm_loadu_si128( reinterpret_cast< __m128i const* >( previous + x ) );
+        const __m128i left = _mm_loadu_si128( reinterpret_cast< __m128i const* >( previous + x - 1 ) );
+        const __m128i right = _mm_loadu_si128( reinterpret_cast< __m128i const* >( previous + x + 1 ) );
+        best = min( best, _mm_add_epi32( above, straightStep ) );
+        best = min( best, _mm_add_epi32( min( left, right ), diagonalStep ) );
+        _mm_storeu_si128( reinterpret_cast< __m128i* >( row + x ), best );
+    }
+#endif
+    for ( ; x <= count; ++x )
+    {
+        const int32_t fromAbove = previous[ x ] + straight;
+        const int32_t fromCorner = ( std::min )( previous[ x - 1 ], previous[ x + 1 ] ) + diagonal;
+        row[ x ] = ( std::min )( row[ x ], ( std::min )( fromAbove, fromCorner ) );
+    }
+
+    // then along the row, which carries from one cell to the next
+    if ( forward )
+    {
+        for ( std::size_t i = 2; i <= count; ++i )
+            row[ i ] = ( std::min )( row[ i ], row[ i - 1 ] + straight );
+    }
+    else
+    {
+        for ( std::size_t i = count - 1; i >= 1; --i )
+            row[ i ] = ( std::min )( row[ i ], row[ i + 1 ] + straight );
+    }
+}
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+// Building
+//-----------------------------------------------------------------------------
+
+void DistanceField::BuildBreadthFirst( PathGrid const& grid, std::span< Vec2i const > sources )
+{
+    reset( grid );
+    m_AllowDiagonal = false;
+
+    std::vector< uint32_t > frontier;
+    frontier.reserve( sources.size() );
+    for ( Vec2i const& source : sources )
+    {
+        if ( !grid.IsWalkable( source ) || m_Distances[ grid.IndexOf( source ) ] == 0 )
+            continue;
+        m_Distances[ grid.IndexOf( source ) ] = 0;
+        frontier.push_back( grid.IndexOf( source ) );
+    }
+
+    // every step costs the same, so a plain FIFO settles cells in order
+    for ( std::size_t next = 0; next < frontier.size(); ++next )
+    {
+        const uint32_t index = frontier[ next ];
+        const Vec2i cell = grid.CellOf( index );
+        const uint32_t distance = m_Distances[ index ] + kStraightStepCost;
+        for ( std::size_t i = 0; i < 4; ++i )
+        {
+            const int x = cell.x() + kNeighborOffsets[ i ].x();
+            const int y = cell.y() + kNeighborOffsets[ i ].y();
+            if ( !grid.IsWalkable( x, y ) )
+                continue;
+
+            uint32_t& neighbor = m_Distances[ grid.IndexOf( x, y ) ];
+            if ( neighbor == kUnreachable )
+            {
+                neighbor = distance;
+                frontier.push_back( grid.IndexOf( x, y ) );
+            }
+        }
+    }
+}
+
+void DistanceField::BuildDijkstra( PathGrid const& grid, std::span< Vec2i const > sources, bool allowDiagonal )
+{
+    reset( grid );
+    m_AllowDiagonal = allowDiagonal;
+
+    // costs are small integers, so a ring of buckets one step wider than the costliest
+    // step replaces the heap: every queued cell lies within one step of the current one
+    constexpr std::size_t kBucketCount = kMaxStepCost + 1;
+    m_Buckets.resize( kBucketCount );
+    for ( auto& bucket : m_Buckets )
+        bucket.clear();
+
+    std::size_t queued = 0;
+    for ( Vec2i const& source : sources )
+    {
+        if ( !grid.IsWalkable( source ) || m_Distances[ grid.IndexOf( source ) ] == 0 )
+            continue;
+        m_Distances[ grid.IndexOf( source ) ] = 0;
+        m_Buckets[ 0 ].push_back( grid.IndexOf( source ) );
+        ++queued;
+    }
+
+    const std::size_t directions = allowDiagonal ? 8 : 4;
+    for ( uint32_t distance = 0; queued != 0; ++distance )
+    {
+        // every step costs at least kStraightStepCost, so nothing lands in the bucket being
+        // drained
+        std::vector< uint32_t >& bucket = m_Buckets[ distance % kBucketCount ];
+        for ( std::size_t next = 0; next < bucket.size(); ++next )
+        {
+            --queued;
+            const uint32_t index = bucket[ next ];
+            // left behind when the cell was reached more cheaply
+            if ( m_Distances[ index ] != distance )
+                continue;
+
+            // the step is taken towards this cell, so it is this cell's cost
+            const Vec2i cell = grid.CellOf( index );
+            const uint32_t cellCost = grid.GetCost( index );
+            for ( std::size_t i = 0; i < directions; ++i )
+            {
+                const int dx = kNeighborOffsets[ i ].x();
+                const int dy = kNeighborOffsets[ i ].y();
+                const int x = cell.x() + dx;
+                const int y = cell.y() + dy;
+                if ( !grid.IsWalkable( x, y ) )
+                    continue;
+
+                const bool diagonal = dx != 0 && dy != 0;
+                if ( diagonal && ( !grid.IsWalkable( cell.x() + dx, cell.y() ) || !grid.IsWalkable( cell.x(), cell.y() + dy ) ) )
+                    continue;
+
+                const uint32_t cost = distance + ( diagonal ? kDiagonalStepCost : kStraightStepCost ) * cellCost;
+                uint32_t& neighbor = m_Distances[ grid.IndexOf( x, y ) ];
+                if ( cost < neighbor )
+                {
+                    neighbor = cost;
+                    m_Buckets[ cost % kBucketCount ].push_back( grid.IndexOf( x, y ) );
+                    ++queued;
+                }
+            }
+        }
+        bucket.clear();
+    }
+}
+
+void DistanceField::BuildClearance( PathGrid const& grid, ClearanceMetric metric )
+{
+    reset( grid );
+    m_AllowDiagonal = true;
+
+    if ( metric == ClearanceMetric::Chamfer )
+        buildChamfer( grid );
+    else
+        buildEuclidean( grid );
+}
+
+//-----------------------------------------------------------------------------
+// Queries
+//-----------------------------------------------------------------------------
+
+bool DistanceField::Descend( PathGrid const& grid, Vec2i const& from, Vec2i& next ) const
+{
+    const uint32_t here = Get( from );
+    if ( here == 0 || here == kUnreachable )
+        return false;
+
+    // the neighbour a cheapest way passes through: its own distance plus the step
+    uint64_t best = kUnreachable;
+    const std::size_t directions = m_AllowDiagonal ? 8 : 4;
+    for ( std::size_t i = 0; i < directions; ++i )
+    {
+        const int dx = kNeighborOffsets[ i ].x();
+        const int dy = kNeighborOffsets[ i ].y();
+        const Vec2i cell{ from.x() + dx, from.y() + dy };
+        const uint32_t distance = Get( cell );
+        if ( distance >= here || !grid.IsWalkable( cell ) )
+            continue;
+
+        const bool diagonal = dx != 0 && dy != 0;
+        if ( diagonal && ( !grid.IsWalkable( from.x() + dx, from.y() ) || !grid.IsWalkable( from.x(), from.y() + dy ) ) )
+            continue;
+
+        const uint64_t cost = uint64_t( distance ) + ( diagonal ? kDiagonalStepCost : kStraightStepCost ) * grid.GetCost( cell );
+        if ( cost < best )
+        {
+            best = cost;
+            next = cell;
+        }
+    }
+    return best != kUnreachable;
+}
+
+//-----------------------------------------------------------------------------
+// Private Methods
+//-----------------------------------------------------------------------------
+
+void DistanceField::reset( PathGrid const& grid )
+{
+    m_Width = grid.GetWidth();
+    m_Height = grid.GetHeight();
+    m_Distances.assign( grid.GetCellCount(), kUnreachable );
+}
+
+void DistanceField::buildChamfer( PathGrid const& grid )
+{
+    // each row is padded with a far cell at both ends, and the rows before the first and
+    // after the last are entirely far, so the passes never test for edges
+    const std::size_t width = static_cast< std::size_t >( m_Width );
+    const std::size_t stride = width + 2;
+    std::vector< int32_t > field( stride * ( m_Height + 2 ), kFar );
+
+    bool anyBlocked = false;
+    for ( int y = 0; y < m_Height; ++y )
+    {
+        for ( int x = 0; x < m_Width; ++x )
+        {
+            if ( !grid.IsWalkable( x, y ) )
+            {
+                field[ ( y + 1 ) * stride + x + 1 ] = 0;
+                anyBlocked = true;
+            }
+        }
+    }
+    if ( !anyBlocked )
+        return;
+
+    for ( int y = 1; y <= m_Height; ++y )
+        chamferRow( &field[ y * stride ], &field[ ( y - 1 ) * stride ], width, true );
+    for ( int y = m_Height; y >= 1; --y )
+        chamferRow( &field[ y * stride ], &field[ ( y + 1 ) * stride ], width, false );
+
+    for ( int y = 0; y < m_Height; ++y )
+        for ( int x = 0; x < m_Width; ++x )
+            m_Distances[ static_cast< std::size_t >( y ) * width + x ] = static_cast< uint32_t >( field[ ( y + 1 ) * stride + x + 1 ] );
+}
+
+void DistanceField::buildEuclidean( PathGrid const& grid )
+{
+    // separable exact transform (Felzenszwalb and Huttenlocher): the distance down each
+    // column, then the lower envelope of the parabolas along each row. Every column, and
+    // then every row, is independent of the others
+    const int width = m_Width;
+    const int height = m_Height;
+    std::vector< int64_t > squared( grid.GetCellCount() );
+    std::atomic< bool > anyBlocked = false;
+
+    Jobs()->ParallelFor( static_cast< std::size_t >( width ), 0, [ & ]( std::size_t begin, std::size_t end )
+    {
+        for ( int x = static_cast< int >( begin ); x < static_cast< int >( end ); ++x )
+        {
+            int64_t gap = kFar;
+            for ( int y = 0; y < height; ++y )
+            {
+                gap = grid.IsWalkable( x, y ) ? ( std::min )( gap + 1, int64_t{ kFar } ) : 0;
+                squared[ static_cast< std::size_t >( y ) * width + x ] = gap;
+            }
+
+            gap = kFar;
+            for ( int y = height - 1; y >= 0; --y )
+            {
+                int64_t& cell = squared[ static_cast< std::size_t >( y ) * width + x ];
+                gap = cell == 0 ? 0 : ( std::min )( gap + 1, int64_t{ kFar } );
+                cell = ( std::min )( cell, gap );
+                if ( cell == 0 )
+                    anyBlocked.store( true, std::memory_order_relaxed );
+                cell = cell >= kFar ? int64_t{ kFar } * kFar : cell * cell;
+            }
+        }
+    } );
+    if ( !anyBlocked.load() )
+        return;
+
+    Jobs()->ParallelFor( static_cast< std::size_t >( height ), kRowGrain, [ & ]( std::size_t begin, std::size_t end )
+    {
+        // the parabolas of the lower envelope and where each one takes over
+        std::vector< int > roots( width );
+        std::vector< double > bounds( width + 1 );
+        std::vector< int64_t > row( width );
+
+        for ( std::size_t y = begin; y < end; ++y )
+        {
+            int64_t* cells = &squared[ y * width ];
+            std::copy( cells, cells + width, row.begin() );
+
+            auto intersect = [ & ]( int a, int b )
+            {
+                return ( double( row[ b ] + int64_t( b ) * b ) - double( row[ a ] + int64_t( a ) * a ) ) / ( 2.0 * ( b - a ) );
+            };
+
+            int top = 0;
+            roots[ 0 ] = 0;
+            bounds[ 0 ] = -std::numeric_limits< double >::infinity();
+            bounds[ 1 ] = std::numeric_limits< double >::infinity();
+            for ( int q = 1; q < width; ++q )
+            {
+                double at = intersect( roots[ top ], q );
+                while ( at <= bounds[ top ] )
+                {
+                    --top;
+                    at = intersect( roots[ top ], q );
+                }
+                ++top;
+                roots[ top ] = q;
+                bounds[ top ] = at;
+                bounds[ top + 1 ] = std::numeric_limits< double >::infinity();
+            }
+
+            int parabola = 0;
+            for ( int q = 0; q < width; ++q )
+            {
+                while ( bounds[ parabola + 1 ] < q )
+                    ++parabola;
+                const int64_t dx = q - roots[ parabola ];
+                const int64_t distance = dx * dx + row[ roots[ parabola ] ];
+                m_Distances[ y * width + q ] = static_cast< uint32_t >( FixedDetail::ISqrt( uint64_t( distance ) * kStraightStepCost * kStraightStepCost ) );
+            }
+        }
+    } );
+}
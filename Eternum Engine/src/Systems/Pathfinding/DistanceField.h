@@ -0,0 +1,115 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: DistanceField
+* Description:
+*     Per-cell distances over a PathGrid, computed once and shared by every agent.
+*     Dijkstra maps hold the cost from each cell to its nearest source, by breadth-first
+*     search on uniform 4-way grids or by a bucketed Dijkstra with the same movement
+*     rules as the Pathfinder, and agents walk them downhill one cell at a time.
+*     Clearance maps hold the distance from each cell to the nearest blocked cell, by
+*     a two-pass chamfer transform with SIMD row passes or an exact Euclidean transform
+*     split across the JobSystem.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef DISTANCEFIELD_H
+#define DISTANCEFIELD_H
+
+#include <pch.h>
+#include <span>
+#include <Systems/Pathfinding/PathGrid.h>
+
+/// @brief  how clearance is measured
+enum class ClearanceMetric : uint8_t
+{
+    /// @brief  8-neighbour chamfer distance, which is exactly the octile distance
+    Chamfer,
+
+    /// @brief  exact straight-line distance, rounded down
+    Euclidean
+};
+
+class DistanceField
+{
+public:
+    /// @brief  distance of a cell no source reaches
+    static constexpr uint32_t kUnreachable = ( std::numeric_limits< uint32_t >::max )();
+
+    DistanceField() = default;
+
+//-----------------------------------------------------------------------------
+// Building
+//-----------------------------------------------------------------------------
+
+    /// @brief  builds a Dijkstra map by multi-source breadth-first search, moving in four
+    ///         directions and pricing every step at kStraightStepCost whatever the terrain
+    /// @param  grid    the grid to measure
+    /// @param  sources the cells to measure from; blocked and out-of-bounds ones are ignored
+    void BuildBreadthFirst( PathGrid const& grid, std::span< Vec2i const > sources );
+
+    /// @brief  builds a Dijkstra map holding the exact cost from each cell to its nearest
+    ///         source, with the Pathfinder's step costs and corner rule
+    /// @param  grid            the grid to measure
+    /// @param  sources         the cells to measure to; blocked and out-of-bounds ones are
+    ///                         ignored
+    /// @param  allowDiagonal   whether to step diagonally
+    void BuildDijkstra( PathGrid const& grid, std::span< Vec2i const > sources, bool allowDiagonal = true );
+
+    /// @brief  builds a clearance map: the distance from each cell to the nearest blocked
+    ///         cell, ignoring walls in between, in step-cost units
+    /// @param  grid    the grid to measure
+    /// @param  metric  how to measure
+    /// @note   every cell is kUnreachable when nothing is blocked
+    void BuildClearance( PathGrid const& grid, ClearanceMetric metric = ClearanceMetric::Euclidean );
+
+//-----------------------------------------------------------------------------
+// Queries
+//-----------------------------------------------------------------------------
+
+    /// @brief  gets a cell's distance; kUnreachable out of bounds
+    uint32_t Get( int x, int y ) const
+    {
+        return x >= 0 && y >= 0 && x < m_Width && y < m_Height ? m_Distances[ static_cast< std::size_t >( y ) * m_Width + x ] : kUnreachable;
+    }
+    uint32_t Get( Vec2i const& cell ) const { return Get( cell.x(), cell.y() ); }
+
+    /// @brief  picks the next cell downhill on a Dijkstra map
+    /// @param  grid    the grid the map was built from
+    /// @param  from    the current cell
+    /// @param  next    receives the neighbour on a cheapest way to a source
+    /// @return false at a source, or where no source is reachable
+    bool Descend( PathGrid const& grid, Vec2i const& from, Vec2i& next ) const;
+
+//-----------------------------------------------------------------------------
+// Public Accessors
+//-----------------------------------------------------------------------------
+
+    int GetWidth() const { return m_Width; }
+    int GetHeight() const { return m_Height; }
+
+    /// @brief  gets every distance, row by row
+    std::span< uint32_t const > GetDistances() const { return m_Distances; }
+
+private:
+    /// @brief  sizes the map to a grid and fills it with kUnreachable
+    void reset( PathGrid const& grid );
+
+    void buildChamfer( PathGrid const& grid );
+    void buildEuclidean( PathGrid const& grid );
+
+    int m_Width = 0;
+    int m_Height = 0;
+
+    /// @brief  whether the map was built with diagonal steps, which Descend follows
+    bool m_AllowDiagonal = true;
+
+    std::vector< uint32_t > m_Distances;
+
+    /// @brief  bucket queue of the Dijkstra build, kept to reuse its storage
+    std::vector< std::vector< uint32_t > > m_Buckets;
+};
+
+#endif //DISTANCEFIELD_H
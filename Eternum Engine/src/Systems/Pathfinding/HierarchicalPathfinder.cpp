@@ -0,0 +1,488 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: HierarchicalPathfinder
+* Description:
+*     Implements the cluster abstraction, its incremental rebuilds and abstract searches.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+
+#include <pch.h>
+#include "HierarchicalPathfinder.h"
+
+namespace {
+
+/// @brief  shortest run of open border cells that gets an entrance at each end instead of
+///         a single one in its middle
+constexpr int kLongEntranceLength = 6;
+
+/// @brief  search state for the searches confined to one cluster, kept apart from the
+///         calling thread's SearchBuffers so they can run while an abstract search is
+///         in progress
+SearchBuffers& clusterBuffers()
+{
+    thread_local SearchBuffers t_Buffers;
+    return t_Buffers;
+}
+
+} // namespace
+
+HierarchicalPathfinder::HierarchicalPathfinder( int clusterSize ) :
+    m_ClusterSize( ( std::max )( clusterSize, 1 ) )
+{
+}
+
+HierarchicalPathfinder::~HierarchicalPathfinder()
+{
+    Detach();
+}
+
+//-----------------------------------------------------------------------------
+// Building and Editing
+//-----------------------------------------------------------------------------
+
+void HierarchicalPathfinder::Build( GridSystem::Grid const& grid, TerrainCosts const& costs )
+{
+    m_Grid.Build( grid, costs );
+    m_ClustersX = ( m_Grid.GetWidth() + m_ClusterSize - 1 ) / m_ClusterSize;
+    m_ClustersY = ( m_Grid.GetHeight() + m_ClusterSize - 1 ) / m_ClusterSize;
+
+    m_Clusters.clear();
+    m_Clusters.resize( static_cast< std::size_t >( m_ClustersX ) * m_ClustersY );
+    m_Nodes.clear();
+    m_FreeNodes.clear();
+    m_DirtyClusters.clear();
+
+    for ( uint32_t cluster = 0; cluster < m_Clusters.size(); ++cluster )
+        rebuildCluster( cluster );
+}
+
+void HierarchicalPathfinder::Attach()
+{
+    if ( m_IsAttached )
+        return;
+
+    m_CellChangedSubscription = Events()->Subscribe< CellChanged >( [ this ]( std::span< CellChanged const > changes )
+    {
+        ApplyChanges( changes );
+    } );
+    m_MapLoadedSubscription = Events()->Subscribe< GridMapLoaded >( [ this ]( std::span< GridMapLoaded const > )
+    {
+        if ( GridSystem::Grid const* grid = GridSystem::GetInstance()->GetActiveGrid() )
+            Build( *grid, m_Grid.GetTerrain() );
+    } );
+    m_IsAttached = true;
+
+    if ( GridSystem::Grid const* grid = GridSystem::GetInstance()->GetActiveGrid() )
+        Build( *grid, m_Grid.GetTerrain() );
+}
+
+void HierarchicalPathfinder::Detach()
+{
+    if ( !m_IsAttached )
+        return;
+
+    Events()->Unsubscribe< CellChanged >( m_CellChangedSubscription );
+    Events()->Unsubscribe< GridMapLoaded >( m_MapLoadedSubscription );
+    m_IsAttached = false;
+}
+
+void HierarchicalPathfinder::ApplyChanges( std::span< CellChanged const > changes )
+{
+    for ( CellChanged const& change : changes )
+        SetCell( change.m_X, change.m_Y, change.m_Value );
+    Refresh();
+}
+
+void HierarchicalPathfinder::SetCell( int x, int y, char value )
+{
+    if ( !m_Grid.SetCell( x, y, value ) )
+        return;
+
+    markDirty( clusterOf( x, y ) );
+
+    // a cell on a border also changes the entrances the neighbour across it sees
+    const Bounds bounds = boundsOf( clusterOf( x, y ) );
+    if ( x == bounds.m_X0 && x > 0 )
+        markDirty( clusterOf( x - 1, y ) );
+    if ( x == bounds.m_X1 - 1 && x + 1 < m_Grid.GetWidth() )
+        markDirty( clusterOf( x + 1, y ) );
+    if ( y == bounds.m_Y0 && y > 0 )
+        markDirty( clusterOf( x, y - 1 ) );
+    if ( y == bounds.m_Y1 - 1 && y + 1 < m_Grid.GetHeight() )
+        markDirty( clusterOf( x, y + 1 ) );
+}
+
+void HierarchicalPathfinder::Refresh()
+{
+    for ( uint32_t cluster : m_DirtyClusters )
+    {
+        rebuildCluster( cluster );
+        m_Clusters[ cluster ].m_IsDirty = false;
+    }
+    m_DirtyClusters.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Queries
+//-----------------------------------------------------------------------------
+
+PathResult HierarchicalPathfinder::FindPath( Vec2i const& start, Vec2i const& goal, std::vector< Vec2i >& waypoints ) const
+{
+    waypoints.clear();
+    PathResult result;
+    if ( !m_Grid.IsWalkable( start ) || !m_Grid.IsWalkable( goal ) )
+        return result;
+
+    if ( start == goal )
+    {
+        waypoints.push_back( start );
+        result.m_Status = PathStatus::Found;
+        return result;
+    }
+
+    const uint32_t startCluster = clusterOf( start.x(), start.y() );
+    const uint32_t goalCluster = clusterOf( goal.x(), goal.y() );
+    Cluster const& goalNodes = m_Clusters[ goalCluster ];
+    const uint32_t goalCell = m_Grid.IndexOf( goal );
+
+    // the cost from each node of the goal's cluster to the goal, and from the start to
+    // each node of its own cluster, both without leaving the cluster
+    thread_local std::vector< uint32_t > t_GoalCosts;
+    thread_local std::vector< std::pair< uint32_t, uint32_t > > t_StartEdges;
+    t_GoalCosts.assign( goalNodes.m_Nodes.size(), kNone );
+    t_StartEdges.clear();
+
+    auto localNodeAt = [ this ]( Cluster const& cluster, uint32_t cell )
+    {
+        for ( std::size_t local = 0; local < cluster.m_Nodes.size(); ++local )
+            if ( m_Nodes[ cluster.m_Nodes[ local ] ].m_Cell == cell )
+                return static_cast< uint32_t >( local );
+        return kNone;
+    };
+
+    std::size_t goalSettled = 0;
+    searchCluster( boundsOf( goalCluster ), goal, true, clusterBuffers(), [ & ]( Vec2i const& cell, uint32_t cost )
+    {
+        const uint32_t local = localNodeAt( goalNodes, m_Grid.IndexOf( cell ) );
+        if ( local != kNone )
+        {
+            t_GoalCosts[ local ] = cost;
+            ++goalSettled;
+        }
+        return goalSettled < goalNodes.m_Nodes.size();
+    } );
+
+    Cluster const& startNodes = m_Clusters[ startCluster ];
+    const std::size_t startTargets = startNodes.m_Nodes.size() + ( startCluster == goalCluster ? 1 : 0 );
+    searchCluster( boundsOf( startCluster ), start, false, clusterBuffers(), [ & ]( Vec2i const& cell, uint32_t cost )
+    {
+        const uint32_t index = m_Grid.IndexOf( cell );
+        if ( startCluster == goalCluster && index == goalCell )
+            t_StartEdges.emplace_back( kNone, cost );
+        else if ( const uint32_t local = localNodeAt( startNodes, index ); local != kNone )
+            t_StartEdges.emplace_back( startNodes.m_Nodes[ local ], cost );
+        return t_StartEdges.size() < startTargets;
+    } );
+
+    // the abstract graph: every node id, then the start, then the goal
+    const uint32_t startNode = static_cast< uint32_t >( m_Nodes.size() );
+    const uint32_t goalNode = startNode + 1;
+    SearchBuffers& buffers = SearchBuffers::ThisThread();
+    buffers.Begin( m_Nodes.size() + 2 );
+
+    auto estimate = [ & ]( uint32_t cell ) { return EstimateCost( Heuristic::Octile, m_Grid.CellOf( cell ), goal ); };
+
+    for ( auto const& [ node, cost ] : t_StartEdges )
+    {
+        if ( node == kNone )
+            buffers.Reach( goalNode, startNode, cost, 0 );
+        else
+            buffers.Reach( node, startNode, cost, estimate( m_Nodes[ node ].m_Cell ) );
+    }
+    uint32_t node = 0;
+    uint32_t cost = 0;
+    result.m_Status = PathStatus::NoPath;
+    while ( buffers.PopBest( node, cost ) )
+    {
+        ++result.m_Expanded;
+        if ( node == goalNode )
+        {
+            result.m_Status = PathStatus::Found;
+            result.m_Cost = cost;
+            break;
+        }
+
+        Node const& from = m_Nodes[ node ];
+        Cluster const& cluster = m_Clusters[ from.m_Cluster ];
+        const std::size_t count = cluster.m_Nodes.size();
+
+        for ( std::size_t local = 0; local < count; ++local )
+        {
+            const uint32_t edge = cluster.m_Costs[ from.m_Local * count + local ];
+            const uint32_t to = cluster.m_Nodes[ local ];
+            if ( edge != kNone && to != node )
+                buffers.Reach( to, node, cost + edge, estimate( m_Nodes[ to ].m_Cell ) );
+        }
+
+        for ( uint32_t partner : from.m_Partners )
+        {
+            if ( partner == kNone )
+                continue;
+
+            const Vec2i cell = m_Grid.CellOf( partner );
+            const uint32_t to = findNode( clusterOf( cell.x(), cell.y() ), partner );
+            if ( to != kNone )
+                buffers.Reach( to, node, cost + kStraightStepCost * m_Grid.GetCost( partner ), estimate( partner ) );
+        }
+
+        if ( from.m_Cluster == goalCluster && t_GoalCosts[ from.m_Local ] != kNone )
+            buffers.Reach( goalNode, node, cost + t_GoalCosts[ from.m_Local ], 0 );
+    }
+
+    if ( !result.IsFound() )
+        return result;
+
+    auto& trace = buffers.GetTrace();
+    trace.clear();
+    for ( uint32_t at = goalNode; at != startNode; at = buffers.GetParent( at ) )
+        trace.push_back( at );
+
+    waypoints.push_back( start );
+    for ( auto it = trace.rbegin(); it != trace.rend(); ++it )
+    {
+        const Vec2i cell = *it == goalNode ? goal : m_Grid.CellOf( m_Nodes[ *it ].m_Cell );
+        if ( cell != waypoints.back() )
+            waypoints.push_back( cell );
+    }
+    return result;
+}
+
+void HierarchicalPathfinder::RefineLeg( Vec2i const& from, Vec2i const& to, std::vector< Vec2i >& cells ) const
+{
+    const uint32_t cluster = clusterOf( from.x(), from.y() );
+    if ( cluster != clusterOf( to.x(), to.y() ) )
+    {
+        // a border crossing is a single step
+        cells.push_back( to );
+        return;
+    }
+
+    const Bounds bounds = boundsOf( cluster );
+    SearchBuffers& buffers = clusterBuffers();
+    bool reached = false;
+    searchCluster( bounds, from, false, buffers, [ & ]( Vec2i const& cell, uint32_t )
+    {
+        reached = cell == to;
+        return !reached;
+    } );
+    if ( !reached )
+        return;
+
+    auto localOf = [ & ]( Vec2i const& cell )
+    {
+        return static_cast< uint32_t >( ( cell.y() - bounds.m_Y0 ) * bounds.GetWidth() + cell.x() - bounds.m_X0 );
+    };
+    auto cellOf = [ & ]( uint32_t local )
+    {
+        const int width = bounds.GetWidth();
+        return Vec2i{ bounds.m_X0 + static_cast< int >( local ) % width, bounds.m_Y0 + static_cast< int >( local ) / width };
+    };
+
+    auto& trace = buffers.GetTrace();
+    trace.clear();
+    const uint32_t source = localOf( from );
+    for ( uint32_t local = localOf( to ); local != source; local = buffers.GetParent( local ) )
+        trace.push_back( local );
+    for ( auto it = trace.rbegin(); it != trace.rend(); ++it )
+        cells.push_back( cellOf( *it ) );
+}
+
+void HierarchicalPathfinder::Refine( std::vector< Vec2i > const& waypoints, std::vector< Vec2i >& cells ) const
+{
+    cells.clear();
+    if ( waypoints.empty() )
+        return;
+
+    cells.push_back( waypoints.front() );
+    for ( std::size_t i = 1; i < waypoints.size(); ++i )
+        RefineLeg( waypoints[ i - 1 ], waypoints[ i ], cells );
+}
+
+//-----------------------------------------------------------------------------
+// Private Methods
+//-----------------------------------------------------------------------------
+
+uint32_t HierarchicalPathfinder::clusterOf( int x, int y ) const
+{
+    return static_cast< uint32_t >( ( y / m_ClusterSize ) * m_ClustersX + x / m_ClusterSize );
+}
+
+HierarchicalPathfinder::Bounds HierarchicalPathfinder::boundsOf( uint32_t cluster ) const
+{
+    const int x0 = static_cast< int >( cluster % m_ClustersX ) * m_ClusterSize;
+    const int y0 = static_cast< int >( cluster / m_ClustersX ) * m_ClusterSize;
+    return { x0, y0, ( std::min )( x0 + m_ClusterSize, m_Grid.GetWidth() ), ( std::min )( y0 + m_ClusterSize, m_Grid.GetHeight() ) };
+}
+
+void HierarchicalPathfinder::markDirty( uint32_t cluster )
+{
+    if ( m_Clusters[ cluster ].m_IsDirty )
+        return;
+
+    m_Clusters[ cluster ].m_IsDirty = true;
+    m_DirtyClusters.push_back( cluster );
+}
+
+void HierarchicalPathfinder::collectEntrances( uint32_t cluster, std::vector< std::pair< uint32_t, uint32_t > >& entrances ) const
+{
+    const Bounds bounds = boundsOf( cluster );
+
+    // walks one border in increasing order, so the cluster on the other side finds the
+    // same runs and places its entrances on the same cells
+    auto scan = [ & ]( Vec2i const& inside, Vec2i const& outside, Vec2i const& step, int length )
+    {
+        auto along = [ & ]( Vec2i const& from, int i ) { return Vec2i{ from.x() + step.x() * i, from.y() + step.y() * i }; };
+        auto add = [ & ]( int i ) { entrances.emplace_back( m_Grid.IndexOf( along( inside, i ) ), m_Grid.IndexOf( along( outside, i ) ) ); };
+
+        int runStart = 0;
+        for ( int i = 0; i <= length; ++i )
+        {
+            if ( i < length && m_Grid.IsWalkable( along( inside, i ) ) && m_Grid.IsWalkable( along( outside, i ) ) )
+                continue;
+
+            const int runLength = i - runStart;
+            if ( runLength >= kLongEntranceLength )
+            {
+                add( runStart );
+                add( i - 1 );
+            }
+            else if ( runLength > 0 )
+            {
+                add( runStart + ( runLength - 1 ) / 2 );
+            }
+            runStart = i + 1;
+        }
+    };
+
+    const Vec2i down{ 0, 1 };
+    const Vec2i right{ 1, 0 };
+    if ( bounds.m_X0 > 0 )
+        scan( { bounds.m_X0, bounds.m_Y0 }, { bounds.m_X0 - 1, bounds.m_Y0 }, down, bounds.GetHeight() );
+    if ( bounds.m_X1 < m_Grid.GetWidth() )
+        scan( { bounds.m_X1 - 1, bounds.m_Y0 }, { bounds.m_X1, bounds.m_Y0 }, down, bounds.GetHeight() );
+    if ( bounds.m_Y0 > 0 )
+        scan( { bounds.m_X0, bounds.m_Y0 }, { bounds.m_X0, bounds.m_Y0 - 1 }, right, bounds.GetWidth() );
+    if ( bounds.m_Y1 < m_Grid.GetHeight() )
+        scan( { bounds.m_X0, bounds.m_Y1 - 1 }, { bounds.m_X0, bounds.m_Y1 }, right, bounds.GetWidth() );
+}
+
+void HierarchicalPathfinder::rebuildCluster( uint32_t cluster )
+{
+    Cluster& record = m_Clusters[ cluster ];
+    for ( uint32_t node : record.m_Nodes )
+    {
+        m_Nodes[ node ] = {};
+        m_FreeNodes.push_back( node );
+    }
+    record.m_Nodes.clear();
+
+    // one node per entrance cell, however many borders it sits on
+    thread_local std::vector< std::pair< uint32_t, uint32_t > > t_Entrances;
+    t_Entrances.clear();
+    collectEntrances( cluster, t_Entrances );
+    std::sort( t_Entrances.begin(), t_Entrances.end() );
+
+    for ( std::size_t i = 0; i < t_Entrances.size(); )
+    {
+        uint32_t id = static_cast< uint32_t >( m_Nodes.size() );
+        if ( m_FreeNodes.empty() )
+        {
+            m_Nodes.emplace_back();
+        }
+        else
+        {
+            id = m_FreeNodes.back();
+            m_FreeNodes.pop_back();
+        }
+
+        Node& node = m_Nodes[ id ];
+        node.m_Cell = t_Entrances[ i ].first;
+        node.m_Cluster = cluster;
+        node.m_Local = static_cast< uint32_t >( record.m_Nodes.size() );
+        for ( std::size_t partner = 0; i < t_Entrances.size() && t_Entrances[ i ].first == node.m_Cell; ++i, ++partner )
+            node.m_Partners[ partner ] = t_Entrances[ i ].second;
+        record.m_Nodes.push_back( id );
+    }
+
+    // the cost between every pair of nodes, one search from each
+    const std::size_t count = record.m_Nodes.size();
+    record.m_Costs.assign( count * count, kNone );
+    for ( std::size_t from = 0; from < count; ++from )
+    {
+        std::size_t settled = 0;
+        const Vec2i source = m_Grid.CellOf( m_Nodes[ record.m_Nodes[ from ] ].m_Cell );
+        searchCluster( boundsOf( cluster ), source, false, clusterBuffers(), [ & ]( Vec2i const& cell, uint32_t cost )
+        {
+            const uint32_t node = findNode( cluster, m_Grid.IndexOf( cell ) );
+            if ( node != kNone )
+            {
+                record.m_Costs[ from * count + m_Nodes[ node ].m_Local ] = cost;
+                ++settled;
+            }
+            return settled < count;
+        } );
+    }
+
+    ++m_RebuildCount;
+}
+
+uint32_t HierarchicalPathfinder::findNode( uint32_t cluster, uint32_t cell ) const
+{
+    for ( uint32_t node : m_Clusters[ cluster ].m_Nodes )
+        if ( m_Nodes[ node ].m_Cell == cell )
+            return node;
+    return kNone;
+}
+
+template < typename OnSettled >
+void HierarchicalPathfinder::searchCluster( Bounds const& bounds, Vec2i const& source, bool reverse, SearchBuffers& buffers,
+                                            OnSettled&& onSettled ) const
+{
+    const int width = bounds.GetWidth();
+    auto localOf = [ & ]( int x, int y ) { return static_cast< uint32_t >( ( y - bounds.m_Y0 ) * width + x - bounds.m_X0 ); };
+
+    buffers.Begin( static_cast< std::size_t >( width ) * bounds.GetHeight() );
+    const uint32_t sourceLocal = localOf( source.x(), source.y() );
+    buffers.Reach( sourceLocal, sourceLocal, 0, 0 );
+
+    uint32_t local = 0;
+    uint32_t cost = 0;
+    while ( buffers.PopBest( local, cost ) )
+    {
+        const int x = bounds.m_X0 + static_cast< int >( local ) % width;
+        const int y = bounds.m_Y0 + static_cast< int >( local ) / width;
+        if ( !onSettled( Vec2i{ x, y }, cost ) )
+            return;
+
+        for ( Vec2i const& offset : kNeighborOffsets )
+        {
+            const int dx = offset.x();
+            const int dy = offset.y();
+            if ( !bounds.Contains( x + dx, y + dy ) || !m_Grid.IsWalkable( x + dx, y + dy ) )
+                continue;
+
+            const bool diagonal = dx != 0 && dy != 0;
+            if ( diagonal && ( !m_Grid.IsWalkable( x + dx, y ) || !m_Grid.IsWalkable( x, y + dy ) ) )
+                continue;
+
+            // in reverse the step is taken towards this cell, so it is this cell's cost
+            const uint8_t cellCost = reverse ? m_Grid.GetCost( x, y ) : m_Grid.GetCost( x + dx, y + dy );
+            const uint32_t step = ( diagonal ? kDiagonalStepCost : kStraightStepCost ) * cellCost;
+            buffers.Reach( localOf( x + dx, y + dy ), local, cost + step, 0 );
+        }
+    }
+}
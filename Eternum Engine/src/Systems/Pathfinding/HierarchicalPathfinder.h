@@ -0,0 +1,191 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: HierarchicalPathfinder
+* Description:
+*     Hierarchical pathfinding (HPA*). The map is cut into square clusters; each run of
+*     open cells along a border between two clusters becomes one or two entrances, and
+*     every cluster stores the cost between each pair of its entrance cells. Queries
+*     search that small abstract graph and return waypoints, and each leg between two
+*     waypoints is refined into cells only when it is needed, by a search confined to
+*     one cluster. Cell edits rebuild only the clusters they touch.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef HIERARCHICALPATHFINDER_H
+#define HIERARCHICALPATHFINDER_H
+
+#include <pch.h>
+#include <span>
+#include <Systems/Pathfinding/Pathfinder.h>
+#include <Systems/Grid System/GridEvents.h>
+#include <Core/Events/EventBus.h>
+
+class HierarchicalPathfinder
+{
+public:
+    static constexpr int kDefaultClusterSize = 32;
+
+    /// @param  clusterSize the width and height of a cluster, in cells
+    explicit HierarchicalPathfinder( int clusterSize = kDefaultClusterSize );
+
+    /// @brief  destructor, detaches from the GridSystem
+    ~HierarchicalPathfinder();
+
+    // Prevent copy construction and assignment
+    HierarchicalPathfinder( HierarchicalPathfinder const& ) = delete;
+    HierarchicalPathfinder& operator=( HierarchicalPathfinder const& ) = delete;
+
+//-----------------------------------------------------------------------------
+// Building and Editing
+//-----------------------------------------------------------------------------
+
+    /// @brief  builds the whole abstraction of a grid
+    /// @param  grid    the grid to read
+    /// @param  costs   the cost of each character
+    void Build( GridSystem::Grid const& grid, TerrainCosts const& costs = TerrainCosts::Default() );
+
+    /// @brief  follows the GridSystem's active map: rebuilds whenever a map is loaded and
+    ///         absorbs each batch of CellChanged events at the sync point that delivers it
+    void Attach();
+
+    /// @brief  stops following the GridSystem
+    void Detach();
+
+    /// @brief  applies a batch of cell changes and rebuilds the clusters they touch
+    void ApplyChanges( std::span< CellChanged const > changes );
+
+    /// @brief  changes one cell; the clusters it touches are rebuilt by the next Refresh
+    /// @param  x       column of the cell
+    /// @param  y       row of the cell
+    /// @param  value   the cell's new character
+    void SetCell( int x, int y, char value );
+
+    /// @brief  rebuilds every cluster touched by an edit since the last Refresh
+    void Refresh();
+
+//-----------------------------------------------------------------------------
+// Queries
+//-----------------------------------------------------------------------------
+
+    /// @brief  finds a path through the abstract graph
+    /// @param  start       the cell to start from
+    /// @param  goal        the cell to reach
+    /// @param  waypoints   receives the start, the entrance cells passed through and the
+    ///                     goal; consecutive waypoints share a cluster or are adjacent
+    /// @return the outcome; m_Cost is the exact cost of the refined path, which is close
+    ///         to but not always the optimal one, and m_Expanded counts abstract nodes
+    /// @note   safe to call from several threads at once, but not during an edit
+    PathResult FindPath( Vec2i const& start, Vec2i const& goal, std::vector< Vec2i >& waypoints ) const;
+
+    /// @brief  refines one leg of a path into cells
+    /// @param  from    a waypoint
+    /// @param  to      the next waypoint
+    /// @param  cells   receives the cells after from, up to and including to; appended to
+    void RefineLeg( Vec2i const& from, Vec2i const& to, std::vector< Vec2i >& cells ) const;
+
+    /// @brief  refines every leg of a path
+    /// @param  waypoints   the waypoints from FindPath
+    /// @param  cells       receives every cell of the path, start and goal included
+    void Refine( std::vector< Vec2i > const& waypoints, std::vector< Vec2i >& cells ) const;
+
+//-----------------------------------------------------------------------------
+// Public Accessors
+//-----------------------------------------------------------------------------
+
+    PathGrid const& GetGrid() const { return m_Grid; }
+    int GetClusterSize() const { return m_ClusterSize; }
+    std::size_t GetClusterCount() const { return m_Clusters.size(); }
+
+    /// @brief  gets the number of entrance cells in the abstract graph
+    std::size_t GetNodeCount() const { return m_Nodes.size() - m_FreeNodes.size(); }
+
+    /// @brief  gets the number of clusters waiting for the next Refresh
+    std::size_t GetDirtyClusterCount() const { return m_DirtyClusters.size(); }
+
+    /// @brief  gets how many cluster rebuilds have happened in total
+    uint64_t GetClusterRebuildCount() const { return m_RebuildCount; }
+
+private:
+    static constexpr uint32_t kNone = ( std::numeric_limits< uint32_t >::max )();
+
+    /// @brief  an entrance cell
+    struct Node
+    {
+        uint32_t m_Cell = kNone;
+        uint32_t m_Cluster = kNone;
+
+        /// @brief  position in the cluster's node list
+        uint32_t m_Local = 0;
+
+        /// @brief  the cells across the borders this entrance leads to; a corner cell
+        ///         leads into two clusters, and a cell of a one-wide cluster into more
+        uint32_t m_Partners[ 4 ] = { kNone, kNone, kNone, kNone };
+    };
+
+    struct Cluster
+    {
+        /// @brief  ids of the entrance nodes on the cluster's borders
+        std::vector< uint32_t > m_Nodes;
+
+        /// @brief  cost from each node to each other, row by row; kNone when unreachable
+        ///         without leaving the cluster
+        std::vector< uint32_t > m_Costs;
+
+        bool m_IsDirty = false;
+    };
+
+    /// @brief  the cells a cluster covers
+    struct Bounds
+    {
+        int m_X0, m_Y0, m_X1, m_Y1;
+
+        int GetWidth() const { return m_X1 - m_X0; }
+        int GetHeight() const { return m_Y1 - m_Y0; }
+        bool Contains( int x, int y ) const { return x >= m_X0 && x < m_X1 && y >= m_Y0 && y < m_Y1; }
+    };
+
+    uint32_t clusterOf( int x, int y ) const;
+    Bounds boundsOf( uint32_t cluster ) const;
+    void markDirty( uint32_t cluster );
+
+    /// @brief  finds the entrance pairs ( inside, outside ) on every border of a cluster;
+    ///         both clusters of a border find the same entrances
+    void collectEntrances( uint32_t cluster, std::vector< std::pair< uint32_t, uint32_t > >& entrances ) const;
+
+    /// @brief  replaces a cluster's nodes and recomputes the costs between them
+    void rebuildCluster( uint32_t cluster );
+
+    /// @brief  gets the node at a cell of a cluster, or kNone
+    uint32_t findNode( uint32_t cluster, uint32_t cell ) const;
+
+    /// @brief  runs Dijkstra's algorithm from a cell without leaving a cluster
+    /// @param  bounds      the cluster's cells
+    /// @param  source      the cell to search from
+    /// @param  reverse     whether to measure costs to the source instead of from it
+    /// @param  buffers     search state, indexed by position within the bounds
+    /// @param  onSettled   called with each cell and its final cost, cheapest first;
+    ///                     returns false to stop
+    template < typename OnSettled >
+    void searchCluster( Bounds const& bounds, Vec2i const& source, bool reverse, SearchBuffers& buffers,
+                        OnSettled&& onSettled ) const;
+
+    PathGrid m_Grid;
+    int m_ClusterSize;
+    int m_ClustersX = 0;
+    int m_ClustersY = 0;
+
+    std::vector< Cluster > m_Clusters;
+    std::vector< Node > m_Nodes;
+    std::vector< uint32_t > m_FreeNodes;
+    std::vector< uint32_t > m_DirtyClusters;
+    uint64_t m_RebuildCount = 0;
+
+    bool m_IsAttached = false;
+    SubscriptionId m_CellChangedSubscription = 0;
+    SubscriptionId m_MapLoadedSubscription = 0;
+};
+
+#endif //HIERARCHICALPATHFINDER_H
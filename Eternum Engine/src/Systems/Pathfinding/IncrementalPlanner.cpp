@@ -0,0 +1,351 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: IncrementalPlanner
+* Description:
+*     Implements D* Lite over a PathGrid.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+
+#include <pch.h>
+#include "IncrementalPlanner.h"
+
+namespace {
+
+/// @brief  dead entries tolerated in the open list before it is rebuilt without them
+constexpr std::size_t kMinDeadEntriesToCompact = 1024;
+
+uint32_t addCosts( uint32_t a, uint32_t b )
+{
+    const uint64_t sum = uint64_t( a ) + b;
+    return sum >= ( std::numeric_limits< uint32_t >::max )() ? ( std::numeric_limits< uint32_t >::max )() : static_cast< uint32_t >( sum );
+}
+
+/// @brief  heap order: lowest key first, then the lowest index
+struct WorseEntry
+{
+    template < typename Entry >
+    bool operator ()( Entry const& a, Entry const& b ) const
+    {
+        if ( a.m_Key != b.m_Key )
+            return a.m_Key > b.m_Key;
+        return a.m_Index > b.m_Index;
+    }
+};
+
+} // namespace
+
+IncrementalPlanner::IncrementalPlanner( PathGrid const& grid, bool allowDiagonal ) :
+    m_Grid( grid ),
+    m_AllowDiagonal( allowDiagonal )
+{
+}
+
+//-----------------------------------------------------------------------------
+// Planning
+//-----------------------------------------------------------------------------
+
+void IncrementalPlanner::Plan( Vec2i const& start, Vec2i const& goal )
+{
+    if ( m_Nodes.size() < m_Grid.GetCellCount() )
+        m_Nodes.resize( m_Grid.GetCellCount(), Node{ kInfinity, kInfinity, {}, 0, false } );
+
+    // after wrapping around, stale stamps could match again
+    if ( ++m_Generation == 0 )
+    {
+        for ( Node& record : m_Nodes )
+            record.m_Stamp = 0;
+        m_Generation = 1;
+    }
+
+    m_Start = start;
+    m_KeyStart = start;
+    m_Goal = goal;
+    m_KeyOffset = 0;
+    m_Open.clear();
+    m_OpenCount = 0;
+    m_TotalExpanded = 0;
+    m_IsPlanned = m_Grid.InBounds( start ) && m_Grid.InBounds( goal );
+    if ( !m_IsPlanned )
+        return;
+
+    const uint32_t goalIndex = m_Grid.IndexOf( goal );
+    node( goalIndex ).m_Lookahead = 0;
+    update( goalIndex );
+}
+
+void IncrementalPlanner::SetStart( Vec2i const& start )
+{
+    if ( !m_IsPlanned || !m_Grid.InBounds( start ) )
+        return;
+
+    // every key already queued now overestimates by at most this much
+    m_KeyOffset = addCosts( m_KeyOffset, EstimateCost( m_AllowDiagonal ? Heuristic::Octile : Heuristic::Manhattan, m_KeyStart, start ) );
+    m_KeyStart = start;
+    m_Start = start;
+}
+
+void IncrementalPlanner::ApplyChanges( std::span< CellChanged const > changes )
+{
+    for ( CellChanged const& change : changes )
+        MarkChanged( change.m_X, change.m_Y );
+}
+
+void IncrementalPlanner::MarkChanged( int x, int y )
+{
+    if ( !m_IsPlanned || !m_Grid.InBounds( x, y ) )
+        return;
+
+    // every step whose cost depends on the cell starts at the cell or one of its
+    // neighbours: steps onto it, diagonals past its corner, and steps off it
+    const uint32_t goalIndex = m_Grid.IndexOf( m_Goal );
+    for ( int dy = -1; dy <= 1; ++dy )
+    {
+        for ( int dx = -1; dx <= 1; ++dx )
+        {
+            if ( !m_Grid.InBounds( x + dx, y + dy ) )
+                continue;
+
+            const uint32_t index = m_Grid.IndexOf( x + dx, y + dy );
+            if ( index == goalIndex )
+                continue;
+
+            recompute( index );
+            update( index );
+        }
+    }
+}
+
+PathResult IncrementalPlanner::Replan()
+{
+    PathResult result;
+    if ( !m_IsPlanned || !m_Grid.IsWalkable( m_Start ) || !m_Grid.IsWalkable( m_Goal ) )
+        return result;
+
+    const uint32_t startIndex = m_Grid.IndexOf( m_Start );
+    const uint32_t goalIndex = m_Grid.IndexOf( m_Goal );
+    auto const lessUrgent = WorseEntry{};
+
+    for ( ;; )
+    {
+        const bool hasOpen = trimOpen();
+        const Key startKey = keyOf( startIndex );
+        Node const& start = node( startIndex );
+        if ( !hasOpen || ( m_Open.front().m_Key >= startKey && start.m_Cost == start.m_Lookahead ) )
+            break;
+
+        std::pop_heap( m_Open.begin(), m_Open.end(), lessUrgent );
+        const OpenEntry entry = m_Open.back();
+        m_Open.pop_back();
+
+        const uint32_t index = entry.m_Index;
+        Node& current = node( index );
+        const Key key = keyOf( index );
+
+        // queued before the agent moved on; the real key is larger
+        if ( entry.m_Key < key )
+        {
+            current.m_Key = key;
+            m_Open.push_back( { key, index } );
+            std::push_heap( m_Open.begin(), m_Open.end(), lessUrgent );
+            continue;
+        }
+
+        current.m_IsOpen = false;
+        --m_OpenCount;
+        ++result.m_Expanded;
+
+        const Vec2i cell = m_Grid.CellOf( index );
+        if ( current.m_Cost > current.m_Lookahead )
+        {
+            // the cell got cheaper: settle it and offer it to every predecessor
+            current.m_Cost = current.m_Lookahead;
+            for ( std::size_t i = 0; i < directions(); ++i )
+            {
+                const Vec2i from{ cell.x() + kNeighborOffsets[ i ].x(), cell.y() + kNeighborOffsets[ i ].y() };
+                const uint32_t step = stepCost( from, cell );
+                if ( step == kInfinity )
+                    continue;
+
+                const uint32_t fromIndex = m_Grid.IndexOf( from );
+                if ( fromIndex == goalIndex )
+                    continue;
+
+                Node& predecessor = node( fromIndex );
+                predecessor.m_Lookahead = ( std::min )( predecessor.m_Lookahead, addCosts( step, current.m_Cost ) );
+                update( fromIndex );
+            }
+        }
+        else
+        {
+            // the cell got dearer: forget its cost, and every predecessor that relied on
+            // it looks for another way
+            const uint32_t previous = current.m_Cost;
+            current.m_Cost = kInfinity;
+            for ( std::size_t i = 0; i < directions(); ++i )
+            {
+                const Vec2i from{ cell.x() + kNeighborOffsets[ i ].x(), cell.y() + kNeighborOffsets[ i ].y() };
+                const uint32_t step = stepCost( from, cell );
+                if ( step == kInfinity )
+                    continue;
+
+                const uint32_t fromIndex = m_Grid.IndexOf( from );
+                if ( fromIndex != goalIndex && node( fromIndex ).m_Lookahead == addCosts( step, previous ) )
+                    recompute( fromIndex );
+                update( fromIndex );
+            }
+            if ( index != goalIndex )
+                recompute( index );
+            update( index );
+        }
+    }
+
+    m_TotalExpanded += result.m_Expanded;
+    const uint32_t cost = costOf( startIndex );
+    result.m_Status = cost == kInfinity ? PathStatus::NoPath : PathStatus::Found;
+    result.m_Cost = cost == kInfinity ? 0 : cost;
+    return result;
+}
+
+void IncrementalPlanner::ExtractPath( std::vector< Vec2i >& path ) const
+{
+    path.clear();
+    if ( !m_IsPlanned || !m_Grid.IsWalkable( m_Start ) || costOf( m_Grid.IndexOf( m_Start ) ) == kInfinity )
+        return;
+
+    // each step goes to the successor the start's cost was built from; the cell count
+    // bounds the walk should the costs be out of date
+    Vec2i cell = m_Start;
+    path.push_back( cell );
+    for ( std::size_t steps = 0; cell != m_Goal && steps < m_Grid.GetCellCount(); ++steps )
+    {
+        uint32_t best = kInfinity;
+        Vec2i next = cell;
+        for ( std::size_t i = 0; i < directions(); ++i )
+        {
+            const Vec2i to{ cell.x() + kNeighborOffsets[ i ].x(), cell.y() + kNeighborOffsets[ i ].y() };
+            const uint32_t step = stepCost( cell, to );
+            if ( step == kInfinity )
+                continue;
+
+            const uint32_t cost = addCosts( step, costOf( m_Grid.IndexOf( to ) ) );
+            if ( cost < best )
+            {
+                best = cost;
+                next = to;
+            }
+        }
+
+        if ( best == kInfinity )
+        {
+            path.clear();
+            return;
+        }
+        cell = next;
+        path.push_back( cell );
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Private Methods
+//-----------------------------------------------------------------------------
+
+IncrementalPlanner::Node& IncrementalPlanner::node( uint32_t index )
+{
+    Node& record = m_Nodes[ index ];
+    if ( record.m_Stamp != m_Generation )
+        record = { kInfinity, kInfinity, {}, m_Generation, false };
+    return record;
+}
+
+uint32_t IncrementalPlanner::stepCost( Vec2i const& from, Vec2i const& to ) const
+{
+    const uint8_t cost = m_Grid.GetCost( to );
+    if ( cost == 0 || !m_Grid.IsWalkable( from ) )
+        return kInfinity;
+
+    const int dx = to.x() - from.x();
+    const int dy = to.y() - from.y();
+    if ( dx == 0 || dy == 0 )
+        return kStraightStepCost * cost;
+
+    if ( !m_Grid.IsWalkable( from.x() + dx, from.y() ) || !m_Grid.IsWalkable( from.x(), from.y() + dy ) )
+        return kInfinity;
+    return kDiagonalStepCost * cost;
+}
+
+uint32_t IncrementalPlanner::estimate( Vec2i const& cell ) const
+{
+    return EstimateCost( m_AllowDiagonal ? Heuristic::Octile : Heuristic::Manhattan, m_Start, cell );
+}
+
+IncrementalPlanner::Key IncrementalPlanner::keyOf( uint32_t index )
+{
+    Node const& record = node( index );
+    const uint32_t best = ( std::min )( record.m_Cost, record.m_Lookahead );
+    return { addCosts( addCosts( best, estimate( m_Grid.CellOf( index ) ) ), m_KeyOffset ), best };
+}
+
+void IncrementalPlanner::recompute( uint32_t index )
+{
+    const Vec2i cell = m_Grid.CellOf( index );
+    uint32_t best = kInfinity;
+    for ( std::size_t i = 0; i < directions(); ++i )
+    {
+        const Vec2i to{ cell.x() + kNeighborOffsets[ i ].x(), cell.y() + kNeighborOffsets[ i ].y() };
+        const uint32_t step = stepCost( cell, to );
+        if ( step != kInfinity )
+            best = ( std::min )( best, addCosts( step, costOf( m_Grid.IndexOf( to ) ) ) );
+    }
+    node( index ).m_Lookahead = best;
+}
+
+void IncrementalPlanner::update( uint32_t index )
+{
+    Node& record = node( index );
+    if ( record.m_Cost == record.m_Lookahead )
+    {
+        if ( record.m_IsOpen )
+        {
+            record.m_IsOpen = false;
+            --m_OpenCount;
+        }
+        return;
+    }
+
+    const Key key = keyOf( index );
+    if ( record.m_IsOpen && record.m_Key == key )
+        return;
+
+    if ( !record.m_IsOpen )
+        ++m_OpenCount;
+    record.m_IsOpen = true;
+    record.m_Key = key;
+    m_Open.push_back( { key, index } );
+    std::push_heap( m_Open.begin(), m_Open.end(), WorseEntry{} );
+}
+
+bool IncrementalPlanner::trimOpen()
+{
+    auto isDead = [ this ]( OpenEntry const& entry )
+    {
+        Node const& record = m_Nodes[ entry.m_Index ];
+        return record.m_Stamp != m_Generation || !record.m_IsOpen || record.m_Key != entry.m_Key;
+    };
+
+    if ( m_Open.size() - m_OpenCount >= kMinDeadEntriesToCompact && m_Open.size() > 2 * m_OpenCount )
+    {
+        std::erase_if( m_Open, isDead );
+        std::make_heap( m_Open.begin(), m_Open.end(), WorseEntry{} );
+    }
+
+    while ( !m_Open.empty() && isDead( m_Open.front() ) )
+    {
+        std::pop_heap( m_Open.begin(), m_Open.end(), WorseEntry{} );
+        m_Open.pop_back();
+    }
+    return !m_Open.empty();
+}
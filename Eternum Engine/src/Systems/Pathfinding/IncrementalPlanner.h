@@ -0,0 +1,164 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: IncrementalPlanner
+* Description:
+*     Incremental replanning with D* Lite. The planner searches backwards from its goal
+*     and keeps that search between calls, so when cells change or the agent moves, a
+*     replan only repairs the costs the change actually affects instead of searching
+*     the whole map again. Planners read a shared PathGrid; whoever updates the grid
+*     passes the same batch of CellChanged events on to every planner.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef INCREMENTALPLANNER_H
+#define INCREMENTALPLANNER_H
+
+#include <pch.h>
+#include <span>
+#include <Systems/Pathfinding/Pathfinder.h>
+#include <Systems/Grid System/GridEvents.h>
+
+class IncrementalPlanner
+{
+public:
+    /// @param  grid            the grid to plan over; must outlive the planner
+    /// @param  allowDiagonal   whether to step diagonally; never across the corner of a
+    ///                         blocked cell
+    explicit IncrementalPlanner( PathGrid const& grid, bool allowDiagonal = true );
+
+    // Prevent copy construction and assignment
+    IncrementalPlanner( IncrementalPlanner const& ) = delete;
+    IncrementalPlanner& operator=( IncrementalPlanner const& ) = delete;
+
+//-----------------------------------------------------------------------------
+// Planning
+//-----------------------------------------------------------------------------
+
+    /// @brief  starts a new plan, forgetting the previous one
+    /// @param  start   the cell the agent is on
+    /// @param  goal    the cell to reach
+    void Plan( Vec2i const& start, Vec2i const& goal );
+
+    /// @brief  moves the agent, keeping everything searched so far
+    /// @param  start   the cell the agent is now on
+    void SetStart( Vec2i const& start );
+
+    /// @brief  takes in a batch of cell changes; the grid must already hold the new costs
+    void ApplyChanges( std::span< CellChanged const > changes );
+
+    /// @brief  takes in one changed cell; the grid must already hold its new cost
+    void MarkChanged( int x, int y );
+
+    /// @brief  brings the plan up to date with every change and move since the last call
+    /// @return the outcome; m_Cost is the cost from the start to the goal, and m_Expanded
+    ///         counts the cells expanded by this call alone
+    PathResult Replan();
+
+    /// @brief  writes the current path, every cell from the start to the goal inclusive
+    /// @param  path    receives the cells; cleared first, and left empty without a path
+    /// @note   call after Replan; changes since then are not reflected
+    void ExtractPath( std::vector< Vec2i >& path ) const;
+
+//-----------------------------------------------------------------------------
+// Public Accessors
+//-----------------------------------------------------------------------------
+
+    Vec2i const& GetStart() const { return m_Start; }
+    Vec2i const& GetGoal() const { return m_Goal; }
+
+    /// @brief  gets the cells expanded since Plan, across every Replan
+    uint64_t GetTotalExpanded() const { return m_TotalExpanded; }
+
+private:
+    static constexpr uint32_t kInfinity = ( std::numeric_limits< uint32_t >::max )();
+
+    /// @brief  priority of a cell in the open list, compared first element first
+    struct Key
+    {
+        uint32_t m_Primary;
+        uint32_t m_Secondary;
+
+        auto operator<=>( Key const& ) const = default;
+    };
+
+    struct OpenEntry
+    {
+        Key m_Key;
+        uint32_t m_Index;
+    };
+
+    /// @brief  search state of one cell
+    struct Node
+    {
+        /// @brief  the cost to the goal as last expanded
+        uint32_t m_Cost;
+
+        /// @brief  the cost to the goal through the best successor (the one-step lookahead)
+        uint32_t m_Lookahead;
+
+        /// @brief  the key of the cell's current open-list entry
+        Key m_Key;
+
+        /// @brief  the Plan that last touched the cell; older values are garbage
+        uint32_t m_Stamp;
+
+        bool m_IsOpen;
+    };
+
+    /// @brief  gets a cell's state, resetting it on first use in this Plan
+    Node& node( uint32_t index );
+
+    uint32_t costOf( uint32_t index ) const
+    {
+        return m_Nodes[ index ].m_Stamp == m_Generation ? m_Nodes[ index ].m_Cost : kInfinity;
+    }
+
+    /// @brief  gets the cost of a step between two neighbouring cells, or kInfinity when
+    ///         the step is not allowed
+    uint32_t stepCost( Vec2i const& from, Vec2i const& to ) const;
+
+    uint32_t estimate( Vec2i const& cell ) const;
+    Key keyOf( uint32_t index );
+
+    /// @brief  recomputes a cell's lookahead from its successors
+    void recompute( uint32_t index );
+
+    /// @brief  queues a cell whose cost and lookahead disagree, and dequeues it otherwise
+    void update( uint32_t index );
+
+    /// @brief  drops dead entries from the top of the open list
+    /// @return whether anything is left
+    bool trimOpen();
+
+    std::size_t directions() const { return m_AllowDiagonal ? 8 : 4; }
+
+    PathGrid const& m_Grid;
+    bool m_AllowDiagonal;
+
+    Vec2i m_Start;
+    Vec2i m_Goal;
+
+    /// @brief  where the agent was when the keys in the open list were computed
+    Vec2i m_KeyStart;
+
+    /// @brief  sum of the estimates between every start the agent has moved through,
+    ///         added to new keys so the old ones stay valid lower bounds
+    uint32_t m_KeyOffset = 0;
+
+    bool m_IsPlanned = false;
+
+    std::vector< Node > m_Nodes;
+    uint32_t m_Generation = 0;
+
+    /// @brief  binary heap, best entry first; entries whose key no longer matches their
+    ///         cell's are skipped when they reach the top
+    std::vector< OpenEntry > m_Open;
+    std::size_t m_OpenCount = 0;
+
+    uint64_t m_TotalExpanded = 0;
+};
+
+#endif //INCREMENTALPLANNER_H
@@ -0,0 +1,66 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: PathGrid
+* Description:
+*     Implements building and editing the movement-cost view of a grid.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+
+#include <pch.h>
+#include "PathGrid.h"
+
+//-----------------------------------------------------------------------------
+// TerrainCosts
+//-----------------------------------------------------------------------------
+
+TerrainCosts TerrainCosts::Default()
+{
+    TerrainCosts costs;
+    costs.m_Costs.fill( 1 );
+    costs.Set( '#', 0 );
+    costs.Set( ' ', 0 );
+    return costs;
+}
+
+//-----------------------------------------------------------------------------
+// PathGrid
+//-----------------------------------------------------------------------------
+
+PathGrid::PathGrid( GridSystem::Grid const& grid, TerrainCosts const& costs )
+{
+    Build( grid, costs );
+}
+
+void PathGrid::Build( GridSystem::Grid const& grid, TerrainCosts const& costs )
+{
+    m_Width = grid.m_Dimension.m_Width;
+    m_Height = grid.m_Dimension.m_Height;
+    m_Terrain = costs;
+
+    m_Costs.resize( grid.cells.size() );
+    m_WeightedCells = 0;
+    for ( std::size_t i = 0; i < grid.cells.size(); ++i )
+    {
+        m_Costs[ i ] = costs[ grid.cells[ i ] ];
+        m_WeightedCells += m_Costs[ i ] > 1 ? 1 : 0;
+    }
+}
+
+bool PathGrid::SetCost( int x, int y, uint8_t cost )
+{
+    if ( !InBounds( x, y ) )
+        return false;
+
+    uint8_t& current = m_Costs[ IndexOf( x, y ) ];
+    if ( current == cost )
+        return false;
+
+    m_WeightedCells -= current > 1 ? 1 : 0;
+    m_WeightedCells += cost > 1 ? 1 : 0;
+    current = cost;
+    return true;
+}
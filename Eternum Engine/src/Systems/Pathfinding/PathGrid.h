@@ -0,0 +1,126 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: PathGrid
+* Description:
+*     The movement-cost view of a GridSystem::Grid that every pathfinder searches. Each
+*     cell's character is mapped through a TerrainCosts table to a step cost, with zero
+*     meaning blocked, and the result is kept as one byte per cell so searches never
+*     touch the character map.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef PATHGRID_H
+#define PATHGRID_H
+
+#include <pch.h>
+#include <Systems/Grid System/GridSystem.h>
+
+/// @brief  cost of a straight step onto a cell of cost 1
+constexpr uint32_t kStraightStepCost = 10;
+
+/// @brief  cost of a diagonal step onto a cell of cost 1, sqrt( 2 ) rounded to the
+///         same scale
+constexpr uint32_t kDiagonalStepCost = 14;
+
+/// @brief  the eight neighbours of a cell: the four straight ones first, then the four
+///         diagonals
+constexpr Vec2i kNeighborOffsets[] = {
+    {  1,  0 }, {  0,  1 }, { -1,  0 }, {  0, -1 },
+    {  1,  1 }, { -1,  1 }, { -1, -1 }, {  1, -1 }
+};
+
+/// @brief  per-character movement costs; zero marks a blocked cell
+struct TerrainCosts
+{
+    std::array< uint8_t, 256 > m_Costs{};
+
+    /// @brief  gets the default table: walls ('#') and empty space (' ') block, everything
+    ///         else costs 1
+    static TerrainCosts Default();
+
+    /// @brief  gets the cost of a character
+    uint8_t operator []( char cell ) const { return m_Costs[ static_cast< uint8_t >( cell ) ]; }
+
+    /// @brief  sets the cost of a character
+    void Set( char cell, uint8_t cost ) { m_Costs[ static_cast< uint8_t >( cell ) ] = cost; }
+};
+
+/// @brief  movement costs of every cell of a grid, row by row
+class PathGrid
+{
+public:
+    PathGrid() = default;
+
+    /// @brief  builds the costs of every cell of a grid
+    /// @param  grid    the grid to read
+    /// @param  costs   the cost of each character
+    explicit PathGrid( GridSystem::Grid const& grid, TerrainCosts const& costs = TerrainCosts::Default() );
+
+    /// @brief  rebuilds from a grid, reusing the storage
+    void Build( GridSystem::Grid const& grid, TerrainCosts const& costs = TerrainCosts::Default() );
+
+    /// @brief  re-reads one cell after it changed in the source grid
+    /// @param  x       column of the cell
+    /// @param  y       row of the cell
+    /// @param  value   the cell's new character
+    /// @return whether the cell's cost changed
+    bool SetCell( int x, int y, char value ) { return SetCost( x, y, m_Terrain[ value ] ); }
+
+    /// @brief  sets the cost of one cell directly
+    /// @return whether the cost changed; out-of-bounds cells are ignored
+    bool SetCost( int x, int y, uint8_t cost );
+
+//-----------------------------------------------------------------------------
+// Public Accessors
+//-----------------------------------------------------------------------------
+
+    int GetWidth() const { return m_Width; }
+    int GetHeight() const { return m_Height; }
+
+    /// @brief  gets the number of cells
+    std::size_t GetCellCount() const { return m_Costs.size(); }
+
+    bool InBounds( int x, int y ) const { return x >= 0 && y >= 0 && x < m_Width && y < m_Height; }
+    bool InBounds( Vec2i const& cell ) const { return InBounds( cell.x(), cell.y() ); }
+
+    /// @brief  gets the cost of a cell; out-of-bounds cells are blocked
+    uint8_t GetCost( int x, int y ) const { return InBounds( x, y ) ? m_Costs[ IndexOf( x, y ) ] : 0; }
+    uint8_t GetCost( Vec2i const& cell ) const { return GetCost( cell.x(), cell.y() ); }
+
+    /// @brief  gets the cost of a cell by index, which must be in range
+    uint8_t GetCost( uint32_t index ) const { return m_Costs[ index ]; }
+
+    bool IsWalkable( int x, int y ) const { return GetCost( x, y ) != 0; }
+    bool IsWalkable( Vec2i const& cell ) const { return GetCost( cell ) != 0; }
+
+    /// @brief  gets whether every walkable cell costs 1, which jump point search needs
+    bool IsUniform() const { return m_WeightedCells == 0; }
+
+    uint32_t IndexOf( int x, int y ) const { return static_cast< uint32_t >( y ) * m_Width + x; }
+    uint32_t IndexOf( Vec2i const& cell ) const { return IndexOf( cell.x(), cell.y() ); }
+
+    Vec2i CellOf( uint32_t index ) const
+    {
+        return { static_cast< int >( index % m_Width ), static_cast< int >( index / m_Width ) };
+    }
+
+    /// @brief  gets the table cells are read through
+    TerrainCosts const& GetTerrain() const { return m_Terrain; }
+
+private:
+    int m_Width = 0;
+    int m_Height = 0;
+
+    /// @brief  cost of each cell, row by row
+    std::vector< uint8_t > m_Costs;
+
+    /// @brief  number of walkable cells whose cost is not 1
+    std::size_t m_WeightedCells = 0;
+
+    TerrainCosts m_Terrain = TerrainCosts::Default();
+};
+
+#endif //PATHGRID_H
@@ -0,0 +1,363 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: PathQueryService
+* Description:
+*     Implements queuing, collapsing and budgeted parallel stepping of path requests.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+
+#include <pch.h>
+#include "PathQueryService.h"
+#include <Core/Jobs/JobSystem.h>
+
+PathQueryService::PathQueryService( PathGrid const& grid ) :
+    m_Grid( grid ),
+    m_MaxActiveSearches( 2 * ( std::size_t{ Jobs()->GetWorkerCount() } + 1 ) )
+{
+}
+
+PathQueryService::~PathQueryService() = default;
+
+//-----------------------------------------------------------------------------
+// Requests
+//-----------------------------------------------------------------------------
+
+PathHandle PathQueryService::Request( Vec2i const& start, Vec2i const& goal, int priority, PathOptions const& options )
+{
+    std::lock_guard< std::mutex > lock( m_Mutex );
+
+    uint32_t index = static_cast< uint32_t >( m_Slots.size() );
+    if ( m_FreeSlots.empty() )
+    {
+        m_Slots.emplace_back();
+    }
+    else
+    {
+        index = m_FreeSlots.back();
+        m_FreeSlots.pop_back();
+    }
+
+    Slot& slot = m_Slots[ index ];
+    slot.m_Query = kNone;
+    slot.m_IsLive = true;
+
+    m_Incoming.push_back( { index, { start, goal, options.m_Algorithm, options.m_Heuristic, options.m_AllowDiagonal }, priority } );
+    return { index, slot.m_Generation };
+}
+
+void PathQueryService::Release( PathHandle handle )
+{
+    uint32_t query = kNone;
+    {
+        std::lock_guard< std::mutex > lock( m_Mutex );
+        if ( handle.m_Index >= m_Slots.size() )
+            return;
+
+        Slot& slot = m_Slots[ handle.m_Index ];
+        if ( !slot.m_IsLive || slot.m_Generation != handle.m_Generation )
+            return;
+
+        // a request not taken in yet is skipped when its turn comes
+        query = slot.m_Query;
+        slot.m_IsLive = false;
+        if ( query != kNone )
+        {
+            ++slot.m_Generation;
+            m_FreeSlots.push_back( handle.m_Index );
+        }
+    }
+
+    if ( query != kNone )
+        releaseQuery( query );
+}
+
+void PathQueryService::Clear()
+{
+    std::lock_guard< std::mutex > lock( m_Mutex );
+
+    m_FreeSlots.clear();
+    for ( uint32_t index = 0; index < m_Slots.size(); ++index )
+    {
+        Slot& slot = m_Slots[ index ];
+        slot = { slot.m_Generation + 1, kNone, false };
+        m_FreeSlots.push_back( index );
+    }
+    m_Incoming.clear();
+
+    m_Queries.clear();
+    m_FreeQueries.clear();
+    m_Waiting.clear();
+    m_Active.clear();
+    m_FreeBuffers.clear();
+    for ( auto const& buffers : m_Buffers )
+        m_FreeBuffers.push_back( buffers.get() );
+}
+
+void PathQueryService::Update()
+{
+    takeRequests();
+
+    // searches whose every handle was released stop taking up a slot
+    std::erase_if( m_Active, [ this ]( uint32_t query )
+    {
+        if ( m_Queries[ query ].m_References != 0 )
+            return false;
+        freeQuery( query );
+        return true;
+    } );
+
+    startQueries();
+
+    // hand out the budget a slice at a time, most urgent search first
+    std::sort( m_Active.begin(), m_Active.end(), [ this ]( uint32_t a, uint32_t b ) { return isMoreUrgent( a, b ); } );
+
+    m_Stepping.clear();
+    uint32_t remaining = m_FrameBudget;
+    for ( uint32_t query : m_Active )
+    {
+        if ( remaining == 0 )
+            break;
+
+        Query& record = m_Queries[ query ];
+        record.m_Slice = ( std::min )( m_SliceExpansions, remaining );
+        remaining -= record.m_Slice;
+        m_Stepping.push_back( query );
+    }
+
+    // one search per chunk, so no search is ever stepped by two threads
+    Jobs()->ParallelFor( m_Stepping.size(), 1, [ this ]( std::size_t begin, std::size_t end )
+    {
+        for ( std::size_t i = begin; i < end; ++i )
+            stepQuery( m_Queries[ m_Stepping[ i ] ] );
+    } );
+
+    m_LastFrameExpansions = 0;
+    for ( uint32_t query : m_Stepping )
+        m_LastFrameExpansions += m_Queries[ query ].m_Spent;
+
+    std::erase_if( m_Active, [ this ]( uint32_t query )
+    {
+        Query& record = m_Queries[ query ];
+        if ( !record.m_IsDone )
+            return false;
+
+        record.m_Search.reset();
+        m_FreeBuffers.push_back( record.m_Buffers );
+        record.m_Buffers = nullptr;
+        return true;
+    } );
+}
+
+//-----------------------------------------------------------------------------
+// Results
+//-----------------------------------------------------------------------------
+
+PathStatus PathQueryService::GetStatus( PathHandle handle ) const
+{
+    return GetResult( handle ).m_Status;
+}
+
+PathResult PathQueryService::GetResult( PathHandle handle ) const
+{
+    std::lock_guard< std::mutex > lock( m_Mutex );
+    if ( handle.m_Index >= m_Slots.size() )
+        return {};
+
+    Slot const& slot = m_Slots[ handle.m_Index ];
+    if ( !slot.m_IsLive || slot.m_Generation != handle.m_Generation )
+        return {};
+
+    PathResult result;
+    result.m_Status = PathStatus::Searching;
+    if ( Query const* query = find( handle ) ; query != nullptr && query->m_IsDone )
+        result = query->m_Result;
+    return result;
+}
+
+bool PathQueryService::GetPath( PathHandle handle, std::vector< Vec2i >& path ) const
+{
+    std::lock_guard< std::mutex > lock( m_Mutex );
+
+    Query const* query = find( handle );
+    if ( query == nullptr || !query->m_IsDone || !query->m_Result.IsFound() )
+        return false;
+
+    path = query->m_Path;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Private Methods
+//-----------------------------------------------------------------------------
+
+std::size_t PathQueryService::QueryKeyHash::operator ()( QueryKey const& key ) const
+{
+    uint64_t hash = 1469598103934665603ull;
+    auto mix = [ &hash ]( uint64_t value )
+    {
+        hash ^= value;
+        hash *= 1099511628211ull;
+    };
+    mix( static_cast< uint32_t >( key.m_Start.x() ) | uint64_t( static_cast< uint32_t >( key.m_Start.y() ) ) << 32 );
+    mix( static_cast< uint32_t >( key.m_Goal.x() ) | uint64_t( static_cast< uint32_t >( key.m_Goal.y() ) ) << 32 );
+    mix( uint64_t( key.m_Algorithm ) | uint64_t( key.m_Heuristic ) << 8 | uint64_t( key.m_AllowDiagonal ) << 16 );
+    return static_cast< std::size_t >( hash );
+}
+
+bool PathQueryService::isMoreUrgent( uint32_t a, uint32_t b ) const
+{
+    Query const& first = m_Queries[ a ];
+    Query const& second = m_Queries[ b ];
+    if ( first.m_Priority != second.m_Priority )
+        return first.m_Priority > second.m_Priority;
+    return first.m_Sequence < second.m_Sequence;
+}
+
+void PathQueryService::takeRequests()
+{
+    thread_local std::vector< Incoming > t_Incoming;
+    t_Incoming.clear();
+
+    std::lock_guard< std::mutex > lock( m_Mutex );
+    t_Incoming.swap( m_Incoming );
+    m_ThisFrame.clear();
+
+    for ( Incoming const& request : t_Incoming )
+    {
+        Slot& slot = m_Slots[ request.m_Slot ];
+        if ( !slot.m_IsLive )
+        {
+            // released before it was ever taken in
+            ++slot.m_Generation;
+            m_FreeSlots.push_back( request.m_Slot );
+            continue;
+        }
+
+        auto [ it, isNew ] = m_ThisFrame.try_emplace( request.m_Key, kNone );
+        if ( !isNew )
+        {
+            Query& query = m_Queries[ it->second ];
+            ++query.m_References;
+            query.m_Priority = ( std::max )( query.m_Priority, request.m_Priority );
+            slot.m_Query = it->second;
+            ++m_CollapsedCount;
+            continue;
+        }
+
+        uint32_t index = static_cast< uint32_t >( m_Queries.size() );
+        if ( m_FreeQueries.empty() )
+        {
+            m_Queries.emplace_back();
+        }
+        else
+        {
+            index = m_FreeQueries.back();
+            m_FreeQueries.pop_back();
+        }
+
+        Query& query = m_Queries[ index ];
+        query.m_Key = request.m_Key;
+        query.m_Priority = request.m_Priority;
+        query.m_Sequence = m_NextSequence++;
+        query.m_References = 1;
+        it->second = index;
+        slot.m_Query = index;
+    }
+
+    // priorities only settle once every duplicate has been seen
+    for ( auto const& [ key, query ] : m_ThisFrame )
+    {
+        m_Waiting.push_back( query );
+        std::push_heap( m_Waiting.begin(), m_Waiting.end(), [ this ]( uint32_t a, uint32_t b ) { return isMoreUrgent( b, a ); } );
+    }
+}
+
+void PathQueryService::startQueries()
+{
+    auto lessUrgent = [ this ]( uint32_t a, uint32_t b ) { return isMoreUrgent( b, a ); };
+
+    while ( m_Active.size() < m_MaxActiveSearches && !m_Waiting.empty() )
+    {
+        std::pop_heap( m_Waiting.begin(), m_Waiting.end(), lessUrgent );
+        const uint32_t index = m_Waiting.back();
+        m_Waiting.pop_back();
+
+        Query& query = m_Queries[ index ];
+        if ( query.m_References == 0 )
+        {
+            freeQuery( index );
+            continue;
+        }
+
+        if ( m_FreeBuffers.empty() )
+        {
+            m_Buffers.push_back( std::make_unique< SearchBuffers >() );
+            m_FreeBuffers.push_back( m_Buffers.back().get() );
+        }
+        query.m_Buffers = m_FreeBuffers.back();
+        m_FreeBuffers.pop_back();
+
+        // started by the first slice, on whichever thread runs it
+        query.m_Search = std::make_unique< PathSearch >( *query.m_Buffers );
+        m_Active.push_back( index );
+    }
+}
+
+void PathQueryService::stepQuery( Query& query ) const
+{
+    PathSearch& search = *query.m_Search;
+    if ( query.m_Result.m_Status != PathStatus::Searching )
+        search.Start( m_Grid, query.m_Key.m_Start, query.m_Key.m_Goal,
+                      { query.m_Key.m_Algorithm, query.m_Key.m_Heuristic, query.m_Key.m_AllowDiagonal } );
+
+    const uint32_t before = search.GetResult().m_Expanded;
+    search.Step( query.m_Slice );
+    query.m_Spent = search.GetResult().m_Expanded - before;
+    query.m_Result = search.GetResult();
+
+    if ( query.m_Result.m_Status != PathStatus::Searching )
+    {
+        search.ExtractPath( query.m_Path );
+        query.m_IsDone = true;
+    }
+}
+
+void PathQueryService::releaseQuery( uint32_t query )
+{
+    Query& record = m_Queries[ query ];
+    if ( --record.m_References != 0 )
+        return;
+
+    // waiting and active queries are freed by Update, which owns those lists
+    if ( record.m_IsDone )
+        freeQuery( query );
+}
+
+void PathQueryService::freeQuery( uint32_t query )
+{
+    Query& record = m_Queries[ query ];
+    if ( record.m_Buffers != nullptr )
+        m_FreeBuffers.push_back( record.m_Buffers );
+
+    record.m_Search.reset();
+    record.m_Buffers = nullptr;
+    record.m_IsDone = false;
+    record.m_Result = {};
+    record.m_Path.clear();
+    m_FreeQueries.push_back( query );
+}
+
+PathQueryService::Query const* PathQueryService::find( PathHandle handle ) const
+{
+    if ( handle.m_Index >= m_Slots.size() )
+        return nullptr;
+
+    Slot const& slot = m_Slots[ handle.m_Index ];
+    if ( !slot.m_IsLive || slot.m_Generation != handle.m_Generation || slot.m_Query == kNone )
+        return nullptr;
+    return &m_Queries[ slot.m_Query ];
+}
@@ -0,0 +1,257 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: PathQueryService
+* Description:
+*     Queues path requests from any thread and answers them a frame budget at a time.
+*     Each Update collapses identical requests made since the last one into a single
+*     search, starts the most urgent searches, and steps them in parallel on the
+*     JobSystem. A search that outruns its slice of the budget carries on next frame.
+*     Callers poll their results by handle.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef PATHQUERYSERVICE_H
+#define PATHQUERYSERVICE_H
+
+#include <pch.h>
+#include <unordered_map>
+#include <Systems/Pathfinding/Pathfinder.h>
+
+/// @brief  reference to a path request: a slot index plus the slot's generation
+struct PathHandle
+{
+    /// @brief  index value used by handles that do not reference any slot
+    static constexpr uint32_t kInvalidIndex = 0xFFFFFFFFu;
+
+    uint32_t m_Index = kInvalidIndex;
+    uint32_t m_Generation = 0;
+
+    bool IsNull() const { return m_Index == kInvalidIndex; }
+
+    bool operator==( PathHandle const& other ) const
+    {
+        return m_Index == other.m_Index && m_Generation == other.m_Generation;
+    }
+    bool operator!=( PathHandle const& other ) const { return !( *this == other ); }
+};
+
+class PathQueryService
+{
+public:
+    /// @brief  expansions spent across all searches in one Update, by default
+    static constexpr uint32_t kDefaultFrameBudget = 200000;
+
+    /// @brief  expansions one search may take in one Update, by default
+    static constexpr uint32_t kDefaultSliceExpansions = 8192;
+
+    /// @param  grid    the grid every request searches; must outlive the service
+    explicit PathQueryService( PathGrid const& grid );
+    ~PathQueryService();
+
+    // Prevent copy construction and assignment
+    PathQueryService( PathQueryService const& ) = delete;
+    PathQueryService& operator=( PathQueryService const& ) = delete;
+
+//-----------------------------------------------------------------------------
+// Requests
+//-----------------------------------------------------------------------------
+
+    /// @brief  queues a path request
+    /// @param  start       the cell to start from
+    /// @param  goal        the cell to reach
+    /// @param  priority    higher priorities are searched first; equal ones in request order
+    /// @param  options     the algorithm, heuristic and movement rules
+    /// @return handle to poll the result with; valid until released
+    /// @note   safe to call from multiple threads, including during Update
+    PathHandle Request( Vec2i const& start, Vec2i const& goal, int priority = 0, PathOptions const& options = {} );
+
+    /// @brief  gives up a handle; a search nobody holds a handle to any more is dropped
+    /// @note   call from the thread that calls Update, like every method below
+    void Release( PathHandle handle );
+
+    /// @brief  drops every request and search, invalidating all handles; needed before the
+    ///         grid is rebuilt to a different size
+    void Clear();
+
+    /// @brief  runs one frame of searching: takes in new requests, then spends up to the
+    ///         frame budget on the searches in priority order, in parallel
+    /// @note   call from one thread; searches read the grid, so it must not change during
+    ///         Update. Edits between Updates are seen by searches still in progress
+    void Update();
+
+//-----------------------------------------------------------------------------
+// Results
+//-----------------------------------------------------------------------------
+
+    /// @brief  gets the status of a request
+    /// @return Searching while queued or in progress, and Invalid for a released handle
+    PathStatus GetStatus( PathHandle handle ) const;
+
+    /// @brief  gets the outcome of a request
+    /// @return the result once finished; m_Status alone otherwise
+    PathResult GetResult( PathHandle handle ) const;
+
+    /// @brief  copies the path found for a request
+    /// @param  path    receives every cell from start to goal inclusive
+    /// @return whether the request has finished with a path
+    bool GetPath( PathHandle handle, std::vector< Vec2i >& path ) const;
+
+//-----------------------------------------------------------------------------
+// Budget
+//-----------------------------------------------------------------------------
+
+    /// @brief  sets the most expansions spent across all searches in one Update
+    void SetFrameBudget( uint32_t expansions ) { m_FrameBudget = expansions; }
+
+    /// @brief  sets the most expansions one search may take in one Update
+    void SetSliceExpansions( uint32_t expansions ) { m_SliceExpansions = ( std::max )( expansions, 1u ); }
+
+    /// @brief  sets how many searches may be in progress at once; each holds search
+    ///         buffers the size of the grid. Defaults to twice the number of threads
+    void SetMaxActiveSearches( std::size_t count ) { m_MaxActiveSearches = ( std::max )( count, std::size_t{ 1 } ); }
+
+//-----------------------------------------------------------------------------
+// Public Accessors
+//-----------------------------------------------------------------------------
+
+    uint32_t GetFrameBudget() const { return m_FrameBudget; }
+    uint32_t GetSliceExpansions() const { return m_SliceExpansions; }
+    std::size_t GetMaxActiveSearches() const { return m_MaxActiveSearches; }
+
+    /// @brief  gets the number of searches waiting to start
+    std::size_t GetWaitingCount() const { return m_Waiting.size(); }
+
+    /// @brief  gets the number of searches in progress
+    std::size_t GetActiveCount() const { return m_Active.size(); }
+
+    /// @brief  gets the expansions spent by the last Update
+    uint32_t GetLastFrameExpansions() const { return m_LastFrameExpansions; }
+
+    /// @brief  gets how many requests have been answered by another request's search
+    uint64_t GetCollapsedCount() const { return m_CollapsedCount; }
+
+private:
+    static constexpr uint32_t kNone = ( std::numeric_limits< uint32_t >::max )();
+
+    /// @brief  what makes two requests the same search
+    struct QueryKey
+    {
+        Vec2i m_Start;
+        Vec2i m_Goal;
+        PathAlgorithm m_Algorithm;
+        Heuristic m_Heuristic;
+        bool m_AllowDiagonal;
+
+        bool operator==( QueryKey const& other ) const
+        {
+            return m_Start == other.m_Start && m_Goal == other.m_Goal && m_Algorithm == other.m_Algorithm &&
+                   m_Heuristic == other.m_Heuristic && m_AllowDiagonal == other.m_AllowDiagonal;
+        }
+    };
+
+    struct QueryKeyHash
+    {
+        std::size_t operator ()( QueryKey const& key ) const;
+    };
+
+    /// @brief  a request as queued by Request, before Update takes it in
+    struct Incoming
+    {
+        uint32_t m_Slot;
+        QueryKey m_Key;
+        int m_Priority;
+    };
+
+    /// @brief  one search, shared by every handle that asked for it
+    struct Query
+    {
+        QueryKey m_Key;
+        int m_Priority = 0;
+
+        /// @brief  order of arrival, to keep equal priorities first come first served
+        uint64_t m_Sequence = 0;
+
+        /// @brief  number of live handles; the search is dropped when it reaches zero
+        uint32_t m_References = 0;
+
+        /// @brief  set while the search is in progress
+        std::unique_ptr< PathSearch > m_Search;
+        SearchBuffers* m_Buffers = nullptr;
+
+        /// @brief  expansions granted this frame, and those actually taken
+        uint32_t m_Slice = 0;
+        uint32_t m_Spent = 0;
+
+        bool m_IsDone = false;
+        PathResult m_Result;
+        std::vector< Vec2i > m_Path;
+    };
+
+    /// @brief  what a handle points at
+    struct Slot
+    {
+        uint32_t m_Generation = 0;
+
+        /// @brief  the query answering the handle; kNone until Update takes it in
+        uint32_t m_Query = kNone;
+        bool m_IsLive = false;
+    };
+
+    /// @brief  orders queries most urgent first
+    bool isMoreUrgent( uint32_t a, uint32_t b ) const;
+
+    /// @brief  moves new requests into queries, collapsing identical ones
+    void takeRequests();
+
+    /// @brief  starts waiting queries until the active limit is reached
+    void startQueries();
+
+    /// @brief  runs one slice of a query's search
+    void stepQuery( Query& query ) const;
+
+    /// @brief  drops a reference to a query, freeing it once nobody needs it
+    void releaseQuery( uint32_t query );
+
+    void freeQuery( uint32_t query );
+
+    /// @brief  gets the query behind a live handle, or null; the caller holds m_Mutex
+    Query const* find( PathHandle handle ) const;
+
+    PathGrid const& m_Grid;
+
+    uint32_t m_FrameBudget = kDefaultFrameBudget;
+    uint32_t m_SliceExpansions = kDefaultSliceExpansions;
+    std::size_t m_MaxActiveSearches;
+
+    /// @brief  guards the slots and incoming requests, which Request touches from any thread
+    mutable std::mutex m_Mutex;
+    std::vector< Slot > m_Slots;
+    std::vector< uint32_t > m_FreeSlots;
+    std::vector< Incoming > m_Incoming;
+
+    std::vector< Query > m_Queries;
+    std::vector< uint32_t > m_FreeQueries;
+    uint64_t m_NextSequence = 0;
+
+    /// @brief  heap of queries not started yet, most urgent first
+    std::vector< uint32_t > m_Waiting;
+    std::vector< uint32_t > m_Active;
+
+    /// @brief  the active queries granted a slice this frame
+    std::vector< uint32_t > m_Stepping;
+
+    /// @brief  one set of buffers per search that can be in progress
+    std::vector< std::unique_ptr< SearchBuffers > > m_Buffers;
+    std::vector< SearchBuffers* > m_FreeBuffers;
+
+    /// @brief  requests taken in this frame, by what they search for
+    std::unordered_map< QueryKey, uint32_t, QueryKeyHash > m_ThisFrame;
+
+    uint32_t m_LastFrameExpansions = 0;
+    uint64_t m_CollapsedCount = 0;
+};
+
+#endif //PATHQUERYSERVICE_H
@@ -0,0 +1,361 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: Pathfinder
+* Description:
+*     Implements A* and jump point search over a PathGrid.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+
+#include <pch.h>
+#include "Pathfinder.h"
+#include <Core/Math/Fixed.h>
+
+namespace {
+
+/// @brief  heap order: lowest priority first, then the deepest node, then the lowest index,
+///         so equal-cost ties always break the same way
+struct WorseEntry
+{
+    template < typename Entry >
+    bool operator ()( Entry const& a, Entry const& b ) const
+    {
+        if ( a.m_Priority != b.m_Priority )
+            return a.m_Priority > b.m_Priority;
+        if ( a.m_Cost != b.m_Cost )
+            return a.m_Cost < b.m_Cost;
+        return a.m_Index > b.m_Index;
+    }
+};
+
+int sign( int value ) { return ( value > 0 ) - ( value < 0 ); }
+
+/// @brief  cost of a straight or diagonal line of uniform-cost cells
+uint32_t lineCost( int dx, int dy )
+{
+    const uint32_t ax = static_cast< uint32_t >( std::abs( dx ) );
+    const uint32_t ay = static_cast< uint32_t >( std::abs( dy ) );
+    return ( std::max )( ax, ay ) * kStraightStepCost + ( std::min )( ax, ay ) * ( kDiagonalStepCost - kStraightStepCost );
+}
+
+} // namespace
+
+uint32_t EstimateCost( Heuristic heuristic, Vec2i const& from, Vec2i const& to )
+{
+    const uint32_t dx = static_cast< uint32_t >( std::abs( to.x() - from.x() ) );
+    const uint32_t dy = static_cast< uint32_t >( std::abs( to.y() - from.y() ) );
+
+    switch ( heuristic )
+    {
+        case Heuristic::Octile:     return lineCost( static_cast< int >( dx ), static_cast< int >( dy ) );
+        case Heuristic::Chebyshev:  return ( std::max )( dx, dy ) * kStraightStepCost;
+        case Heuristic::Manhattan:  return ( dx + dy ) * kStraightStepCost;
+
+        // sqrt( 98 ) per cell keeps a pure diagonal at exactly kDiagonalStepCost per step,
+        // so the estimate never exceeds the octile cost
+        case Heuristic::Euclidean:
+            return static_cast< uint32_t >( FixedDetail::ISqrt( 98 * ( uint64_t( dx ) * dx + uint64_t( dy ) * dy ) ) );
+
+        case Heuristic::None:       return 0;
+    }
+    return 0;
+}
+
+//-----------------------------------------------------------------------------
+// SearchBuffers
+//-----------------------------------------------------------------------------
+
+SearchBuffers& SearchBuffers::ThisThread()
+{
+    thread_local SearchBuffers t_Buffers;
+    return t_Buffers;
+}
+
+void SearchBuffers::Begin( std::size_t nodeCount )
+{
+    if ( m_Nodes.size() < nodeCount )
+        m_Nodes.resize( nodeCount, Node{ 0, 0, 0 } );
+
+    // after wrapping around, stale stamps could match again
+    if ( ++m_Generation == 0 )
+    {
+        for ( Node& node : m_Nodes )
+            node.m_Stamp = 0;
+        m_Generation = 1;
+    }
+
+    m_Open.clear();
+}
+
+bool SearchBuffers::Reach( uint32_t node, uint32_t parent, uint32_t cost, uint32_t estimate )
+{
+    Node& record = m_Nodes[ node ];
+    if ( record.m_Stamp == m_Generation && record.m_Cost <= cost )
+        return false;
+
+    record = { cost, parent, m_Generation };
+    m_Open.push_back( { cost + estimate, cost, node } );
+    std::push_heap( m_Open.begin(), m_Open.end(), WorseEntry{} );
+    return true;
+}
+
+bool SearchBuffers::PopBest( uint32_t& node, uint32_t& cost )
+{
+    while ( !m_Open.empty() )
+    {
+        std::pop_heap( m_Open.begin(), m_Open.end(), WorseEntry{} );
+        const OpenEntry entry = m_Open.back();
+        m_Open.pop_back();
+
+        // a cheaper way to this node was queued after this entry
+        if ( entry.m_Cost != m_Nodes[ entry.m_Index ].m_Cost )
+            continue;
+
+        node = entry.m_Index;
+        cost = entry.m_Cost;
+        return true;
+    }
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+// PathSearch
+//-----------------------------------------------------------------------------
+
+PathStatus PathSearch::Start( PathGrid const& grid, Vec2i const& start, Vec2i const& goal, PathOptions const& options )
+{
+    m_Grid = &grid;
+    m_Options = options;
+    m_Result = {};
+    m_GoalCell = goal;
+    m_UseJumpPoints = options.m_Algorithm == PathAlgorithm::JumpPoint && options.m_AllowDiagonal && grid.IsUniform();
+
+    if ( !grid.IsWalkable( start ) || !grid.IsWalkable( goal ) )
+        return m_Result.m_Status = PathStatus::Invalid;
+
+    m_Start = grid.IndexOf( start );
+    m_Goal = grid.IndexOf( goal );
+
+    m_Buffers.Begin( grid.GetCellCount() );
+    m_Result.m_Status = PathStatus::Searching;
+    reach( m_Start, start, m_Start, 0 );
+    return m_Result.m_Status;
+}
+
+PathStatus PathSearch::Step( uint32_t maxExpansions )
+{
+    if ( m_Result.m_Status != PathStatus::Searching )
+        return m_Result.m_Status;
+
+    for ( uint32_t expanded = 0; expanded < maxExpansions; ++expanded )
+    {
+        uint32_t index = 0;
+        uint32_t cost = 0;
+        if ( !m_Buffers.PopBest( index, cost ) )
+            return m_Result.m_Status = PathStatus::NoPath;
+
+        ++m_Result.m_Expanded;
+
+        if ( index == m_Goal )
+        {
+            m_Result.m_Cost = cost;
+            return m_Result.m_Status = PathStatus::Found;
+        }
+
+        if ( m_UseJumpPoints )
+            expandJumpPoints( index, cost );
+        else
+            expandNeighbors( index, cost );
+    }
+
+    return m_Result.m_Status;
+}
+
+void PathSearch::ExtractPath( std::vector< Vec2i >& path ) const
+{
+    path.clear();
+    if ( m_Result.m_Status != PathStatus::Found )
+        return;
+
+    auto& trace = m_Buffers.GetTrace();
+    trace.clear();
+    for ( uint32_t index = m_Goal; ; index = m_Buffers.GetParent( index ) )
+    {
+        trace.push_back( index );
+        if ( index == m_Start )
+            break;
+    }
+
+    // consecutive jump points are joined by straight or diagonal lines, which get filled in
+    path.push_back( m_Grid->CellOf( trace.back() ) );
+    for ( auto it = trace.rbegin() + 1; it != trace.rend(); ++it )
+    {
+        const Vec2i to = m_Grid->CellOf( *it );
+        Vec2i cell = path.back();
+        const int dx = sign( to.x() - cell.x() );
+        const int dy = sign( to.y() - cell.y() );
+        while ( cell != to )
+        {
+            cell.x() += dx;
+            cell.y() += dy;
+            path.push_back( cell );
+        }
+    }
+}
+
+void PathSearch::expandNeighbors( uint32_t index, uint32_t cost )
+{
+    PathGrid const& grid = *m_Grid;
+    const Vec2i cell = grid.CellOf( index );
+    const std::size_t directions = m_Options.m_AllowDiagonal ? 8 : 4;
+
+    for ( std::size_t i = 0; i < directions; ++i )
+    {
+        const int dx = kNeighborOffsets[ i ].x();
+        const int dy = kNeighborOffsets[ i ].y();
+        const int x = cell.x() + dx;
+        const int y = cell.y() + dy;
+
+        const uint8_t cellCost = grid.GetCost( x, y );
+        if ( cellCost == 0 )
+            continue;
+
+        const bool diagonal = dx != 0 && dy != 0;
+        if ( diagonal && ( !grid.IsWalkable( cell.x() + dx, cell.y() ) || !grid.IsWalkable( cell.x(), cell.y() + dy ) ) )
+            continue;
+
+        reach( grid.IndexOf( x, y ), { x, y }, index, cost + ( diagonal ? kDiagonalStepCost : kStraightStepCost ) * cellCost );
+    }
+}
+
+void PathSearch::expandJumpPoints( uint32_t index, uint32_t cost )
+{
+    PathGrid const& grid = *m_Grid;
+    const Vec2i cell = grid.CellOf( index );
+    const int x = cell.x();
+    const int y = cell.y();
+
+    auto jumpFrom = [ & ]( int dx, int dy )
+    {
+        const uint32_t next = jump( x + dx, y + dy, dx, dy );
+        if ( next != kNoCell )
+        {
+            const Vec2i to = grid.CellOf( next );
+            reach( next, to, index, cost + lineCost( to.x() - x, to.y() - y ) );
+        }
+    };
+
+    if ( index == m_Start )
+    {
+        for ( Vec2i const& offset : kNeighborOffsets )
+        {
+            const int dx = offset.x();
+            const int dy = offset.y();
+            if ( dx != 0 && dy != 0 && ( !grid.IsWalkable( x + dx, y ) || !grid.IsWalkable( x, y + dy ) ) )
+                continue;
+            jumpFrom( dx, dy );
+        }
+        return;
+    }
+
+    // only the directions the parent could not have covered more cheaply itself
+    const Vec2i parent = grid.CellOf( m_Buffers.GetParent( index ) );
+    const int dx = sign( x - parent.x() );
+    const int dy = sign( y - parent.y() );
+
+    if ( dx != 0 && dy != 0 )
+    {
+        const bool horizontal = grid.IsWalkable( x + dx, y );
+        const bool vertical = grid.IsWalkable( x, y + dy );
+        if ( vertical )
+            jumpFrom( 0, dy );
+        if ( horizontal )
+            jumpFrom( dx, 0 );
+        if ( horizontal && vertical )
+            jumpFrom( dx, dy );
+    }
+    else
+    {
+        // the side cells are forced neighbours whenever the cell behind them is blocked;
+        // they are always tried, which costs a little pruning but keeps the rule simple
+        const int sx = dy != 0 ? 1 : 0;
+        const int sy = dx != 0 ? 1 : 0;
+        const bool ahead = grid.IsWalkable( x + dx, y + dy );
+        const bool left = grid.IsWalkable( x + sx, y + sy );
+        const bool right = grid.IsWalkable( x - sx, y - sy );
+        if ( ahead )
+        {
+            jumpFrom( dx, dy );
+            if ( left )
+                jumpFrom( dx + sx, dy + sy );
+            if ( right )
+                jumpFrom( dx - sx, dy - sy );
+        }
+        if ( left )
+            jumpFrom( sx, sy );
+        if ( right )
+            jumpFrom( -sx, -sy );
+    }
+}
+
+uint32_t PathSearch::jump( int x, int y, int dx, int dy ) const
+{
+    if ( dx == 0 || dy == 0 )
+        return jumpStraight( x, y, dx, dy );
+
+    PathGrid const& grid = *m_Grid;
+    while ( grid.IsWalkable( x, y ) )
+    {
+        if ( x == m_GoalCell.x() && y == m_GoalCell.y() )
+            return grid.IndexOf( x, y );
+
+        // a diagonal stops wherever one of its straight scans finds something
+        if ( jumpStraight( x + dx, y, dx, 0 ) != kNoCell || jumpStraight( x, y + dy, 0, dy ) != kNoCell )
+            return grid.IndexOf( x, y );
+
+        // no cutting corners
+        if ( !grid.IsWalkable( x + dx, y ) || !grid.IsWalkable( x, y + dy ) )
+            break;
+
+        x += dx;
+        y += dy;
+    }
+    return kNoCell;
+}
+
+uint32_t PathSearch::jumpStraight( int x, int y, int dx, int dy ) const
+{
+    PathGrid const& grid = *m_Grid;
+
+    // the side cells, which become forced neighbours when the cell behind them is blocked
+    const int sx = dy != 0 ? 1 : 0;
+    const int sy = dx != 0 ? 1 : 0;
+
+    for ( ; grid.IsWalkable( x, y ); x += dx, y += dy )
+    {
+        if ( x == m_GoalCell.x() && y == m_GoalCell.y() )
+            return grid.IndexOf( x, y );
+
+        if ( ( grid.IsWalkable( x + sx, y + sy ) && !grid.IsWalkable( x + sx - dx, y + sy - dy ) ) ||
+             ( grid.IsWalkable( x - sx, y - sy ) && !grid.IsWalkable( x - sx - dx, y - sy - dy ) ) )
+            return grid.IndexOf( x, y );
+    }
+    return kNoCell;
+}
+
+//-----------------------------------------------------------------------------
+// FindPath
+//-----------------------------------------------------------------------------
+
+PathResult FindPath( PathGrid const& grid, Vec2i const& start, Vec2i const& goal, std::vector< Vec2i >& path,
+                     PathOptions const& options )
+{
+    PathSearch search;
+    search.Start( grid, start, goal, options );
+    search.Step();
+    search.ExtractPath( path );
+    return search.GetResult();
+}
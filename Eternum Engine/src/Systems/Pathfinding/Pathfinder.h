@@ -0,0 +1,233 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: Pathfinder
+* Description:
+*     Grid pathfinding over a PathGrid: A* with a binary-heap open list, and jump point
+*     search for uniform-cost 8-way grids. Searches keep their state in SearchBuffers that
+*     are sized once per grid and reused, each thread having its own, so a warm query
+*     allocates nothing. A PathSearch can also be run a slice of expansions at a time,
+*     and the other pathfinders run their own searches on SearchBuffers too.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef PATHFINDER_H
+#define PATHFINDER_H
+
+#include <pch.h>
+#include <Systems/Pathfinding/PathGrid.h>
+
+/// @brief  estimates of the remaining cost to the goal
+enum class Heuristic : uint8_t
+{
+    /// @brief  exact on an open 8-way grid; the default
+    Octile,
+
+    /// @brief  diagonal steps priced like straight ones; admissible but looser than Octile
+    Chebyshev,
+
+    /// @brief  exact on an open 4-way grid; with diagonals it overestimates, trading
+    ///         optimal paths for fewer expansions
+    Manhattan,
+
+    /// @brief  straight-line distance, scaled to stay admissible
+    Euclidean,
+
+    /// @brief  no estimate, which turns A* into Dijkstra's algorithm
+    None
+};
+
+enum class PathAlgorithm : uint8_t
+{
+    AStar,
+
+    /// @brief  jump point search; falls back to A* on weighted grids or without diagonals
+    JumpPoint
+};
+
+struct PathOptions
+{
+    PathAlgorithm m_Algorithm = PathAlgorithm::AStar;
+    Heuristic m_Heuristic = Heuristic::Octile;
+
+    /// @brief  whether to step diagonally; never across the corner of a blocked cell
+    bool m_AllowDiagonal = true;
+};
+
+enum class PathStatus : uint8_t
+{
+    /// @brief  a sliced search that still has nodes to expand
+    Searching,
+    Found,
+    NoPath,
+
+    /// @brief  an endpoint is out of bounds or blocked
+    Invalid
+};
+
+struct PathResult
+{
+    PathStatus m_Status = PathStatus::Invalid;
+
+    /// @brief  total cost of the path, in step-cost units
+    uint32_t m_Cost = 0;
+
+    /// @brief  number of nodes taken off the open list
+    uint32_t m_Expanded = 0;
+
+    bool IsFound() const { return m_Status == PathStatus::Found; }
+};
+
+/// @brief  estimates the cost between two cells
+/// @param  heuristic   the estimate to use
+/// @param  from        the first cell
+/// @param  to          the second cell
+/// @return the estimate, in step-cost units
+uint32_t EstimateCost( Heuristic heuristic, Vec2i const& from, Vec2i const& to );
+
+/// @brief  open list and per-node state of a best-first search over nodes numbered from
+///         zero. Per-node records are stamped with a generation, so starting a search
+///         clears nothing and only the first search over more nodes allocates
+class SearchBuffers
+{
+public:
+    /// @brief  gets the calling thread's buffers
+    static SearchBuffers& ThisThread();
+
+    /// @brief  starts a new search, forgetting every node reached before
+    /// @param  nodeCount   the number of nodes the search may reach
+    void Begin( std::size_t nodeCount );
+
+    bool IsReached( uint32_t node ) const { return m_Nodes[ node ].m_Stamp == m_Generation; }
+
+    /// @brief  gets the cheapest cost a reached node was reached at
+    uint32_t GetCost( uint32_t node ) const { return m_Nodes[ node ].m_Cost; }
+
+    /// @brief  gets the node a reached node was reached from
+    uint32_t GetParent( uint32_t node ) const { return m_Nodes[ node ].m_Parent; }
+
+    /// @brief  records reaching a node and queues it, unless it was already reached as
+    ///         cheaply
+    /// @param  node        the node reached
+    /// @param  parent      the node it was reached from
+    /// @param  cost        the cost so far
+    /// @param  estimate    the estimated cost still to go
+    /// @return whether the node was recorded
+    bool Reach( uint32_t node, uint32_t parent, uint32_t cost, uint32_t estimate );
+
+    /// @brief  takes the queued node with the lowest cost plus estimate, skipping entries
+    ///         left behind by a cheaper Reach
+    /// @param  node    receives the node
+    /// @param  cost    receives its cost so far
+    /// @return false once nothing is queued
+    bool PopBest( uint32_t& node, uint32_t& cost );
+
+    /// @brief  gets a scratch list for tracing paths back through their parents
+    std::vector< uint32_t >& GetTrace() { return m_Trace; }
+
+private:
+    struct OpenEntry
+    {
+        /// @brief  cost so far plus the estimate
+        uint32_t m_Priority;
+
+        /// @brief  cost so far when pushed; stale once the node is reached more cheaply
+        uint32_t m_Cost;
+
+        uint32_t m_Index;
+    };
+
+    /// @brief  search state of one node, kept together so a visit touches one cache line
+    struct Node
+    {
+        uint32_t m_Cost;
+        uint32_t m_Parent;
+
+        /// @brief  the generation that last reached the node; older values are garbage
+        uint32_t m_Stamp;
+    };
+
+    std::vector< Node > m_Nodes;
+    uint32_t m_Generation = 0;
+
+    /// @brief  binary heap, best entry first
+    std::vector< OpenEntry > m_Open;
+
+    std::vector< uint32_t > m_Trace;
+};
+
+/// @brief  one A* or jump point search that can be run to completion or in slices
+/// @note   the grid must not change while the search runs, and two searches must not
+///         share buffers while both are in progress
+class PathSearch
+{
+public:
+    explicit PathSearch( SearchBuffers& buffers = SearchBuffers::ThisThread() ) : m_Buffers( buffers ) {}
+
+    /// @brief  starts a search
+    /// @param  grid    the grid to search; must outlive the search
+    /// @param  start   the cell to start from
+    /// @param  goal    the cell to reach
+    /// @param  options the algorithm, heuristic and movement rules
+    /// @return Searching, or the final status when there is nothing to search
+    PathStatus Start( PathGrid const& grid, Vec2i const& start, Vec2i const& goal, PathOptions const& options = {} );
+
+    /// @brief  continues the search
+    /// @param  maxExpansions   the most nodes to expand before returning
+    /// @return Searching while unfinished, otherwise the final status
+    PathStatus Step( uint32_t maxExpansions = ( std::numeric_limits< uint32_t >::max )() );
+
+    PathStatus GetStatus() const { return m_Result.m_Status; }
+    PathResult const& GetResult() const { return m_Result; }
+
+    /// @brief  writes the path found, every cell from the start to the goal inclusive
+    /// @param  path    receives the cells; cleared first, and left empty without a path
+    void ExtractPath( std::vector< Vec2i >& path ) const;
+
+private:
+    /// @brief  pushes every neighbour of a cell onto the open list
+    void expandNeighbors( uint32_t index, uint32_t cost );
+
+    /// @brief  pushes the jump points reachable from a cell onto the open list
+    void expandJumpPoints( uint32_t index, uint32_t cost );
+
+    /// @brief  jumps from a cell in one direction
+    /// @return the index of the jump point, or kNoCell when the direction is a dead end
+    uint32_t jump( int x, int y, int dx, int dy ) const;
+
+    /// @brief  jumps along a row or column
+    uint32_t jumpStraight( int x, int y, int dx, int dy ) const;
+
+    /// @brief  records a cheaper way to reach a cell and queues it
+    /// @param  cell    the cell's coordinates, to estimate from
+    void reach( uint32_t index, Vec2i const& cell, uint32_t parent, uint32_t cost )
+    {
+        m_Buffers.Reach( index, parent, cost, EstimateCost( m_Options.m_Heuristic, cell, m_GoalCell ) );
+    }
+
+    static constexpr uint32_t kNoCell = ( std::numeric_limits< uint32_t >::max )();
+
+    SearchBuffers& m_Buffers;
+    PathGrid const* m_Grid = nullptr;
+    PathOptions m_Options;
+    PathResult m_Result;
+    bool m_UseJumpPoints = false;
+    uint32_t m_Start = 0;
+    uint32_t m_Goal = 0;
+    Vec2i m_GoalCell;
+};
+
+/// @brief  finds a path with the calling thread's buffers
+/// @param  grid    the grid to search
+/// @param  start   the cell to start from
+/// @param  goal    the cell to reach
+/// @param  path    receives every cell from start to goal inclusive; reuse it across
+///                 calls to avoid allocating
+/// @param  options the algorithm, heuristic and movement rules
+/// @return the outcome, cost and work done
+PathResult FindPath( PathGrid const& grid, Vec2i const& start, Vec2i const& goal, std::vector< Vec2i >& path,
+                     PathOptions const& options = {} );
+
+#endif //PATHFINDER_H
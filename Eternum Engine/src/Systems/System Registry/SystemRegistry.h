@@ -4,6 +4,8 @@
 * File: SystemRegistry
 * Description:
 *     Manages the registration and retrieval of all systems in the Eternum Engine.
+*     Engine systems are named in a compile-time SystemList and registered together in
+*     a fixed order; REGISTER_SYSTEM remains for systems defined outside the engine.
 *
 * Author:     Jax Clayton
 * Created:    8/2/2025
@@ -13,6 +15,42 @@
 #ifndef SYSTEMREGISTRY_H
 #define SYSTEMREGISTRY_H
 
+#include <typeindex>
+#include <unordered_map>
+
+/// @brief  how the registry reaches the singleton of a system type
+/// @tparam SystemType  the system type; defaults to SystemType::GetInstance()
+template < typename SystemType >
+struct SystemInstance
+{
+    static System* Get() { return SystemType::GetInstance().get(); }
+};
+
+/// @brief  compile-time list of system types, in update order
+/// @tparam SystemTypes the system types
+template < typename... SystemTypes >
+struct SystemList
+{
+    /// @brief  number of systems in the list
+    static constexpr std::size_t Size = sizeof...(SystemTypes);
+
+    /// @brief  gets the position of a system type in the list
+    /// @tparam SystemType  the system type, which must be in the list
+    template < typename SystemType >
+    static constexpr std::size_t IndexOf()
+    {
+        constexpr bool matches[] = { std::is_same_v< SystemType, SystemTypes >... };
+        for (std::size_t i = 0; i < Size; ++i)
+            if (matches[i])
+                return i;
+        return Size;
+    }
+
+    /// @brief  whether a system type is in the list
+    template < typename SystemType >
+    static constexpr bool Contains = (std::is_same_v< SystemType, SystemTypes > || ...);
+};
+
 class SystemRegistry
 {
     public:
@@ -22,16 +60,38 @@ class SystemRegistry
             return instance;
         }
 
+        /// @brief  registers a system under its dynamic type; registering the same type
+        ///         again is a no-op
+        /// @param  sys the system to register
+        /// @note   does no I/O, so it is safe to call during static initialization
         void Register(System* sys)
         {
-            for (const auto& existingSys : systems) {
-                if (existingSys->GetName() == sys->GetName()) {
-                    return; // System already registered
-                }
-            }
-
-            std::cout << "Registering system: " << sys->GetName() << std::endl;
-            systems.push_back(sys);
+            if (m_ByType.try_emplace(typeid(*sys), sys).second)
+                systems.push_back(sys);
+        }
+
+        /// @brief  registers the singleton of a system type
+        /// @tparam SystemType  the system type
+        template < typename SystemType >
+        void Register()
+        {
+            Register(SystemInstance< SystemType >::Get());
+        }
+
+        /// @brief  registers every system of a SystemList ahead of any registered so far,
+        ///         in list order
+        /// @param  list    the list of systems
+        template < typename... SystemTypes >
+        void RegisterList(SystemList< SystemTypes... > list);
+
+        /// @brief  gets a registered system by type
+        /// @tparam SystemType  the exact type of the system
+        /// @return the system, or nullptr if it was never registered
+        template < typename SystemType >
+        SystemType* Get() const
+        {
+            auto const it = m_ByType.find(typeid(SystemType));
+            return it == m_ByType.end() ? nullptr : static_cast< SystemType* >(it->second);
         }
 
         const std::vector<System*>& GetSystems() const
@@ -42,39 +102,40 @@ class SystemRegistry
     private:
         SystemRegistry() = default;
         std::vector<System*> systems;
+
+        /// @brief  registered systems by dynamic type
+        std::unordered_map< std::type_index, System* > m_ByType;
 };
 
-static SystemRegistry* Registry()
+template < typename... SystemTypes >
+void SystemRegistry::RegisterList(SystemList< SystemTypes... >)
 {
-    return &SystemRegistry::Instance();
-}
+    std::vector< System* > listed;
+    listed.reserve(sizeof...(SystemTypes));
+    for (System* sys : std::initializer_list< System* >{ SystemInstance< SystemTypes >::Get()... })
+        if (m_ByType.try_emplace(typeid(*sys), sys).second)
+            listed.push_back(sys);
 
-/// @brief Registers a system type automatically.
-/// This macro should be used in the system's implementation file to ensure that the system
-// AutoRegisterSystem.h
-
-#define REGISTER_SYSTEM(SystemType)                      \
-namespace {                                                \
-struct SystemType##AutoRegister {                      \
-SystemType##AutoRegister() {                       \
-SystemRegistry::Instance().Register(           \
-SystemType::GetInstance().get());               \
-}                                                   \
-};                                                      \
-static SystemType##AutoRegister s_##SystemType##AutoRegisterInstance; \
+    systems.insert(systems.begin(), listed.begin(), listed.end());
 }
 
-#define REGISTER_COMPONENT_SYSTEM(ComponentType)                          \
-namespace {                                                               \
-    struct ComponentSystemAutoRegister_##ComponentType {                 \
-        ComponentSystemAutoRegister_##ComponentType() {                  \
-            SystemRegistry::Instance().Register(                         \
-                Components<ComponentType>());          \
-        }                                                                \
-    };                                                                   \
-    static ComponentSystemAutoRegister_##ComponentType                   \
-        instance_ComponentSystemAutoRegister_##ComponentType;            \
+inline SystemRegistry* Registry()
+{
+    return &SystemRegistry::Instance();
 }
 
+/// @brief Registers a system type that is not part of the engine's SystemList.
+/// The inline variable is shared by every translation unit that sees the macro, so the
+/// system is registered once, before main, without any I/O.
+#define REGISTER_SYSTEM(SystemType)                                      \
+inline const bool g_##SystemType##IsRegistered =                         \
+    (SystemRegistry::Instance().Register< SystemType >(), true);
+
+/// @brief Registers the ComponentSystem of a Component type that is not part of the
+/// engine's SystemList.
+#define REGISTER_COMPONENT_SYSTEM(ComponentType)                         \
+inline const bool g_##ComponentType##SystemIsRegistered =                \
+    (SystemRegistry::Instance().Register< ComponentSystem< ComponentType > >(), true);
+
 
 #endif //SYSTEMREGISTRY_H
@@ -0,0 +1,230 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: TransformSystem.cpp
+* Description:
+*     Gathers dirty Transform subtrees from the flattened hierarchy and composes their
+*     world matrices breadth-first in SIMD batches.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+
+#include <pch.h>
+#include "TransformSystem.h"
+#include <Core/ECS/Component/Transform/Transform.h>
+#include <Core/ECS/Hierarchy/EntityHierarchy.h>
+#include <Core/Jobs/JobSystem.h>
+
+namespace {
+
+/// @brief  levels at least this wide are split across the JobSystem
+constexpr std::size_t kParallelLevelSize = 8192;
+
+/// @brief  nodes per parallel chunk
+constexpr std::size_t kParallelGrain = 2048;
+
+constexpr uint32_t kNoSlot = 0xFFFFFFFFu;
+
+/// @brief  finds the world matrix a subtree root inherits from its nearest Transform ancestor
+Affine2f inheritedWorld( Entity const* root )
+{
+    for ( Entity const* ancestor = root->GetParent(); ancestor; ancestor = ancestor->GetParent() )
+        if ( auto const* transform = static_cast< Transform const* >( ancestor->FindComponent( typeid( Transform ) ) ) )
+            return transform->GetWorldMatrix();
+    return Affine2f::Identity();
+}
+
+} // namespace
+
+// --------------------------------------------------------
+// Constructor
+// --------------------------------------------------------
+TransformSystem::TransformSystem()
+    : System("Transform System")
+{
+}
+
+// --------------------------------------------------------
+// Lifecycle Methods
+// --------------------------------------------------------
+void TransformSystem::Update([[maybe_unused]] double deltaTime)
+{
+    Propagate();
+}
+
+// --------------------------------------------------------
+// Public Methods
+// --------------------------------------------------------
+void TransformSystem::MarkDirty(EntityHandle entity)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Dirty.push_back(entity);
+}
+
+std::size_t TransformSystem::GetPendingCount()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Dirty.size();
+}
+
+void TransformSystem::Propagate()
+{
+    std::vector<EntityHandle> dirty;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        dirty.swap(m_Dirty);
+    }
+    if (dirty.empty())
+        return;
+
+    const uint32_t levels = gather(dirty);
+
+    // locals never change during the pass, so fill them for every level up front
+    const std::size_t count = m_LevelOrder.size();
+    m_Parents.Resize(count);
+    m_Locals.Resize(count);
+    m_Results.Resize(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        Transform const* node = m_Nodes[m_LevelOrder[i]];
+        m_Locals.Set(i, node ? node->GetLocalMatrix() : Affine2f::Identity());
+    }
+
+    // each level only reads the worlds of the level above, so a level's nodes are independent
+    for (uint32_t level = 0; level < levels; ++level)
+    {
+        const std::size_t begin = m_LevelStart[level];
+        const std::size_t end = m_LevelStart[level + 1];
+
+        if (end - begin >= kParallelLevelSize)
+        {
+            Jobs()->ParallelFor(end - begin, kParallelGrain, [this, begin](std::size_t first, std::size_t last) {
+                composeLevel(begin + first, begin + last);
+            });
+        }
+        else
+        {
+            composeLevel(begin, end);
+        }
+    }
+}
+
+// --------------------------------------------------------
+// Private Methods
+// --------------------------------------------------------
+uint32_t TransformSystem::gather(std::vector<EntityHandle> const& dirty)
+{
+    EntityHierarchy const& hierarchy = *Hierarchy();
+
+    // order the live roots by hierarchy position so nested roots can be skipped
+    std::vector<std::pair<uint32_t, Entity*>> roots;
+    roots.reserve(dirty.size());
+    for (EntityHandle handle : dirty)
+        if (Entity* entity = Entities()->Resolve(handle))
+            roots.emplace_back(hierarchy.GetSubtreeRange(entity).first, entity);
+    std::sort(roots.begin(), roots.end(), [](auto const& a, auto const& b) { return a.first < b.first; });
+
+    m_Nodes.clear();
+    m_ParentSlot.clear();
+    std::vector<uint32_t> levelOfSlot;
+    std::vector<uint32_t> slotAtDepth;
+
+    uint32_t coveredEnd = 0;
+    for (auto const& [position, root] : roots)
+    {
+        // already inside a subtree gathered earlier (or queued twice)
+        if (position < coveredEnd)
+            continue;
+
+        const auto [begin, end] = hierarchy.GetSubtreeRange(root);
+        coveredEnd = end;
+
+        // pseudo slot holding the world matrix the subtree inherits
+        const uint32_t base = static_cast<uint32_t>(m_Nodes.size());
+        m_Nodes.push_back(nullptr);
+        m_ParentSlot.push_back(kNoSlot);
+        levelOfSlot.push_back(0);
+        m_World.Resize(m_Nodes.size());
+        m_World.Set(base, inheritedWorld(root));
+
+        // depth-first order means a node's parent is the last slot seen one level up
+        const uint32_t rootDepth = hierarchy.GetDepthAt(begin);
+        slotAtDepth.assign(1, base);
+        for (uint32_t at = begin; at < end; ++at)
+        {
+            Entity* entity = hierarchy.GetEntityAt(at);
+            if (entity == nullptr)
+                continue;
+
+            const uint32_t level = hierarchy.GetDepthAt(at) - rootDepth + 1;
+            const uint32_t slot = static_cast<uint32_t>(m_Nodes.size());
+            if (slotAtDepth.size() <= level)
+                slotAtDepth.resize(level + 1);
+            slotAtDepth[level] = slot;
+
+            m_Nodes.push_back(static_cast<Transform*>(entity->FindComponent(typeid(Transform))));
+            m_ParentSlot.push_back(slotAtDepth[level - 1]);
+            levelOfSlot.push_back(level);
+        }
+    }
+    m_World.Resize(m_Nodes.size());
+
+    // bucket the real slots by level (counting sort); level 0 only holds pseudo slots
+    uint32_t levels = 0;
+    for (uint32_t level : levelOfSlot)
+        levels = (std::max)(levels, level);
+
+    m_LevelStart.assign(levels + 1, 0);
+    for (uint32_t level : levelOfSlot)
+        if (level > 0)
+            ++m_LevelStart[level];
+
+    uint32_t running = 0;
+    for (uint32_t level = 1; level <= levels; ++level)
+    {
+        const uint32_t size = m_LevelStart[level];
+        m_LevelStart[level - 1] = running;
+        running += size;
+    }
+    m_LevelStart[levels] = running;
+
+    m_LevelOrder.resize(running);
+    std::vector<uint32_t> cursor(m_LevelStart.begin(), m_LevelStart.end() - 1);
+    for (uint32_t slot = 0; slot < levelOfSlot.size(); ++slot)
+        if (levelOfSlot[slot] > 0)
+            m_LevelOrder[cursor[levelOfSlot[slot] - 1]++] = slot;
+
+    return levels;
+}
+
+void TransformSystem::composeLevel(std::size_t begin, std::size_t end)
+{
+    for (std::size_t i = begin; i < end; ++i)
+        m_Parents.Set(i, m_World.Get(m_ParentSlot[m_LevelOrder[i]]));
+
+    ComposeAffine2Batch(m_Parents, m_Locals, m_Results, begin, end);
+
+    // a new world matrix is a write, so systems watching Transforms see the whole subtree
+    const ChangeVersion now = Changes()->GetVersion();
+    std::vector<EntityHandle> written;
+
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        const uint32_t slot = m_LevelOrder[i];
+        const Affine2f world = m_Results.Get(i);
+        m_World.Set(slot, world);
+
+        if (Transform* node = m_Nodes[slot])
+        {
+            node->m_World = world;
+            node->m_IsDirty = false;
+            node->m_IsQueued = false;
+            if (node->StampVersion(now))
+                written.push_back(node->GetEntity()->GetHandle());
+        }
+    }
+
+    Changes()->RecordBatch(ComponentTypeRegistry::Of<Transform>(), written.data(), written.size(), now);
+}
@@ -0,0 +1,98 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: TransformSystem
+* Description:
+*     Propagates local Transforms into local-to-world matrices. Only subtrees whose root
+*     was marked dirty are visited; their nodes are gathered from the flattened
+*     EntityHierarchy into structure-of-arrays scratch and composed one depth level at a
+*     time with the SIMD Affine2 kernel.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef TRANSFORMSYSTEM_H
+#define TRANSFORMSYSTEM_H
+
+#include <Systems/system.h>
+#include <Core/ECS/Entity/EntityRegistry.h>
+#include <Core/Math/Affine2.h>
+
+class Transform;
+
+class TransformSystem final : public System
+{
+public:
+    TransformSystem();
+
+    void Update(double deltaTime) override;
+    void FixedUpdate() override {};
+    void Render() override {};
+
+    /// @brief  queues an Entity whose Transform changed; its whole subtree is recomputed
+    ///         on the next propagation
+    /// @param  entity  the Entity whose Transform changed
+    void MarkDirty( EntityHandle entity );
+
+    /// @brief  recomputes the world matrices of every queued subtree
+    void Propagate();
+
+    /// @brief  gets the number of Entities queued for the next propagation
+    std::size_t GetPendingCount();
+
+    // -------------------------------------------------------------------
+    // Singleton pattern to ensure only one instance of TransformSystem exists
+    // -------------------------------------------------------------------
+    static std::shared_ptr<TransformSystem> GetInstance()
+    {
+        static std::shared_ptr<TransformSystem> instance(new TransformSystem());
+        return instance;
+    }
+
+private:
+
+    /// @brief  collects the queued subtrees into the scratch buffers
+    /// @return the number of hierarchy levels gathered
+    uint32_t gather( std::vector< EntityHandle > const& dirty );
+
+    /// @brief  composes one level of the gathered nodes
+    /// @param  begin   first level-order index of the level
+    /// @param  end     one past the last level-order index of the level
+    void composeLevel( std::size_t begin, std::size_t end );
+
+    std::vector< EntityHandle > m_Dirty;
+    std::mutex m_Mutex;
+
+    //-----------------------------------------------------------------------------
+    // Propagation scratch, reused between frames
+    //-----------------------------------------------------------------------------
+
+    /// @brief  Transform of each gathered slot (nullptr for Entities without one, and for
+    ///         the pseudo slots holding each subtree's inherited world matrix)
+    std::vector< Transform* > m_Nodes;
+
+    /// @brief  slot of each gathered slot's parent
+    std::vector< uint32_t > m_ParentSlot;
+
+    /// @brief  world matrix of each gathered slot
+    Affine2SoA m_World;
+
+    /// @brief  slots grouped by level, parents' levels first
+    std::vector< uint32_t > m_LevelOrder;
+
+    /// @brief  start of each level in m_LevelOrder, with a trailing end marker
+    std::vector< uint32_t > m_LevelStart;
+
+    /// @brief  per level-order index: parent world, local matrix, and result
+    Affine2SoA m_Parents, m_Locals, m_Results;
+};
+
+
+/// @brief  gets the TransformSystem
+inline TransformSystem* Transforms()
+{
+    return TransformSystem::GetInstance().get();
+}
+
+#endif //TRANSFORMSYSTEM_H
@@ -29,14 +29,14 @@ public:
     // explicit keyword ensures that this constructor cannot be used for implicit conversions
     // This constructor initializes the system with a name for identification
     explicit System(const std::string& name)
-        : m_Name(name)
+        : m_Name(StringId::Intern(name))
     {
     }
 
     // Called once when the system is created
     virtual void Init()
     {
-        std::cout << "Initializing system: " << m_Name << std::endl;
+        ETERNUM_LOG_INFO("Initializing system: ", m_Name);
     }
 
     // Called every frame before fixed updates
@@ -51,17 +51,20 @@ public:
     // Called when the system is shutting down
     virtual void Shutdown()
     {
-        std::cout << "Shutdown system: " << m_Name << std::endl;
+        ETERNUM_LOG_INFO("Shutdown system: ", m_Name);
     }
 
     // Returns the name of the system for identification
-    const std::string& GetName() const { return m_Name; }
+    const std::string& GetName() const { return m_Name.GetString(); }
+
+    // Returns the interned name, for comparisons and lookups
+    StringId GetNameId() const { return m_Name; }
 
     // -- ----------------------------------------------------------------
     //                   === Private Members ===
     // ----------------------------------------------------------------
 private:
-    std::string m_Name; // Name of the system for identification
+    StringId m_Name; // Name of the system for identification
 };
 
 
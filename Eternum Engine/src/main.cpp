@@ -1,9 +1,57 @@
 #include <pch.h>
 #include "Core/Runtime/Runtime.h"
+#include "Core/Random/Random.h"
 
-int main()
+namespace {
+
+constexpr char kUsage[] = "Usage: Eternum [--seed N] [--record FILE] [--replay FILE]";
+
+// Reports a bad command line; main returns this as the exit code
+int usageError(std::string const& message)
+{
+    std::cerr << message << "\n" << kUsage << std::endl;
+    return 2;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
 {
-    srand(static_cast<unsigned>(time(nullptr)));
+    std::string replayPath;
+    for (int i = 1; i < argc; i += 2)
+    {
+        const std::string option = argv[i];
+        if (i + 1 == argc)
+            return usageError("Missing value for " + option);
+
+        if (option == "--seed")
+        {
+            const std::string value = argv[i + 1];
+            std::size_t used = 0;
+            uint64_t seed = 0;
+            try
+            {
+                seed = std::stoull(value, &used);
+            }
+            catch (std::logic_error const&)
+            {
+                used = 0;
+            }
+            if (used == 0 || used != value.size() || value.front() == '-')
+                return usageError("--seed needs an unsigned number, not \"" + value + "\"");
+            Rng()->SetSeed(seed);
+        }
+        else if (option == "--record")
+            RuntimeSystem()->SetRecording(argv[i + 1]);
+        else if (option == "--replay")
+            replayPath = argv[i + 1];
+        else
+            ETERNUM_LOG_WARNING("Ignoring unknown option ", option);
+    }
+
+    // Replays run headless and report through the exit code
+    if (!replayPath.empty())
+        return RuntimeSystem()->Replay(replayPath) ? 0 : 1;
 
     RuntimeSystem()->Run();
 
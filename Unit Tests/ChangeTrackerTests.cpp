@@ -0,0 +1,129 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: ChangeTrackerTests
+* Description:
+*       Tests for Component change versions and change-filtered Query iteration.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#include <gtest/gtest.h>
+#include <Core/ECS/Query/Query.h>
+#include <Core/ECS/Component/ChangeTracker.h>
+
+namespace {
+
+class Sensor final : public Component {
+public:
+    Sensor() : Component(typeid(Sensor)) {}
+    Component* Clone() const override { return new Sensor(*this); }
+    int reading = 0;
+};
+
+class Target final : public Component {
+public:
+    Target() : Component(typeid(Target)) {}
+    Component* Clone() const override { return new Target(*this); }
+};
+
+/// @brief  collects the Entities visited by ForEachChanged on a read-only query
+std::vector<Entity*> ChangedSince(ChangeVersion since)
+{
+    std::vector<Entity*> seen;
+    Query<const Sensor>::Get().ForEachChanged(since, [&seen](Entity& entity, Sensor const&) { seen.push_back(&entity); });
+    return seen;
+}
+
+bool Contains(std::vector<Entity*> const& entities, Entity const* entity)
+{
+    return std::find(entities.begin(), entities.end(), entity) != entities.end();
+}
+
+} // namespace
+
+TEST(ChangeTrackerTests, AddedComponentsCountAsChanged) {
+    const ChangeVersion since = Changes()->Advance();
+
+    Entity entity;
+    entity.AddComponent(new Sensor());
+
+    const auto seen = ChangedSince(since);
+    EXPECT_TRUE(Contains(seen, &entity));
+    EXPECT_TRUE(entity.FindComponent(typeid(Sensor))->HasChangedSince(since));
+}
+
+TEST(ChangeTrackerTests, OnlyWrittenComponentsAreVisited) {
+    Entity quiet;
+    Entity busy;
+    quiet.AddComponent(new Sensor());
+    auto* sensor = new Sensor();
+    busy.AddComponent(sensor);
+
+    const ChangeVersion since = Changes()->Advance();
+    EXPECT_TRUE(ChangedSince(since).empty());
+
+    sensor->reading = 4;
+    sensor->MarkChanged();
+
+    const auto seen = ChangedSince(since);
+    ASSERT_EQ(seen.size(), 1u);
+    EXPECT_EQ(seen[0], &busy);
+}
+
+TEST(ChangeTrackerTests, ConstColumnsDoNotMarkChanges) {
+    Entity entity;
+    entity.AddComponent(new Sensor());
+    entity.AddComponent(new Target());
+
+    const ChangeVersion since = Changes()->Advance();
+    Query<const Sensor, const Target>::Get().ForEach([](Entity&, Sensor const&, Target const&) {});
+    EXPECT_TRUE(ChangedSince(since).empty());
+
+    // mutable iteration marks only the mutable column
+    Query<Sensor, const Target>::Get().ForEach([](Entity&, Sensor& s, Target const&) { ++s.reading; });
+    EXPECT_TRUE(Contains(ChangedSince(since), &entity));
+    EXPECT_FALSE(entity.FindComponent(typeid(Target))->HasChangedSince(since));
+}
+
+TEST(ChangeTrackerTests, MutableGetComponentMarksChange) {
+    Entity entity;
+    entity.AddComponent(new Sensor());
+
+    const ChangeVersion since = Changes()->Advance();
+    static_cast<Entity const&>(entity).GetComponent<Component>();
+    EXPECT_FALSE(entity.FindComponent(typeid(Sensor))->HasChangedSince(since));
+
+    entity.GetComponent<Component>();
+    EXPECT_TRUE(entity.FindComponent(typeid(Sensor))->HasChangedSince(since));
+}
+
+TEST(ChangeTrackerTests, RemovedComponentsAndDestroyedEntitiesAreSkipped) {
+    const ChangeVersion since = Changes()->Advance();
+
+    auto* doomed = new Entity();
+    doomed->AddComponent(new Sensor());
+    Entity stripped;
+    stripped.AddComponent(new Sensor());
+
+    delete doomed;
+    stripped.RemoveComponent<Sensor>();
+
+    EXPECT_TRUE(ChangedSince(since).empty());
+}
+
+TEST(ChangeTrackerTests, OldVersionsFallBackToCheckingEveryRow) {
+    Entity entity;
+    auto* sensor = new Sensor();
+    entity.AddComponent(sensor);
+
+    const ChangeVersion since = Changes()->Advance();
+    sensor->MarkChanged();
+    for (ChangeVersion i = 0; i <= ChangeTracker::kRetainedVersions; ++i)
+        Changes()->Advance();
+
+    const auto seen = ChangedSince(since);
+    EXPECT_TRUE(Contains(seen, &entity));
+    EXPECT_EQ(std::count(seen.begin(), seen.end(), &entity), 1);
+}
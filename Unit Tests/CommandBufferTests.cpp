@@ -0,0 +1,247 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: CommandBufferTests
+* Description:
+*       Tests for deferred structural changes recorded in CommandBuffers and their
+*       playback and reclamation by the CommandQueue.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#include <gtest/gtest.h>
+#include <Core/ECS/Commands/CommandBuffer.h>
+#include <Core/ECS/Entity/Entity.h>
+#include <Core/ECS/Component/Component.h>
+#include <Core/ECS/Query/Query.h>
+#include <latch>
+
+namespace {
+
+class Health final : public Component {
+public:
+    Health() : Component(typeid(Health)) {}
+    Component* Clone() const override { return new Health(*this); }
+    void OnInit() override { ++initCount; }
+    int initCount = 0;
+};
+
+class Armor final : public Component {
+public:
+    Armor() : Component(typeid(Armor)) {}
+    Component* Clone() const override { return new Armor(*this); }
+};
+
+class Tracked final : public Component {
+public:
+    Tracked() : Component(typeid(Tracked)) {}
+    Component* Clone() const override { return new Tracked(*this); }
+    void OnExit() override { ++exitCount; }
+    static inline int exitCount = 0;
+};
+
+} // namespace
+
+class CommandBufferTest : public ::testing::Test {
+protected:
+    void SetUp() override { Commands()->Playback(); }
+    void TearDown() override { Commands()->Playback(); }
+};
+
+TEST_F(CommandBufferTest, CreatedEntityResolvesOnlyAfterPlayback) {
+    CommandBuffer& buffer = Commands()->ThisThread();
+    const EntityHandle handle = buffer.CreateEntity("Spawned");
+    EXPECT_FALSE(handle.IsNull());
+    EXPECT_EQ(Entities()->Resolve(handle), nullptr);
+    EXPECT_EQ(Commands()->GetPendingCount(), 1u);
+
+    Commands()->Playback();
+
+    Entity* entity = Entities()->Resolve(handle);
+    ASSERT_NE(entity, nullptr);
+    EXPECT_EQ(entity->GetName(), "Spawned");
+    EXPECT_EQ(entity->GetHandle(), handle);
+    EXPECT_EQ(Commands()->GetPendingCount(), 0u);
+
+    buffer.DestroyEntity(handle);
+    Commands()->Playback();
+    EXPECT_EQ(Entities()->Resolve(handle), nullptr);
+}
+
+TEST_F(CommandBufferTest, ComponentsRecordedForNewEntityAreInitializedOnce) {
+    CommandBuffer& buffer = Commands()->ThisThread();
+    const EntityHandle handle = buffer.CreateEntity("WithHealth");
+    auto* health = new Health();
+    buffer.AddComponent(handle, health);
+    Commands()->Playback();
+
+    Entity* entity = Entities()->Resolve(handle);
+    ASSERT_NE(entity, nullptr);
+    EXPECT_EQ(entity->FindComponent(typeid(Health)), health);
+    EXPECT_EQ(health->initCount, 1);
+
+    buffer.DestroyEntity(handle);
+}
+
+TEST_F(CommandBufferTest, AddAndRemoveAreDeferredUntilPlayback) {
+    Entity entity;
+    CommandBuffer& buffer = Commands()->ThisThread();
+
+    auto& query = Query<Armor>::Get();
+    const std::size_t before = query.Size();
+
+    buffer.AddComponent(entity.GetHandle(), new Armor());
+    EXPECT_EQ(entity.FindComponent(typeid(Armor)), nullptr);
+    Commands()->Playback();
+    EXPECT_NE(entity.FindComponent(typeid(Armor)), nullptr);
+    EXPECT_EQ(query.Size(), before + 1);
+
+    buffer.RemoveComponent<Armor>(entity.GetHandle());
+    EXPECT_NE(entity.FindComponent(typeid(Armor)), nullptr);
+    Commands()->Playback();
+    EXPECT_EQ(entity.FindComponent(typeid(Armor)), nullptr);
+    EXPECT_EQ(query.Size(), before);
+}
+
+TEST_F(CommandBufferTest, ChangesToTheSameEntityKeepRecordingOrder) {
+    Entity entity;
+    CommandBuffer& buffer = Commands()->ThisThread();
+
+    buffer.AddComponent(entity.GetHandle(), new Armor());
+    buffer.RemoveComponent<Armor>(entity.GetHandle());
+    buffer.AddComponent(entity.GetHandle(), new Armor());
+    Commands()->Playback();
+
+    EXPECT_NE(entity.FindComponent(typeid(Armor)), nullptr);
+}
+
+TEST_F(CommandBufferTest, AddToStaleHandleIsDropped) {
+    auto* entity = new Entity();
+    const EntityHandle stale = entity->GetHandle();
+    delete entity;
+
+    Commands()->ThisThread().AddComponent(stale, new Armor());
+    std::ostringstream log;
+    Log()->SetSink(&log);
+    Commands()->Playback();
+    Log()->Flush();
+    Log()->SetSink(nullptr);
+    EXPECT_NE(log.str().find("WARNING"), std::string::npos);
+}
+
+TEST_F(CommandBufferTest, DestroyedWorldEntityIsReclaimedAtSyncPoint) {
+    CommandBuffer& buffer = Commands()->ThisThread();
+    const EntityHandle handle = buffer.CreateEntity("Doomed");
+    Commands()->Playback();
+
+    Entity* entity = Entities()->Resolve(handle);
+    ASSERT_NE(entity, nullptr);
+
+    // Destroy() only flags the Entity; memory is reclaimed at the next playback
+    entity->Destroy();
+    EXPECT_TRUE(entity->IsDestroyed());
+    EXPECT_TRUE(Entities()->IsAlive(handle));
+
+    Commands()->Playback();
+    EXPECT_FALSE(Entities()->IsAlive(handle));
+}
+
+TEST_F(CommandBufferTest, DiscardedCreatesReleaseTheirReservedHandles) {
+    const uint32_t liveBefore = Entities()->GetLiveCount();
+
+    {
+        CommandBuffer buffer;
+        const EntityHandle discarded = buffer.CreateEntity("Unplayed");
+        buffer.AddComponent(discarded, new Health());
+        EXPECT_EQ(Entities()->GetLiveCount(), liveBefore + 1);
+    }
+    EXPECT_EQ(Entities()->GetLiveCount(), liveBefore);
+
+    CommandBuffer& buffer = Commands()->ThisThread();
+    const EntityHandle cleared = buffer.CreateEntity("Cleared");
+    buffer.Clear();
+    EXPECT_TRUE(buffer.Empty());
+    EXPECT_EQ(Entities()->GetLiveCount(), liveBefore);
+
+    Commands()->Playback();
+    EXPECT_EQ(Entities()->Resolve(cleared), nullptr);
+}
+
+TEST_F(CommandBufferTest, ReclaimExitsEveryComponentOfTheSubtree) {
+    CommandBuffer& buffer = Commands()->ThisThread();
+    const EntityHandle root = buffer.CreateEntity("Root");
+    const EntityHandle child = buffer.CreateEntity("Child", root);
+    const EntityHandle grandchild = buffer.CreateEntity("Grandchild", child);
+    buffer.AddComponent(root, new Tracked());
+    buffer.AddComponent(child, new Tracked());
+    buffer.AddComponent(grandchild, new Tracked());
+    Commands()->Playback();
+    ASSERT_NE(Entities()->Resolve(grandchild), nullptr);
+
+    Tracked::exitCount = 0;
+    buffer.DestroyEntity(root);
+    Commands()->Playback();
+    EXPECT_EQ(Tracked::exitCount, 3);
+    EXPECT_FALSE(Entities()->IsAlive(child));
+    EXPECT_FALSE(Entities()->IsAlive(grandchild));
+}
+
+TEST_F(CommandBufferTest, BuffersOfFinishedThreadsAreReused) {
+    std::vector<EntityHandle> handles(20);
+    std::thread([&] { handles[0] = Commands()->ThisThread().CreateEntity("ShortLived"); }).join();
+    const std::size_t buffers = Commands()->GetBufferCount();
+
+    for (std::size_t t = 1; t < handles.size(); ++t)
+        std::thread([&, t] { handles[t] = Commands()->ThisThread().CreateEntity("ShortLived"); }).join();
+    EXPECT_EQ(Commands()->GetBufferCount(), buffers);
+
+    // commands left in a retired buffer are still played back
+    Commands()->Playback();
+    for (EntityHandle handle : handles)
+    {
+        EXPECT_TRUE(Entities()->IsAlive(handle));
+        Commands()->ThisThread().DestroyEntity(handle);
+    }
+}
+
+TEST_F(CommandBufferTest, EachThreadRecordsIntoItsOwnBuffer) {
+    constexpr int kThreads = 4;
+    constexpr int kPerThread = 50;
+
+    std::vector<CommandBuffer*> buffers(kThreads);
+    std::vector<std::vector<EntityHandle>> handles(kThreads);
+    std::vector<std::thread> threads;
+
+    // keep every thread alive until all have recorded, so none takes another's buffer
+    std::latch recorded(kThreads);
+    for (int t = 0; t < kThreads; ++t)
+    {
+        threads.emplace_back([&, t] {
+            buffers[t] = &Commands()->ThisThread();
+            for (int i = 0; i < kPerThread; ++i)
+            {
+                const EntityHandle handle = buffers[t]->CreateEntity("Worker");
+                buffers[t]->AddComponent(handle, new Health());
+                handles[t].push_back(handle);
+            }
+            recorded.arrive_and_wait();
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    EXPECT_NE(buffers[0], buffers[1]);
+    Commands()->Playback();
+
+    for (auto const& list : handles)
+    {
+        for (EntityHandle handle : list)
+        {
+            Entity* entity = Entities()->Resolve(handle);
+            ASSERT_NE(entity, nullptr);
+            EXPECT_NE(entity->FindComponent(typeid(Health)), nullptr);
+            Commands()->ThisThread().DestroyEntity(handle);
+        }
+    }
+}
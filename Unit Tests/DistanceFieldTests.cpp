@@ -0,0 +1,165 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: DistanceFieldTests
+* Description:
+*       Tests for Dijkstra maps and clearance transforms against brute-force distances,
+*       and for walking a Dijkstra map downhill.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#include <Systems/Pathfinding/DistanceField.h>
+#include "PathTestUtils.h"
+
+namespace {
+
+std::vector<Vec2i> OpenCells(PathGrid const& grid, std::size_t count, uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    std::vector<Vec2i> cells;
+    while (cells.size() < count)
+        cells.push_back(RandomOpenCell(grid, rng));
+    return cells;
+}
+
+/// @brief  the cheapest path cost from a cell to any of the sources, by A*
+uint32_t NearestByAStar(PathGrid const& grid, Vec2i const& from, std::vector<Vec2i> const& sources, PathOptions const& options)
+{
+    uint32_t best = DistanceField::kUnreachable;
+    std::vector<Vec2i> path;
+    for (Vec2i const& source : sources)
+    {
+        const PathResult result = FindPath(grid, from, source, path, options);
+        if (result.IsFound())
+            best = (std::min)(best, result.m_Cost);
+    }
+    return best;
+}
+
+} // namespace
+
+TEST(DistanceFieldTests, BreadthFirstCountsStraightSteps)
+{
+    const PathGrid grid(MakeRandomGrid(40, 30, 25, 0, 1));
+    const std::vector<Vec2i> sources = OpenCells(grid, 3, 2);
+
+    DistanceField field;
+    field.BuildBreadthFirst(grid, sources);
+    EXPECT_EQ(field.Get(sources[0]), 0u);
+    EXPECT_EQ(field.Get(-1, 0), DistanceField::kUnreachable);
+
+    PathOptions fourWay;
+    fourWay.m_AllowDiagonal = false;
+    for (Vec2i const& cell : OpenCells(grid, 60, 3))
+        EXPECT_EQ(field.Get(cell), NearestByAStar(grid, cell, sources, fourWay));
+}
+
+TEST(DistanceFieldTests, DijkstraMatchesAStarOnWeightedGrids)
+{
+    const PathGrid grid(MakeRandomGrid(48, 36, 20, 20, 4), WaterTerrain(4));
+    const std::vector<Vec2i> sources = OpenCells(grid, 4, 5);
+
+    for (bool diagonal : { true, false })
+    {
+        DistanceField field;
+        field.BuildDijkstra(grid, sources, diagonal);
+
+        PathOptions options;
+        options.m_AllowDiagonal = diagonal;
+        for (Vec2i const& cell : OpenCells(grid, 60, 6))
+            EXPECT_EQ(field.Get(cell), NearestByAStar(grid, cell, sources, options)) << "diagonal " << diagonal;
+    }
+}
+
+TEST(DistanceFieldTests, DescendingFollowsACheapestPath)
+{
+    const PathGrid grid(MakeRandomGrid(48, 36, 20, 20, 7), WaterTerrain(4));
+    const std::vector<Vec2i> sources = OpenCells(grid, 2, 8);
+    DistanceField field;
+    field.BuildDijkstra(grid, sources);
+
+    for (Vec2i cell : OpenCells(grid, 30, 9))
+    {
+        const uint32_t expected = field.Get(cell);
+        Vec2i next;
+        uint32_t walked = 0;
+        int steps = 0;
+        while (field.Descend(grid, cell, next) && steps++ < 10000)
+        {
+            const bool diagonal = next.x() != cell.x() && next.y() != cell.y();
+            walked += (diagonal ? kDiagonalStepCost : kStraightStepCost) * grid.GetCost(next);
+            cell = next;
+        }
+
+        if (expected == DistanceField::kUnreachable)
+            continue;
+        EXPECT_EQ(field.Get(cell), 0u);
+        EXPECT_EQ(walked, expected);
+    }
+}
+
+TEST(DistanceFieldTests, UnreachableCellsAndBlockedSources)
+{
+    GridSystem::Grid map(10, 3);
+    for (int y = 0; y < 3; ++y)
+        map.SetCell(5, y, '#');
+    const PathGrid grid(map);
+
+    DistanceField field;
+    const std::vector<Vec2i> sources{ { 1, 1 }, { 5, 1 }, { 20, 1 } };
+    field.BuildDijkstra(grid, sources);
+    EXPECT_EQ(field.Get(1, 1), 0u);
+    EXPECT_EQ(field.Get(3, 1), 2 * kStraightStepCost);
+    EXPECT_EQ(field.Get(5, 1), DistanceField::kUnreachable);
+    EXPECT_EQ(field.Get(8, 1), DistanceField::kUnreachable);
+
+    Vec2i next;
+    EXPECT_FALSE(field.Descend(grid, { 8, 1 }, next));
+    EXPECT_FALSE(field.Descend(grid, { 1, 1 }, next));
+}
+
+TEST(DistanceFieldTests, ClearanceMatchesBruteForce)
+{
+    const PathGrid grid(MakeRandomGrid(77, 53, 2, 0, 10));
+    std::vector<Vec2i> walls;
+    for (int y = 0; y < grid.GetHeight(); ++y)
+        for (int x = 0; x < grid.GetWidth(); ++x)
+            if (!grid.IsWalkable(x, y))
+                walls.push_back({ x, y });
+    ASSERT_FALSE(walls.empty());
+
+    DistanceField chamfer, euclidean;
+    chamfer.BuildClearance(grid, ClearanceMetric::Chamfer);
+    euclidean.BuildClearance(grid, ClearanceMetric::Euclidean);
+
+    for (int y = 0; y < grid.GetHeight(); ++y)
+    {
+        for (int x = 0; x < grid.GetWidth(); ++x)
+        {
+            uint32_t octile = DistanceField::kUnreachable;
+            int64_t squared = std::numeric_limits<int64_t>::max();
+            for (Vec2i const& wall : walls)
+            {
+                const int dx = wall.x() - x;
+                const int dy = wall.y() - y;
+                octile = (std::min)(octile, EstimateCost(Heuristic::Octile, { x, y }, wall));
+                squared = (std::min)(squared, int64_t(dx) * dx + int64_t(dy) * dy);
+            }
+            ASSERT_EQ(chamfer.Get(x, y), octile) << x << "," << y;
+            ASSERT_EQ(euclidean.Get(x, y), static_cast<uint32_t>(std::floor(std::sqrt(double(squared) * 100.0))))
+                << x << "," << y;
+        }
+    }
+}
+
+TEST(DistanceFieldTests, ClearanceWithoutWallsIsUnreachable)
+{
+    const PathGrid grid(GridSystem::Grid(9, 5));
+    DistanceField field;
+    field.BuildClearance(grid, ClearanceMetric::Chamfer);
+    EXPECT_EQ(field.Get(4, 2), DistanceField::kUnreachable);
+    field.BuildClearance(grid, ClearanceMetric::Euclidean);
+    EXPECT_EQ(field.Get(4, 2), DistanceField::kUnreachable);
+}
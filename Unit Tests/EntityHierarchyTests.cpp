@@ -0,0 +1,170 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: EntityHierarchyTests
+* Description:
+*       Tests for the flattened depth-first Entity hierarchy: subtree ranges, reparenting
+*       and tombstone compaction.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#include <gtest/gtest.h>
+#include <Core/ECS/Hierarchy/EntityHierarchy.h>
+#include <Core/ECS/Entity/Entity.h>
+#include <Core/ECS/Entity/EntityRegistry.h>
+#include <Core/Memory/PoolAllocator.h>
+
+namespace {
+
+/// @brief  collects a subtree in hierarchy order along with each depth
+std::vector<std::pair<Entity*, uint32_t>> Collect(Entity const* root)
+{
+    std::vector<std::pair<Entity*, uint32_t>> nodes;
+    Hierarchy()->ForEachInSubtree(root, [&nodes](Entity* entity, uint32_t depth) { nodes.emplace_back(entity, depth); });
+    return nodes;
+}
+
+} // namespace
+
+TEST(EntityHierarchyTests, SubtreeIsContiguousWithParentsFirst) {
+    auto* root = new Entity();
+    auto* a = new Entity();
+    auto* b = new Entity();
+    auto* a1 = new Entity();
+    a->SetParent(root);
+    b->SetParent(root);
+    a1->SetParent(a);
+
+    EXPECT_EQ(root->GetNumDescendants(), 3);
+    EXPECT_EQ(a->GetNumDescendants(), 1);
+
+    const auto nodes = Collect(root);
+    ASSERT_EQ(nodes.size(), 4u);
+    EXPECT_EQ(nodes[0].first, root);
+    EXPECT_EQ(nodes[0].second, 0u);
+
+    auto indexOf = [&nodes](Entity const* entity) {
+        return std::find_if(nodes.begin(), nodes.end(), [entity](auto const& node) { return node.first == entity; }) - nodes.begin();
+    };
+    EXPECT_LT(indexOf(a), indexOf(a1));
+    EXPECT_EQ(nodes[indexOf(a1)].second, 2u);
+    EXPECT_EQ(Hierarchy()->GetDepth(b), 1u);
+
+    delete root;
+}
+
+TEST(EntityHierarchyTests, ReparentMovesWholeSubtree) {
+    auto* left = new Entity();
+    auto* right = new Entity();
+    auto* branch = new Entity();
+    auto* leaf = new Entity();
+    branch->SetParent(left);
+    leaf->SetParent(branch);
+
+    branch->SetParent(right);
+
+    EXPECT_TRUE(leaf->IsDescendedFrom(right));
+    EXPECT_FALSE(leaf->IsDescendedFrom(left));
+    EXPECT_EQ(left->GetNumDescendants(), 0);
+    EXPECT_EQ(right->GetNumDescendants(), 2);
+    EXPECT_TRUE(left->GetChildren().empty());
+    ASSERT_EQ(right->GetChildren().size(), 1u);
+    EXPECT_EQ(Collect(right).size(), 3u);
+    EXPECT_EQ(Collect(left).size(), 1u);
+    EXPECT_EQ(Hierarchy()->GetDepth(leaf), 2u);
+
+    // back to being a root
+    branch->SetParent(nullptr);
+    EXPECT_FALSE(leaf->IsDescendedFrom(right));
+    EXPECT_TRUE(leaf->IsDescendedFrom(branch));
+    EXPECT_EQ(right->GetNumDescendants(), 0);
+    EXPECT_EQ(Hierarchy()->GetDepth(leaf), 1u);
+
+    delete left;
+    delete right;
+    delete branch;
+}
+
+TEST(EntityHierarchyTests, ParentingUnderOwnDescendantIsRejected) {
+    Entity root;
+    Entity child;
+    child.SetParent(&root);
+
+    std::ostringstream log;
+    Log()->SetSink(&log);
+    root.SetParent(&child);
+    Log()->Flush();
+    Log()->SetSink(nullptr);
+
+    EXPECT_NE(log.str().find("ERROR"), std::string::npos);
+    EXPECT_EQ(root.GetParent(), nullptr);
+    EXPECT_FALSE(root.IsDescendedFrom(&child));
+}
+
+TEST(EntityHierarchyTests, DestroyedChildrenLeaveTombstonesUntilCompaction) {
+    auto* root = new Entity();
+    auto* keep = new Entity();
+    keep->SetParent(root);
+    for (int i = 0; i < 8; ++i)
+    {
+        auto* doomed = new Entity();
+        doomed->SetParent(root);
+        (new Entity())->SetParent(doomed);
+    }
+
+    auto* last = new Entity();
+    last->SetParent(keep);
+    EXPECT_EQ(root->GetNumDescendants(), 18);
+
+    // delete every child except keep; their own children go with them
+    const std::vector<Entity*> children = root->GetChildren();
+    for (Entity* child : children)
+        if (child != keep)
+            delete child;
+
+    EXPECT_EQ(root->GetNumDescendants(), 2);
+    EXPECT_GE(Hierarchy()->GetTombstoneCount(), 16u);
+    EXPECT_EQ(Collect(root).size(), 3u);
+
+    Hierarchy()->Compact();
+    EXPECT_EQ(Hierarchy()->GetTombstoneCount(), 0u);
+
+    auto [begin, end] = Hierarchy()->GetSubtreeRange(root);
+    EXPECT_EQ(end - begin, 3u);
+    EXPECT_TRUE(last->IsDescendedFrom(root));
+    EXPECT_TRUE(last->IsDescendedFrom(keep));
+
+    delete root;
+}
+
+TEST(EntityHierarchyTests, DeletingARootReleasesItsWholeSubtree) {
+    PoolAllocator const* pool = Pools()->GetPool(sizeof(Entity));
+    ASSERT_NE(pool, nullptr);
+    const std::size_t liveBlocks = pool->GetLiveCount();
+    const uint32_t liveEntities = Entities()->GetLiveCount();
+
+    auto* root = new Entity();
+    std::vector<EntityHandle> handles{ root->GetHandle() };
+    for (int i = 0; i < 4; ++i)
+    {
+        auto* child = new Entity();
+        child->SetParent(root);
+        handles.push_back(child->GetHandle());
+        for (int j = 0; j < 3; ++j)
+        {
+            auto* grandchild = new Entity();
+            grandchild->SetParent(child);
+            handles.push_back(grandchild->GetHandle());
+        }
+    }
+    EXPECT_EQ(root->GetNumDescendants(), 16);
+    EXPECT_EQ(pool->GetLiveCount(), liveBlocks + 17);
+
+    delete root;
+    EXPECT_EQ(pool->GetLiveCount(), liveBlocks);
+    EXPECT_EQ(Entities()->GetLiveCount(), liveEntities);
+    for (EntityHandle handle : handles)
+        EXPECT_FALSE(Entities()->IsAlive(handle));
+}
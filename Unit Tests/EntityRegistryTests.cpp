@@ -0,0 +1,100 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: EntityRegistryTests
+* Description:
+*       Tests for the generational EntityRegistry: handle allocation, slot reuse,
+*       stale handle detection and concurrent allocation.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#include <gtest/gtest.h>
+#include <Core/ECS/Entity/Entity.h>
+#include <Core/ECS/Entity/EntityRegistry.h>
+
+TEST(EntityRegistryTests, EntityResolvesThroughItsHandle) {
+    Entity e;
+    const EntityHandle handle = e.GetHandle();
+    EXPECT_FALSE(handle.IsNull());
+    EXPECT_EQ(handle.m_Index, e.GetId());
+    EXPECT_EQ(Entities()->Resolve(handle), &e);
+    EXPECT_TRUE(Entities()->IsAlive(handle));
+}
+
+TEST(EntityRegistryTests, NullHandleNeverResolves) {
+    EntityHandle handle;
+    EXPECT_TRUE(handle.IsNull());
+    EXPECT_EQ(Entities()->Resolve(handle), nullptr);
+    EXPECT_FALSE(Entities()->Release(handle));
+}
+
+TEST(EntityRegistryTests, DestroyedEntityHandleBecomesStale) {
+    auto* e = new Entity();
+    const EntityHandle handle = e->GetHandle();
+    delete e;
+
+    EXPECT_FALSE(Entities()->IsAlive(handle));
+    EXPECT_EQ(Entities()->Resolve(handle), nullptr);
+}
+
+TEST(EntityRegistryTests, SlotsAreRecycledWithNewGeneration) {
+    auto* first = new Entity();
+    const EntityHandle oldHandle = first->GetHandle();
+    delete first;
+
+    Entity second;
+    const EntityHandle newHandle = second.GetHandle();
+
+    // the freed slot is reused, so IDs stay dense
+    EXPECT_EQ(newHandle.m_Index, oldHandle.m_Index);
+    EXPECT_NE(newHandle.m_Generation, oldHandle.m_Generation);
+    EXPECT_EQ(Entities()->Resolve(oldHandle), nullptr);
+    EXPECT_EQ(Entities()->Resolve(newHandle), &second);
+}
+
+TEST(EntityRegistryTests, ReleaseTwiceFails) {
+    Entity e;
+    const EntityHandle handle = Entities()->Create(&e);
+    EXPECT_TRUE(Entities()->Release(handle));
+    EXPECT_FALSE(Entities()->Release(handle));
+}
+
+TEST(EntityRegistryTests, GetEntityAndGetHandleByIndex) {
+    Entity e;
+    EXPECT_EQ(Entities()->GetEntity(e.GetId()), &e);
+    EXPECT_EQ(Entities()->GetHandle(e.GetId()), e.GetHandle());
+    EXPECT_LT(e.GetId(), Entities()->GetCapacity());
+}
+
+TEST(EntityRegistryTests, ConcurrentAllocationProducesUniqueHandles) {
+    constexpr int kThreads = 4;
+    constexpr int kPerThread = 2000;
+    const uint32_t liveBefore = Entities()->GetLiveCount();
+
+    std::vector<std::vector<EntityHandle>> handles(kThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t)
+    {
+        threads.emplace_back([&handles, t] {
+            for (int i = 0; i < kPerThread; ++i)
+                handles[t].push_back(Entities()->Create(nullptr));
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    std::vector<uint32_t> indices;
+    for (auto const& list : handles)
+        for (EntityHandle h : list)
+            indices.push_back(h.m_Index);
+    EXPECT_EQ(Entities()->GetLiveCount(), liveBefore + kThreads * kPerThread);
+    std::sort(indices.begin(), indices.end());
+    EXPECT_EQ(std::adjacent_find(indices.begin(), indices.end()), indices.end());
+
+    for (auto const& list : handles)
+        for (EntityHandle h : list)
+            Entities()->Release(h);
+    EXPECT_EQ(Entities()->GetLiveCount(), liveBefore);
+}
@@ -0,0 +1,204 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: EventBusTests
+* Description:
+*       Tests for the lock-free MpmcQueue and the batched, typed EventBus.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#include <gtest/gtest.h>
+#include <Core/Events/EventBus.h>
+#include <Systems/Grid System/GridSystem.h>
+
+namespace {
+
+struct Ping
+{
+    int m_Producer;
+    int m_Sequence;
+};
+
+struct TrapTriggered
+{
+    int m_TrapId;
+};
+
+struct Alarm
+{
+    int m_Level;
+};
+
+} // namespace
+
+TEST(MpmcQueueTests, RoundsCapacityAndPreservesOrder) {
+    MpmcQueue<int> queue(5);
+    EXPECT_EQ(queue.GetCapacity(), 8u);
+
+    for (int i = 0; i < 8; ++i)
+        EXPECT_TRUE(queue.TryPush(i));
+    EXPECT_FALSE(queue.TryPush(8));
+
+    int value = -1;
+    for (int i = 0; i < 8; ++i)
+    {
+        ASSERT_TRUE(queue.TryPop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(queue.TryPop(value));
+
+    // wraps around the ring
+    EXPECT_TRUE(queue.TryPush(42));
+    EXPECT_TRUE(queue.TryPop(value));
+    EXPECT_EQ(value, 42);
+}
+
+TEST(EventBusTests, BatchesAreDeliveredOnlyAtDispatch) {
+    std::vector<int> received;
+    std::size_t batches = 0;
+    const SubscriptionId id = Events()->Subscribe<TrapTriggered>([&](std::span<TrapTriggered const> batch) {
+        ++batches;
+        for (TrapTriggered const& event : batch)
+            received.push_back(event.m_TrapId);
+    });
+
+    Events()->Publish(TrapTriggered{ 1 });
+    Events()->Publish(TrapTriggered{ 2 });
+    EXPECT_TRUE(received.empty());
+    EXPECT_EQ(Events()->GetPendingCount<TrapTriggered>(), 2u);
+
+    Events()->Dispatch();
+    EXPECT_EQ(batches, 1u);
+    EXPECT_EQ(received, (std::vector<int>{ 1, 2 }));
+
+    // nothing new, so no empty batch either
+    Events()->Dispatch();
+    EXPECT_EQ(batches, 1u);
+
+    EXPECT_TRUE(Events()->Unsubscribe<TrapTriggered>(id));
+    EXPECT_FALSE(Events()->Unsubscribe<TrapTriggered>(id));
+}
+
+TEST(EventBusTests, EventsWithoutSubscribersAreDropped) {
+    Events()->Publish(TrapTriggered{ 7 });
+    EXPECT_EQ(Events()->GetPendingCount<TrapTriggered>(), 0u);
+}
+
+TEST(EventBusTests, ConcurrentProducersBeyondCapacityLoseNothing) {
+    constexpr int kProducers = 4;
+    constexpr int kPerProducer = 3000; // more than one ring's worth in total
+
+    std::vector<std::vector<int>> seen(kProducers, std::vector<int>(kPerProducer, 0));
+    std::size_t total = 0;
+    const SubscriptionId id = Events()->Subscribe<Ping>([&](std::span<Ping const> batch) {
+        total += batch.size();
+        for (Ping const& ping : batch)
+            ++seen[ping.m_Producer][ping.m_Sequence];
+    });
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p)
+    {
+        producers.emplace_back([p] {
+            for (int i = 0; i < kPerProducer; ++i)
+                Events()->Publish(Ping{ p, i });
+        });
+    }
+    for (auto& producer : producers)
+        producer.join();
+
+    Events()->Dispatch();
+    EXPECT_EQ(total, static_cast<std::size_t>(kProducers * kPerProducer));
+    for (auto const& producer : seen)
+        EXPECT_EQ(std::count(producer.begin(), producer.end(), 1), kPerProducer);
+
+    Events()->Unsubscribe<Ping>(id);
+}
+
+TEST(EventBusTests, HandlerPublishesWaitForNextDispatch) {
+    int pings = 0;
+    const SubscriptionId trapId = Events()->Subscribe<TrapTriggered>([](std::span<TrapTriggered const> batch) {
+        for (TrapTriggered const& event : batch)
+            Events()->Publish(Ping{ event.m_TrapId, 0 });
+    });
+    const SubscriptionId pingId = Events()->Subscribe<Ping>([&pings](std::span<Ping const> batch) {
+        pings += static_cast<int>(batch.size());
+    });
+
+    Events()->Publish(TrapTriggered{ 3 });
+    Events()->Dispatch();
+    EXPECT_EQ(pings, 0);
+    Events()->Dispatch();
+    EXPECT_EQ(pings, 1);
+
+    Events()->Unsubscribe<TrapTriggered>(trapId);
+    Events()->Unsubscribe<Ping>(pingId);
+}
+
+TEST(EventBusTests, HandlersMaySubscribeAndUnsubscribeDuringDispatch) {
+    int firstCalls = 0;
+    int laterCalls = 0;
+    int lateCalls = 0;
+    SubscriptionId firstId = 0;
+    SubscriptionId laterId = 0;
+    SubscriptionId lateId = 0;
+
+    // the first handler removes itself and the handler after it, and adds a new one
+    firstId = Events()->Subscribe<Alarm>([&](std::span<Alarm const>) {
+        ++firstCalls;
+        EXPECT_TRUE(Events()->Unsubscribe<Alarm>(firstId));
+        EXPECT_TRUE(Events()->Unsubscribe<Alarm>(laterId));
+        lateId = Events()->Subscribe<Alarm>([&](std::span<Alarm const> batch) {
+            lateCalls += static_cast<int>(batch.size());
+        });
+    });
+    laterId = Events()->Subscribe<Alarm>([&](std::span<Alarm const>) { ++laterCalls; });
+
+    Events()->Publish(Alarm{ 1 });
+    Events()->Dispatch();
+    EXPECT_EQ(firstCalls, 1);
+    EXPECT_EQ(laterCalls, 0);
+    EXPECT_EQ(lateCalls, 0);
+    EXPECT_FALSE(Events()->Unsubscribe<Alarm>(firstId));
+
+    Events()->Publish(Alarm{ 2 });
+    Events()->Dispatch();
+    EXPECT_EQ(firstCalls, 1);
+    EXPECT_EQ(laterCalls, 0);
+    EXPECT_EQ(lateCalls, 1);
+
+    EXPECT_TRUE(Events()->Unsubscribe<Alarm>(lateId));
+}
+
+TEST(EventBusTests, GridPublishesCellChanges) {
+    std::vector<CellChanged> changes;
+    std::vector<GridMapLoaded> loads;
+    const SubscriptionId cellId = Events()->Subscribe<CellChanged>([&](std::span<CellChanged const> batch) {
+        changes.insert(changes.end(), batch.begin(), batch.end());
+    });
+    const SubscriptionId loadId = Events()->Subscribe<GridMapLoaded>([&](std::span<GridMapLoaded const> batch) {
+        loads.insert(loads.end(), batch.begin(), batch.end());
+    });
+
+    auto grid = GridSystem::GetInstance();
+    grid->CreateMap("EventMap", GridSystem::Dimension(4, 3), '.');
+    ASSERT_TRUE(grid->LoadMap("EventMap"));
+    grid->SetCell(1, 2, '#');
+    grid->SetCell(1, 2, '#');  // unchanged
+    grid->SetCell(9, 9, '#');  // out of bounds
+    Events()->Dispatch();
+
+    ASSERT_EQ(loads.size(), 1u);
+    EXPECT_EQ(loads[0].m_Width, 4);
+    ASSERT_EQ(changes.size(), 1u);
+    EXPECT_EQ(changes[0].m_X, 1);
+    EXPECT_EQ(changes[0].m_Y, 2);
+    EXPECT_EQ(changes[0].m_Previous, '.');
+    EXPECT_EQ(changes[0].m_Value, '#');
+
+    grid->DeleteMap("EventMap");
+    Events()->Unsubscribe<CellChanged>(cellId);
+    Events()->Unsubscribe<GridMapLoaded>(loadId);
+}
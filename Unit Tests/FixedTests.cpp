@@ -0,0 +1,124 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: FixedTests
+* Description:
+*       Tests for Fixed<Q> arithmetic, saturation and square roots, and for fixed-point
+*       Vectors, checked against exact raw values.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#include <gtest/gtest.h>
+#include <Core/Math/Fixed.h>
+
+namespace {
+
+constexpr Fixed16 F(double value) { return Fixed16(value); }
+
+} // namespace
+
+TEST(FixedTests, ConvertsToAndFromRaw)
+{
+    EXPECT_EQ(Fixed16(1).GetRaw(), 65536);
+    EXPECT_EQ(Fixed16(-3).GetRaw(), -3 * 65536);
+    EXPECT_EQ(F(0.5).GetRaw(), 32768);
+    EXPECT_EQ(F(-0.25).GetRaw(), -16384);
+    EXPECT_EQ(F(1.5).ToInt(), 1);
+    EXPECT_EQ(F(-1.5).ToInt(), -2);
+    EXPECT_DOUBLE_EQ(Fixed16::FromRaw(98304).ToDouble(), 1.5);
+}
+
+TEST(FixedTests, ArithmeticIsExactOnRepresentableValues)
+{
+    EXPECT_EQ(F(1.5) + F(2.25), F(3.75));
+    EXPECT_EQ(F(1.5) - F(2.25), F(-0.75));
+    EXPECT_EQ(F(1.5) * F(-2.5), F(-3.75));
+    EXPECT_EQ(F(-3.75) / F(1.5), F(-2.5));
+    EXPECT_EQ(-F(2.0), F(-2.0));
+    EXPECT_LT(F(-1.0), F(0.5));
+    EXPECT_EQ(Abs(F(-7.0)), F(7.0));
+}
+
+TEST(FixedTests, RoundingIsSpecified)
+{
+    // the product of two smallest steps rounds half up: 2^-32 rounds to 0, 2^-17 to 1 step
+    EXPECT_EQ((Fixed16::Epsilon() * Fixed16::Epsilon()).GetRaw(), 0);
+    EXPECT_EQ((Fixed16::Epsilon() * F(0.5)).GetRaw(), 1);
+    EXPECT_EQ((-Fixed16::Epsilon() * F(0.5)).GetRaw(), 0);
+
+    // division truncates towards zero
+    EXPECT_EQ((Fixed16(1) / Fixed16(3)).GetRaw(), 21845);
+    EXPECT_EQ((Fixed16(-1) / Fixed16(3)).GetRaw(), -21845);
+}
+
+TEST(FixedTests, OverflowSaturates)
+{
+    EXPECT_EQ(Fixed16::Max() + Fixed16::Epsilon(), Fixed16::Max());
+    EXPECT_EQ(Fixed16::Min() - Fixed16::Epsilon(), Fixed16::Min());
+    EXPECT_EQ(Fixed16(30000) * Fixed16(30000), Fixed16::Max());
+    EXPECT_EQ(Fixed16(30000) * Fixed16(-30000), Fixed16::Min());
+    EXPECT_EQ(-Fixed16::Min(), Fixed16::Max());
+    EXPECT_EQ(Fixed16(1'000'000), Fixed16::Max());
+    EXPECT_EQ(Fixed16(-1e12), Fixed16::Min());
+    EXPECT_EQ(Fixed16(4'000'000'000u), Fixed16::Max());
+
+    EXPECT_EQ(Fixed16(1) / Fixed16(), Fixed16::Max());
+    EXPECT_EQ(Fixed16(-1) / Fixed16(), Fixed16::Min());
+    EXPECT_EQ(Fixed16(20000) / F(0.25), Fixed16::Max());
+}
+
+TEST(FixedTests, SqrtRoundsDown)
+{
+    EXPECT_EQ(Sqrt(Fixed16(4)), Fixed16(2));
+    EXPECT_EQ(Sqrt(F(2.25)), F(1.5));
+    EXPECT_EQ(Sqrt(Fixed16(2)).GetRaw(), 92681);
+    EXPECT_EQ(Sqrt(F(-1.0)), Fixed16());
+    EXPECT_EQ(Sqrt(Fixed16::Max()).GetRaw(), 11863283);
+}
+
+TEST(FixedTests, UsableInConstantExpressions)
+{
+    constexpr Fixed16 kHalf = F(0.5);
+    constexpr Vec2q kStep{ kHalf, Fixed16(2) };
+    constexpr Vec2q kTwice = kStep + kStep;
+    static_assert(kTwice == Vec2q{ Fixed16(1), Fixed16(4) });
+    static_assert(kStep.Dot(kStep) == F(4.25));
+    static_assert(Sqrt(Fixed16(9)) == Fixed16(3));
+}
+
+TEST(FixedTests, VectorLengthUsesIntegerSquareRoot)
+{
+    const Vec2q v{ Fixed16(3), Fixed16(4) };
+    EXPECT_EQ(v.LengthSq(), Fixed16(25));
+    EXPECT_EQ(v.Length(), Fixed16(5));
+    EXPECT_EQ(Length(v + v), Fixed16(10));
+
+    // LengthSq saturates here, but Length keeps the whole sum of squares
+    const Vec3q far{ Fixed16(20000), Fixed16(-20000), Fixed16(10000) };
+    EXPECT_EQ(far.LengthSq(), Fixed16::Max());
+    EXPECT_EQ(far.Length(), Fixed16(30000));
+}
+
+TEST(FixedTests, NormalizeIsBitExact)
+{
+    Vec2q v{ Fixed16(3), Fixed16(4) };
+    v.Normalize();
+    // 0.6 and 0.8, each truncated to the step below
+    EXPECT_EQ(v, (Vec2q{ Fixed16::FromRaw(39321), Fixed16::FromRaw(52428) }));
+    EXPECT_EQ(Vec2q::Zero().Normalized(), Vec2q::Zero());
+
+    const Vec2q n = Normalize(Vec2q{ Fixed16(0), Fixed16(-9) });
+    EXPECT_EQ(n, (Vec2q{ Fixed16(), Fixed16(-1) }));
+}
+
+TEST(FixedTests, VectorOperationsSaturate)
+{
+    Vec2q v{ Fixed16(30000), Fixed16(-30000) };
+    v += Vec2q{ Fixed16(10000), Fixed16(-10000) };
+    EXPECT_EQ(v, (Vec2q{ Fixed16::Max(), Fixed16::Min() }));
+
+    const Vec2q scaled = Vec2q{ Fixed16(2), Fixed16(-3) } * F(0.5) - Vec2q(Fixed16(1));
+    EXPECT_EQ(scaled, (Vec2q{ Fixed16(), F(-2.5) }));
+}
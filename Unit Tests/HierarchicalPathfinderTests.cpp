@@ -0,0 +1,191 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: HierarchicalPathfinderTests
+* Description:
+*       Tests for the hierarchical pathfinder: agreement with A* on random maps, refined
+*       paths, and which clusters edits rebuild, directly and through the GridSystem.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#include <Systems/Pathfinding/HierarchicalPathfinder.h>
+#include "PathTestUtils.h"
+
+TEST(HierarchicalPathfinderTests, AgreesWithAStarAndStaysNearOptimal)
+{
+    for (uint32_t seed = 1; seed <= 3; ++seed)
+    {
+        HierarchicalPathfinder pathfinder(16);
+        pathfinder.Build(MakeRandomGrid(100, 70, 25, 10, seed), WaterTerrain(3));
+        PathGrid const& grid = pathfinder.GetGrid();
+        EXPECT_EQ(pathfinder.GetClusterCount(), 7u * 5u);
+
+        std::mt19937 rng(seed);
+        std::vector<Vec2i> waypoints, cells, exact;
+        uint64_t hierarchicalTotal = 0, exactTotal = 0;
+        for (int query = 0; query < 100; ++query)
+        {
+            const Vec2i start = RandomOpenCell(grid, rng);
+            const Vec2i goal = RandomOpenCell(grid, rng);
+            const PathResult expected = FindPath(grid, start, goal, exact);
+            const PathResult result = pathfinder.FindPath(start, goal, waypoints);
+            ASSERT_EQ(result.m_Status, expected.m_Status) << "seed " << seed << " query " << query;
+            if (!result.IsFound())
+                continue;
+
+            EXPECT_GE(result.m_Cost, expected.m_Cost);
+            pathfinder.Refine(waypoints, cells);
+            ASSERT_FALSE(cells.empty());
+            EXPECT_EQ(cells.front(), start);
+            EXPECT_EQ(cells.back(), goal);
+            EXPECT_EQ(WalkPath(grid, cells), result.m_Cost) << "seed " << seed << " query " << query;
+
+            hierarchicalTotal += result.m_Cost;
+            exactTotal += expected.m_Cost;
+        }
+        EXPECT_LE(hierarchicalTotal, exactTotal * 13 / 10) << "seed " << seed;
+    }
+}
+
+TEST(HierarchicalPathfinderTests, RefinesLegsLazily)
+{
+    // a corridor, so the entrances sit on the straight line
+    HierarchicalPathfinder pathfinder(8);
+    pathfinder.Build(GridSystem::Grid(40, 1));
+
+    std::vector<Vec2i> waypoints;
+    const PathResult result = pathfinder.FindPath({ 1, 0 }, { 38, 0 }, waypoints);
+    ASSERT_TRUE(result.IsFound());
+    EXPECT_EQ(result.m_Cost, 37 * kStraightStepCost);
+    ASSERT_GE(waypoints.size(), 3u);
+
+    // one leg at a time, each ending on its waypoint
+    std::vector<Vec2i> cells{ waypoints.front() };
+    for (std::size_t i = 1; i < waypoints.size(); ++i)
+    {
+        pathfinder.RefineLeg(waypoints[i - 1], waypoints[i], cells);
+        EXPECT_EQ(cells.back(), waypoints[i]);
+    }
+    EXPECT_EQ(WalkPath(pathfinder.GetGrid(), cells), result.m_Cost);
+}
+
+TEST(HierarchicalPathfinderTests, ReportsInvalidEndpointsAndMissingPaths)
+{
+    GridSystem::Grid map(20, 20);
+    for (int y = 0; y < 20; ++y)
+        map.SetCell(10, y, '#');
+
+    HierarchicalPathfinder pathfinder(8);
+    pathfinder.Build(map);
+
+    std::vector<Vec2i> waypoints;
+    EXPECT_EQ(pathfinder.FindPath({ 10, 3 }, { 1, 1 }, waypoints).m_Status, PathStatus::Invalid);
+    EXPECT_EQ(pathfinder.FindPath({ 1, 1 }, { 25, 1 }, waypoints).m_Status, PathStatus::Invalid);
+    EXPECT_EQ(pathfinder.FindPath({ 1, 1 }, { 18, 18 }, waypoints).m_Status, PathStatus::NoPath);
+    EXPECT_TRUE(waypoints.empty());
+
+    const PathResult same = pathfinder.FindPath({ 4, 4 }, { 4, 4 }, waypoints);
+    EXPECT_TRUE(same.IsFound());
+    EXPECT_EQ(same.m_Cost, 0u);
+    EXPECT_EQ(waypoints, (std::vector<Vec2i>{ Vec2i{ 4, 4 } }));
+}
+
+TEST(HierarchicalPathfinderTests, EditsRebuildOnlyTheClustersTheyTouch)
+{
+    HierarchicalPathfinder pathfinder(8);
+    pathfinder.Build(GridSystem::Grid(32, 32));
+    ASSERT_EQ(pathfinder.GetClusterRebuildCount(), 16u);
+
+    // interior cell: only its own cluster
+    pathfinder.SetCell(12, 12, '#');
+    EXPECT_EQ(pathfinder.GetDirtyClusterCount(), 1u);
+    pathfinder.Refresh();
+    EXPECT_EQ(pathfinder.GetClusterRebuildCount(), 17u);
+
+    // no change, no rebuild
+    pathfinder.SetCell(12, 12, '#');
+    EXPECT_EQ(pathfinder.GetDirtyClusterCount(), 0u);
+
+    // border cell: both sides of the border
+    pathfinder.SetCell(15, 12, '#');
+    EXPECT_EQ(pathfinder.GetDirtyClusterCount(), 2u);
+    pathfinder.Refresh();
+    EXPECT_EQ(pathfinder.GetClusterRebuildCount(), 19u);
+
+    // corner cell: both neighbours across its borders, but not the diagonal one
+    pathfinder.SetCell(15, 15, '#');
+    pathfinder.SetCell(15, 14, '#');
+    EXPECT_EQ(pathfinder.GetDirtyClusterCount(), 3u);
+    pathfinder.Refresh();
+    EXPECT_EQ(pathfinder.GetDirtyClusterCount(), 0u);
+}
+
+TEST(HierarchicalPathfinderTests, IncrementalUpdatesMatchAFreshBuild)
+{
+    GridSystem::Grid map = MakeRandomGrid(64, 48, 20, 10, 7);
+    HierarchicalPathfinder incremental(16);
+    incremental.Build(map, WaterTerrain(3));
+
+    std::mt19937 rng(99);
+    for (int round = 0; round < 5; ++round)
+    {
+        for (int edit = 0; edit < 40; ++edit)
+        {
+            const int x = static_cast<int>(rng() % 64);
+            const int y = static_cast<int>(rng() % 48);
+            const char value = "#.~"[rng() % 3];
+            map.SetCell(x, y, value);
+            incremental.SetCell(x, y, value);
+        }
+        incremental.Refresh();
+
+        HierarchicalPathfinder fresh(16);
+        fresh.Build(map, WaterTerrain(3));
+        EXPECT_EQ(incremental.GetNodeCount(), fresh.GetNodeCount());
+
+        std::vector<Vec2i> waypoints;
+        for (int query = 0; query < 30; ++query)
+        {
+            const Vec2i start = RandomOpenCell(fresh.GetGrid(), rng);
+            const Vec2i goal = RandomOpenCell(fresh.GetGrid(), rng);
+            const PathResult expected = fresh.FindPath(start, goal, waypoints);
+            const PathResult result = incremental.FindPath(start, goal, waypoints);
+            EXPECT_EQ(result.m_Status, expected.m_Status) << "round " << round << " query " << query;
+            EXPECT_EQ(result.m_Cost, expected.m_Cost) << "round " << round << " query " << query;
+        }
+    }
+}
+
+class HierarchicalPathfinderGridTests : public PathGridSystemTest {};
+
+TEST_F(HierarchicalPathfinderGridTests, FollowsTheActiveMapAtSyncPoints)
+{
+    HierarchicalPathfinder pathfinder(8);
+    pathfinder.Attach();
+
+    gs->CreateMap("hpa_test", GridSystem::Dimension(24, 16));
+    ASSERT_TRUE(gs->LoadMap("hpa_test"));
+    Events()->Dispatch();
+    EXPECT_EQ(pathfinder.GetGrid().GetWidth(), 24);
+    EXPECT_EQ(pathfinder.GetClusterCount(), 3u * 2u);
+
+    std::vector<Vec2i> waypoints;
+    EXPECT_TRUE(pathfinder.FindPath({ 1, 1 }, { 22, 1 }, waypoints).IsFound());
+
+    // wall off the right side; nothing changes until the batch is delivered
+    for (int y = 0; y < 16; ++y)
+        gs->SetCell(12, y, '#');
+    EXPECT_TRUE(pathfinder.FindPath({ 1, 1 }, { 22, 1 }, waypoints).IsFound());
+
+    const uint64_t rebuilds = pathfinder.GetClusterRebuildCount();
+    Events()->Dispatch();
+    EXPECT_EQ(pathfinder.GetClusterRebuildCount(), rebuilds + 2);
+    EXPECT_EQ(pathfinder.FindPath({ 1, 1 }, { 22, 1 }, waypoints).m_Status, PathStatus::NoPath);
+
+    pathfinder.Detach();
+    gs->SetCell(12, 5, '.');
+    Events()->Dispatch();
+    EXPECT_EQ(pathfinder.FindPath({ 1, 1 }, { 22, 1 }, waypoints).m_Status, PathStatus::NoPath);
+}
@@ -0,0 +1,207 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: IncrementalPlannerTests
+* Description:
+*       Tests for D* Lite replanning: costs matching A* after edits and moves, repairs
+*       that stay local to small edits, and batches of CellChanged from the GridSystem.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#include <Systems/Pathfinding/IncrementalPlanner.h>
+#include "PathTestUtils.h"
+
+TEST(IncrementalPlannerTests, FirstPlanMatchesAStar)
+{
+    const PathGrid grid(MakeRandomGrid(60, 45, 25, 15, 1), WaterTerrain(3));
+    std::mt19937 rng(2);
+
+    for (bool diagonal : { true, false })
+    {
+        IncrementalPlanner planner(grid, diagonal);
+        PathOptions options;
+        options.m_AllowDiagonal = diagonal;
+
+        std::vector<Vec2i> expectedPath, path;
+        for (int query = 0; query < 40; ++query)
+        {
+            const Vec2i start = RandomOpenCell(grid, rng);
+            const Vec2i goal = RandomOpenCell(grid, rng);
+            planner.Plan(start, goal);
+            const PathResult result = planner.Replan();
+            const PathResult expected = FindPath(grid, start, goal, expectedPath, options);
+            ASSERT_EQ(result.m_Status, expected.m_Status) << "query " << query;
+            EXPECT_EQ(result.m_Cost, expected.m_Cost) << "query " << query;
+
+            planner.ExtractPath(path);
+            EXPECT_EQ(path.empty(), !expected.IsFound());
+            if (!expected.IsFound())
+                continue;
+            EXPECT_EQ(path.front(), start);
+            EXPECT_EQ(path.back(), goal);
+            EXPECT_EQ(WalkPath(grid, path), result.m_Cost);
+        }
+    }
+}
+
+TEST(IncrementalPlannerTests, RepairsMatchAFreshSearchAfterEditsAndMoves)
+{
+    GridSystem::Grid map = MakeRandomGrid(50, 40, 20, 15, 3);
+    PathGrid grid(map, WaterTerrain(3));
+    std::mt19937 rng(4);
+
+    const Vec2i goal = RandomOpenCell(grid, rng);
+    Vec2i start = RandomOpenCell(grid, rng);
+    IncrementalPlanner planner(grid);
+    planner.Plan(start, goal);
+    planner.Replan();
+
+    std::vector<Vec2i> path, expectedPath;
+    for (int round = 0; round < 40; ++round)
+    {
+        std::vector<CellChanged> changes;
+        for (int edit = 0; edit < 8; ++edit)
+        {
+            const int x = static_cast<int>(rng() % 50);
+            const int y = static_cast<int>(rng() % 40);
+            const char value = "#.~"[rng() % 3];
+            if (Vec2i{ x, y } == goal || Vec2i{ x, y } == start)
+                continue;
+            changes.push_back({ x, y, map.GetCell(x, y), value });
+            map.SetCell(x, y, value);
+            grid.SetCell(x, y, value);
+        }
+        planner.ApplyChanges(changes);
+
+        // walk a few steps along the current path before replanning
+        planner.ExtractPath(path);
+        if (path.size() > 3)
+        {
+            start = path[3];
+            if (grid.IsWalkable(start))
+                planner.SetStart(start);
+            else
+                start = planner.GetStart();
+        }
+
+        const PathResult result = planner.Replan();
+        const PathResult expected = FindPath(grid, start, goal, expectedPath);
+        ASSERT_EQ(result.m_Status, expected.m_Status) << "round " << round;
+        ASSERT_EQ(result.m_Cost, expected.m_Cost) << "round " << round;
+        if (result.IsFound())
+        {
+            planner.ExtractPath(path);
+            EXPECT_EQ(WalkPath(grid, path), result.m_Cost) << "round " << round;
+        }
+    }
+}
+
+TEST(IncrementalPlannerTests, SmallEditsRepairLocally)
+{
+    GridSystem::Grid map = MakeRandomGrid(160, 160, 25, 15, 5);
+    PathGrid grid(map, WaterTerrain(3));
+    std::mt19937 rng(6);
+
+    uint64_t repairedTotal = 0, freshTotal = 0;
+    for (int trial = 0; trial < 10; ++trial)
+    {
+        const Vec2i start = RandomOpenCell(grid, rng);
+        const Vec2i goal = RandomOpenCell(grid, rng);
+        IncrementalPlanner planner(grid);
+        planner.Plan(start, goal);
+        std::vector<Vec2i> path;
+        if (!planner.Replan().IsFound())
+            continue;
+        planner.ExtractPath(path);
+        if (path.size() < 20)
+            continue;
+
+        // the agent walks a few cells, then finds the path ahead blocked
+        planner.SetStart(path[3]);
+        const Vec2i blocked = path[6];
+        grid.SetCell(blocked.x(), blocked.y(), '#');
+        planner.MarkChanged(blocked.x(), blocked.y());
+        const PathResult repaired = planner.Replan();
+
+        IncrementalPlanner fresh(grid);
+        fresh.Plan(path[3], goal);
+        const PathResult expected = fresh.Replan();
+        EXPECT_EQ(repaired.m_Status, expected.m_Status);
+        EXPECT_EQ(repaired.m_Cost, expected.m_Cost);
+        repairedTotal += repaired.m_Expanded;
+        freshTotal += expected.m_Expanded;
+
+        // nothing changed, nothing to do
+        EXPECT_EQ(planner.Replan().m_Expanded, 0u);
+
+        grid.SetCell(blocked.x(), blocked.y(), map.GetCell(blocked.x(), blocked.y()));
+    }
+    EXPECT_LT(repairedTotal * 4, freshTotal);
+}
+
+TEST(IncrementalPlannerTests, DoorsClosingAndOpening)
+{
+    GridSystem::Grid map(21, 5, '#');
+    for (int x = 1; x < 20; ++x)
+        map.SetCell(x, 2, '.');
+    PathGrid grid(map);
+
+    IncrementalPlanner planner(grid);
+    planner.Plan({ 1, 2 }, { 19, 2 });
+    EXPECT_EQ(planner.Replan().m_Cost, 18 * kStraightStepCost);
+
+    grid.SetCell(10, 2, '#');
+    planner.MarkChanged(10, 2);
+    EXPECT_EQ(planner.Replan().m_Status, PathStatus::NoPath);
+    std::vector<Vec2i> path;
+    planner.ExtractPath(path);
+    EXPECT_TRUE(path.empty());
+
+    grid.SetCell(10, 2, 'D');
+    planner.MarkChanged(10, 2);
+    const PathResult reopened = planner.Replan();
+    EXPECT_TRUE(reopened.IsFound());
+    EXPECT_EQ(reopened.m_Cost, 18 * kStraightStepCost);
+
+    // a blocked goal or start is not a plan at all
+    grid.SetCell(19, 2, '#');
+    planner.MarkChanged(19, 2);
+    EXPECT_EQ(planner.Replan().m_Status, PathStatus::Invalid);
+}
+
+class IncrementalPlannerGridTests : public PathGridSystemTest {};
+
+TEST_F(IncrementalPlannerGridTests, AbsorbsCellChangedBatches)
+{
+    gs->CreateMap("planner_test", GridSystem::Dimension(30, 20));
+    ASSERT_TRUE(gs->LoadMap("planner_test"));
+    Events()->Dispatch();
+
+    PathGrid grid(*gs->GetActiveGrid());
+    IncrementalPlanner planner(grid);
+    planner.Plan({ 2, 10 }, { 27, 10 });
+    ASSERT_TRUE(planner.Replan().IsFound());
+
+    // one subscriber updates the shared grid, then hands the batch to every planner
+    const SubscriptionId id = Events()->Subscribe<CellChanged>([&](std::span<CellChanged const> changes) {
+        for (CellChanged const& change : changes)
+            grid.SetCell(change.m_X, change.m_Y, change.m_Value);
+        planner.ApplyChanges(changes);
+    });
+
+    for (int y = 0; y < 20; ++y)
+        if (y != 3)
+            gs->SetCell(15, y, '#');
+    Events()->Dispatch();
+
+    std::vector<Vec2i> path;
+    const PathResult result = planner.Replan();
+    ASSERT_TRUE(result.IsFound());
+    EXPECT_EQ(result.m_Cost, FindPath(grid, { 2, 10 }, { 27, 10 }, path).m_Cost);
+    planner.ExtractPath(path);
+    EXPECT_NE(std::find(path.begin(), path.end(), Vec2i{ 15, 3 }), path.end());
+
+    Events()->Unsubscribe<CellChanged>(id);
+}
@@ -0,0 +1,144 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: InputSystemTests
+* Description:
+*       Tests for bitset key state, edge detection, action bindings and scripted input
+*       sources.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#include <gtest/gtest.h>
+#include <Systems/Input/InputSystem.h>
+#include <Systems/Input/TerminalReader.h>
+#include <fstream>
+
+class InputSystemTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        auto source = std::make_unique<ScriptedInputSource>();
+        m_Script = source.get();
+        Input()->SetSource(std::move(source));
+    }
+
+    void TearDown() override
+    {
+        // drain the scripted keys so later frames start empty
+        Input()->Update(0.0);
+        Input()->Update(0.0);
+        Input()->SetSource(std::make_unique<TerminalReader>());
+    }
+
+    ScriptedInputSource* m_Script = nullptr;
+};
+
+TEST_F(InputSystemTest, KeysHaveEdgesAcrossFrames) {
+    m_Script->Add(0, Key::A);
+    m_Script->Add(1, Key::A);
+    m_Script->Add(1, Key::B);
+
+    Input()->Update(0.0);
+    EXPECT_TRUE(Input()->IsKeyPressed(Key::A));
+    EXPECT_TRUE(Input()->IsKeyDown(Key::A));
+    EXPECT_FALSE(Input()->IsKeyDown(Key::B));
+    EXPECT_EQ(Input()->KeyPressed(), Key::A);
+
+    // held: down but no longer pressed; B joins in the same frame
+    Input()->Update(0.0);
+    EXPECT_FALSE(Input()->IsKeyPressed(Key::A));
+    EXPECT_TRUE(Input()->IsKeyDown(Key::A));
+    EXPECT_TRUE(Input()->IsKeyPressed(Key::B));
+    EXPECT_EQ(Input()->KeyPressed(), Key::B);
+
+    Input()->Update(0.0);
+    EXPECT_TRUE(Input()->IsKeyReleased(Key::A));
+    EXPECT_TRUE(Input()->IsKeyReleased(Key::B));
+    EXPECT_FALSE(Input()->IsKeyDown(Key::ANY));
+    EXPECT_TRUE(m_Script->IsFinished());
+}
+
+TEST_F(InputSystemTest, AnyMatchesEveryKey) {
+    m_Script->Add(0, Key::F5);
+    Input()->Update(0.0);
+    EXPECT_TRUE(Input()->IsKeyPressed(Key::ANY));
+    EXPECT_TRUE(Input()->IsKeyPressed(Key::F5));
+    EXPECT_FALSE(Input()->IsKeyPressed(Key::INVALID));
+}
+
+TEST_F(InputSystemTest, ActionsFollowTheirBoundKeys) {
+    const StringId jump = StringId::Intern("TestJump");
+    Input()->BindAction(jump, Key::SPACE);
+    Input()->BindAction(jump, Key::W);
+
+    m_Script->Add(0, Key::W);
+    m_Script->Add(1, Key::SPACE);
+    Input()->Update(0.0);
+    EXPECT_TRUE(Input()->IsActionPressed(jump));
+    EXPECT_TRUE(Input()->IsActionDown(jump));
+
+    // W released and SPACE pressed: still held through another key
+    Input()->Update(0.0);
+    EXPECT_TRUE(Input()->IsActionPressed(jump));
+
+    Input()->UnbindAction(jump);
+    EXPECT_FALSE(Input()->IsActionDown(jump));
+    EXPECT_FALSE(Input()->IsActionPressed(StringId("NeverBound")));
+}
+
+TEST_F(InputSystemTest, DefaultActionsAreBound) {
+    m_Script->Add(0, Key::g);
+    Input()->Update(0.0);
+    // lower-case codes are not normalized by scripted sources
+    EXPECT_FALSE(Input()->IsActionPressed(Actions::NewMap));
+
+    m_Script->Add(1, Key::G);
+    Input()->Update(0.0);
+    EXPECT_TRUE(Input()->IsActionPressed(Actions::NewMap));
+}
+
+TEST(ScriptedInputSourceTests, LoadsRecordings) {
+    const std::string path = testing::TempDir() + "input_recording.txt";
+    {
+        std::ofstream file(path);
+        file << "0 " << static_cast<int>(Key::A) << "\n"
+             << "2 " << static_cast<int>(Key::ARROW_UP) << "\n";
+    }
+
+    auto source = ScriptedInputSource::Load(path);
+    ASSERT_NE(source, nullptr);
+
+    KeyEvent event;
+    source->BeginFrame();
+    ASSERT_TRUE(source->Poll(event));
+    EXPECT_EQ(event.m_Key, Key::A);
+    EXPECT_FALSE(source->Poll(event));
+
+    source->BeginFrame();
+    EXPECT_FALSE(source->Poll(event));
+
+    source->BeginFrame();
+    ASSERT_TRUE(source->Poll(event));
+    EXPECT_EQ(event.m_Key, Key::ARROW_UP);
+    EXPECT_TRUE(source->IsFinished());
+}
+
+TEST(ScriptedInputSourceTests, RejectsMissingAndMalformedRecordings) {
+    std::ostringstream log;
+    Log()->SetSink(&log);
+
+    EXPECT_EQ(ScriptedInputSource::Load(testing::TempDir() + "does_not_exist.txt"), nullptr);
+
+    const std::string path = testing::TempDir() + "bad_recording.txt";
+    {
+        std::ofstream file(path);
+        file << "3 65\n1 66\n";
+    }
+    EXPECT_EQ(ScriptedInputSource::Load(path), nullptr);
+
+    Log()->Flush();
+    Log()->SetSink(nullptr);
+    EXPECT_NE(log.str().find("ERROR"), std::string::npos);
+}
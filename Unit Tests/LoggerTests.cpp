@@ -0,0 +1,115 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: LoggerTests
+* Description:
+*       Tests for the asynchronous Logger: levels, sinks, ordering across threads, reuse of
+*       finished threads' rings and truncation of long messages.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#include <gtest/gtest.h>
+#include <Core/Logging/Logger.h>
+
+class LoggerTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        Log()->Flush();
+        Log()->SetSink(&m_Log);
+    }
+
+    void TearDown() override
+    {
+        Log()->Flush();
+        Log()->SetSink(nullptr);
+        Log()->SetLevel(LogLevel::Trace);
+    }
+
+    std::string Flushed()
+    {
+        Log()->Flush();
+        return m_Log.str();
+    }
+
+    std::ostringstream m_Log;
+};
+
+TEST_F(LoggerTest, WritesLevelAndStreamedArguments) {
+    Log()->Write(LogLevel::Warning, "value ", 42, " of ", 1.5);
+    const std::string out = Flushed();
+    EXPECT_NE(out.find("[WARNING]"), std::string::npos);
+    EXPECT_NE(out.find("value 42 of 1.5"), std::string::npos);
+}
+
+TEST_F(LoggerTest, RuntimeLevelFiltersLowerMessages) {
+    Log()->SetLevel(LogLevel::Error);
+    Log()->Write(LogLevel::Info, "hidden");
+    Log()->Write(LogLevel::Error, "shown");
+    const std::string out = Flushed();
+    EXPECT_EQ(out.find("hidden"), std::string::npos);
+    EXPECT_NE(out.find("shown"), std::string::npos);
+}
+
+TEST_F(LoggerTest, CompiledOutLevelsDoNotEvaluateArguments) {
+    int evaluated = 0;
+    auto count = [&evaluated] { return ++evaluated; };
+    // Trace is below the default ETERNUM_LOG_LEVEL in every build
+    ETERNUM_LOG_TRACE("never ", count());
+    ETERNUM_LOG_ERROR("always ", count());
+    EXPECT_EQ(evaluated, 1);
+    EXPECT_NE(Flushed().find("always 1"), std::string::npos);
+}
+
+TEST_F(LoggerTest, RecordsFromManyThreadsKeepTheirOrder) {
+    constexpr int kThreads = 4;
+    constexpr int kPerThread = 100;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t)
+        threads.emplace_back([t] {
+            for (int i = 0; i < kPerThread; ++i)
+                Log()->Write(LogLevel::Info, "worker ", t, " message ", i, ";");
+        });
+    for (auto& thread : threads)
+        thread.join();
+
+    const std::string out = Flushed();
+    for (int t = 0; t < kThreads; ++t)
+    {
+        std::size_t previous = 0;
+        for (int i = 0; i < kPerThread; ++i)
+        {
+            const std::string text = "worker " + std::to_string(t) + " message " + std::to_string(i) + ";";
+            const std::size_t position = out.find(text);
+            ASSERT_NE(position, std::string::npos) << text;
+            EXPECT_GE(position, previous);
+            previous = position;
+        }
+    }
+    EXPECT_EQ(Log()->GetDroppedCount(), 0u);
+}
+
+TEST_F(LoggerTest, RingsOfFinishedThreadsAreReused) {
+    // one at a time, every thread can take the ring the previous one gave back
+    for (int t = 0; t < 4; ++t)
+        std::thread([t] { Log()->Write(LogLevel::Info, "short-lived ", t, ";"); }).join();
+    const std::size_t rings = Log()->GetRingCount();
+
+    for (int t = 4; t < 20; ++t)
+        std::thread([t] { Log()->Write(LogLevel::Info, "short-lived ", t, ";"); }).join();
+    EXPECT_EQ(Log()->GetRingCount(), rings);
+
+    const std::string out = Flushed();
+    for (int t = 0; t < 20; ++t)
+        EXPECT_NE(out.find("short-lived " + std::to_string(t) + ";"), std::string::npos) << t;
+}
+
+TEST_F(LoggerTest, LongMessagesAreTruncated) {
+    Log()->Write(LogLevel::Info, std::string(LogRecord::kMaxMessageLength + 100, 'x'));
+    const std::string out = Flushed();
+    EXPECT_NE(out.find(std::string(LogRecord::kMaxMessageLength, 'x')), std::string::npos);
+    EXPECT_EQ(out.find(std::string(LogRecord::kMaxMessageLength + 1, 'x')), std::string::npos);
+}
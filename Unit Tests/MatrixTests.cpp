@@ -0,0 +1,160 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: MatrixTests
+* Description:
+*       Tests for Mat3f and Mat4f, checked against element-by-element reference products
+*       and against Affine2f, plus the batch point transforms.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#include <gtest/gtest.h>
+#include <Core/Math/Matrix.h>
+
+namespace {
+
+/// @brief  odd enough to exercise both the SIMD body and the scalar remainder
+constexpr std::size_t kCount = 11;
+
+template <typename Matrix, std::size_t N>
+Matrix ReferenceProduct(Matrix const& a, Matrix const& b)
+{
+    Matrix out;
+    for (std::size_t row = 0; row < N; ++row)
+        for (std::size_t col = 0; col < N; ++col)
+        {
+            float sum = 0.0f;
+            for (std::size_t k = 0; k < N; ++k)
+                sum += a(row, k) * b(k, col);
+            out(row, col) = sum;
+        }
+    return out;
+}
+
+Mat4f MakeTransform(float f)
+{
+    return Mat4f::FromTRS({ f, -2.0f * f, 3.0f }, { 10.0f * f, -25.0f, 40.0f + f }, { 1.0f + f, 2.0f, 0.5f });
+}
+
+} // namespace
+
+TEST(MatrixTests, DefaultIsIdentity)
+{
+    const Mat4f m;
+    for (std::size_t row = 0; row < 4; ++row)
+        for (std::size_t col = 0; col < 4; ++col)
+            EXPECT_EQ(m(row, col), row == col ? 1.0f : 0.0f);
+    EXPECT_TRUE(Mat3f().AlmostEqual(Mat3f::FromAffine(Affine2f::Identity())));
+}
+
+TEST(MatrixTests, Mat3MatchesAffine2)
+{
+    const Affine2f parent = Affine2f::FromTRS({ 5.0f, -1.0f }, 30.0f, { 2.0f, 3.0f });
+    const Affine2f local = Affine2f::FromTRS({ 1.0f, 4.0f }, -75.0f, { 0.5f, 1.0f });
+
+    const Mat3f product = Mat3f::FromAffine(parent) * Mat3f::FromAffine(local);
+    EXPECT_TRUE(product.ToAffine().AlmostEqual(parent * local, 1e-5f));
+    EXPECT_TRUE(Mat3f::FromTRS({ 5.0f, -1.0f }, 30.0f, { 2.0f, 3.0f }).ToAffine().AlmostEqual(parent));
+
+    const Vec2f point{ 3.0f, -7.0f };
+    EXPECT_TRUE(product.TransformPoint(point).AlmostEqual((parent * local).TransformPoint(point), 1e-4f));
+    EXPECT_TRUE(product.TransformVector(point).AlmostEqual((parent * local).TransformVector(point), 1e-4f));
+}
+
+TEST(MatrixTests, ProductsMatchReference)
+{
+    const Mat3f a({ 1.0f, 2.0f, 3.0f }, { -4.0f, 5.0f, 0.5f }, { 7.0f, -1.0f, 2.0f });
+    const Mat3f b({ 0.0f, 1.0f, -2.0f }, { 3.0f, 0.0f, 1.0f }, { 2.0f, 2.0f, 6.0f });
+    EXPECT_TRUE((a * b).AlmostEqual(ReferenceProduct<Mat3f, 3>(a, b)));
+
+    const Mat4f c = MakeTransform(1.0f);
+    const Mat4f d = MakeTransform(2.0f).Transposed();
+    EXPECT_TRUE((c * d).AlmostEqual(ReferenceProduct<Mat4f, 4>(c, d), 1e-4f));
+    EXPECT_TRUE(((c * d) * c).AlmostEqual(c * (d * c), 1e-3f));
+}
+
+TEST(MatrixTests, FromTRSAppliesScaleThenRotationThenTranslation)
+{
+    const Mat4f m = Mat4f::FromTRS({ 10.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 90.0f }, { 2.0f, 2.0f, 2.0f });
+    EXPECT_TRUE(m.TransformPoint({ 1.0f, 0.0f, 0.0f }).AlmostEqual(Vec3f{ 10.0f, 2.0f, 0.0f }, 1e-5f));
+    EXPECT_TRUE(m.TransformVector({ 0.0f, 1.0f, 0.0f }).AlmostEqual(Vec3f{ -2.0f, 0.0f, 0.0f }, 1e-5f));
+
+    // right-handed rotations about x and y
+    EXPECT_TRUE(Mat4f::RotationX(90.0f).TransformVector({ 0.0f, 1.0f, 0.0f }).AlmostEqual(Vec3f{ 0.0f, 0.0f, 1.0f }, 1e-5f));
+    EXPECT_TRUE(Mat4f::RotationY(90.0f).TransformVector({ 0.0f, 0.0f, 1.0f }).AlmostEqual(Vec3f{ 1.0f, 0.0f, 0.0f }, 1e-5f));
+
+    // a 2D transform embedded in 3D acts on the xy plane only
+    const Affine2f flat = Affine2f::FromTRS({ 1.0f, 2.0f }, 45.0f, { 3.0f, 1.0f });
+    const Vec2f expected = flat.TransformPoint({ 1.0f, 1.0f });
+    EXPECT_TRUE(Mat4f::FromAffine(flat).TransformPoint({ 1.0f, 1.0f, 5.0f }).AlmostEqual(Vec3f{ expected.x(), expected.y(), 5.0f }, 1e-5f));
+}
+
+TEST(MatrixTests, Determinants)
+{
+    EXPECT_NEAR(Mat3f::FromTRS({ 4.0f, 4.0f }, 60.0f, { 2.0f, 3.0f }).Determinant(), 6.0f, 1e-4f);
+    EXPECT_NEAR(MakeTransform(1.0f).Determinant(), 2.0f * 2.0f * 0.5f, 1e-4f);
+
+    const Mat4f singular({ 1.0f, 2.0f, 3.0f, 4.0f }, { 2.0f, 4.0f, 6.0f, 8.0f },
+                         { 0.0f, 1.0f, 0.0f, 1.0f }, { 1.0f, 0.0f, 0.0f, 0.0f });
+    EXPECT_NEAR(singular.Determinant(), 0.0f, 1e-5f);
+}
+
+TEST(MatrixTests, InverseUndoesTheMatrix)
+{
+    const Mat3f a({ 2.0f, 0.5f, 1.0f }, { -1.0f, 3.0f, 0.0f }, { 4.0f, 1.0f, 5.0f });
+    EXPECT_TRUE((a * a.Inverse()).AlmostEqual(Mat3f::Identity(), 1e-5f));
+    EXPECT_TRUE((a.Inverse() * a).AlmostEqual(Mat3f::Identity(), 1e-5f));
+
+    // a general matrix, not just a rigid transform, so every block of the inverse matters
+    const Mat4f b({ 2.0f, 1.0f, 0.0f, 3.0f }, { -1.0f, 4.0f, 2.0f, 0.0f },
+                  { 0.5f, 0.0f, 3.0f, 1.0f }, { 1.0f, 2.0f, -1.0f, 5.0f });
+    EXPECT_TRUE((b * b.Inverse()).AlmostEqual(Mat4f::Identity(), 1e-5f));
+    EXPECT_TRUE((b.Inverse() * b).AlmostEqual(Mat4f::Identity(), 1e-5f));
+
+    const Mat4f c = MakeTransform(3.0f);
+    const Vec3f point{ 1.0f, -2.0f, 4.0f };
+    EXPECT_TRUE(c.Inverse().TransformPoint(c.TransformPoint(point)).AlmostEqual(point, 1e-4f));
+}
+
+TEST(MatrixTests, BatchTransformMatchesSinglePoints)
+{
+    const Mat3f m3 = Mat3f::FromTRS({ 5.0f, -3.0f }, 20.0f, { 2.0f, 0.5f });
+    const Mat4f m4 = MakeTransform(0.5f);
+
+    Vec2fSoA points2;
+    Vec3fSoA points3;
+    for (std::size_t i = 0; i < kCount; ++i)
+    {
+        const float f = static_cast<float>(i);
+        points2.PushBack({ f, 1.0f - f });
+        points3.PushBack({ f, 2.0f * f, -f });
+    }
+
+    Vec2fSoA out2(kCount);
+    Vec3fSoA out3(kCount);
+    TransformPointsBatch(m3, points2, out2);
+    TransformPointsBatch(m4, points3, out3);
+    for (std::size_t i = 0; i < kCount; ++i)
+    {
+        EXPECT_TRUE(out2.Get(i).AlmostEqual(m3.TransformPoint(points2.Get(i)), 1e-4f)) << "index " << i;
+        EXPECT_TRUE(out3.Get(i).AlmostEqual(m4.TransformPoint(points3.Get(i)), 1e-4f)) << "index " << i;
+    }
+}
+
+TEST(MatrixTests, BatchTransformInPlaceOverARange)
+{
+    const Mat3f m = Mat3f::FromTRS({ 1.0f, 1.0f }, 0.0f, { 1.0f, 1.0f });
+
+    Vec2fSoA points;
+    for (std::size_t i = 0; i < kCount; ++i)
+        points.PushBack({ static_cast<float>(i), 0.0f });
+
+    TransformPointsBatch(m, points, points, 2, 9);
+    for (std::size_t i = 0; i < kCount; ++i)
+    {
+        const float moved = (i >= 2 && i < 9) ? 1.0f : 0.0f;
+        EXPECT_TRUE(points.Get(i).AlmostEqual(Vec2f{ static_cast<float>(i) + moved, moved }, 1e-6f)) << "index " << i;
+    }
+}
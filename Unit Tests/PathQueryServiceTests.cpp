@@ -0,0 +1,211 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: PathQueryServiceTests
+* Description:
+*       Tests for the path query service: results matching FindPath, collapsed duplicate
+*       requests, budgeted slicing across frames, priorities and handle lifetimes.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#include <Systems/Pathfinding/PathQueryService.h>
+#include "PathTestUtils.h"
+
+namespace {
+
+/// @brief  runs frames until nothing is left to search, returning how many it took
+int RunUntilIdle(PathQueryService& service, int maxFrames = 1000)
+{
+    int frames = 0;
+    do
+    {
+        service.Update();
+        ++frames;
+    } while ((service.GetActiveCount() != 0 || service.GetWaitingCount() != 0) && frames < maxFrames);
+    return frames;
+}
+
+} // namespace
+
+TEST(PathQueryServiceTests, ResultsMatchFindPath)
+{
+    const PathGrid grid(MakeRandomGrid(96, 64, 25, 0, 3));
+    PathQueryService service(grid);
+
+    std::mt19937 rng(5);
+    std::vector<PathHandle> handles;
+    std::vector<std::pair<Vec2i, Vec2i>> queries;
+    for (int i = 0; i < 60; ++i)
+    {
+        queries.emplace_back(RandomOpenCell(grid, rng), RandomOpenCell(grid, rng));
+        handles.push_back(service.Request(queries.back().first, queries.back().second));
+        EXPECT_EQ(service.GetStatus(handles.back()), PathStatus::Searching);
+    }
+    RunUntilIdle(service);
+
+    std::vector<Vec2i> expectedPath, path;
+    for (std::size_t i = 0; i < handles.size(); ++i)
+    {
+        const PathResult expected = FindPath(grid, queries[i].first, queries[i].second, expectedPath);
+        const PathResult result = service.GetResult(handles[i]);
+        EXPECT_EQ(result.m_Status, expected.m_Status) << "query " << i;
+        EXPECT_EQ(result.m_Cost, expected.m_Cost) << "query " << i;
+        EXPECT_EQ(service.GetPath(handles[i], path), expected.IsFound());
+        if (expected.IsFound())
+        {
+            EXPECT_EQ(path, expectedPath) << "query " << i;
+        }
+        service.Release(handles[i]);
+    }
+}
+
+TEST(PathQueryServiceTests, IdenticalRequestsInOneFrameShareASearch)
+{
+    const PathGrid grid(GridSystem::Grid(30, 30));
+    PathQueryService service(grid);
+
+    const PathHandle a = service.Request({ 1, 1 }, { 28, 20 });
+    const PathHandle b = service.Request({ 1, 1 }, { 28, 20 }, 5);
+    const PathHandle c = service.Request({ 1, 1 }, { 28, 20 });
+    const PathHandle other = service.Request({ 1, 1 }, { 28, 20 }, 0, { PathAlgorithm::JumpPoint });
+    service.Update();
+    EXPECT_EQ(service.GetCollapsedCount(), 2u);
+
+    std::vector<Vec2i> pathA, pathB, pathOther;
+    ASSERT_TRUE(service.GetPath(a, pathA));
+    ASSERT_TRUE(service.GetPath(b, pathB));
+    EXPECT_EQ(pathA, pathB);
+    EXPECT_TRUE(service.GetPath(other, pathOther));
+
+    // the shared result outlives any one of its handles
+    service.Release(a);
+    EXPECT_EQ(service.GetStatus(a), PathStatus::Invalid);
+    EXPECT_TRUE(service.GetResult(c).IsFound());
+
+    // requests in a later frame search again
+    const PathHandle later = service.Request({ 1, 1 }, { 28, 20 });
+    service.Update();
+    EXPECT_EQ(service.GetCollapsedCount(), 2u);
+    EXPECT_TRUE(service.GetResult(later).IsFound());
+}
+
+TEST(PathQueryServiceTests, LongSearchesAreSlicedAcrossFrames)
+{
+    // a serpentine forces a search through most of the map
+    GridSystem::Grid map(64, 64);
+    for (int x = 4; x < 64; x += 8)
+        for (int y = 0; y < 63; ++y)
+            map.SetCell(x, (x / 8) % 2 == 0 ? y : y + 1, '#');
+    const PathGrid grid(map);
+
+    PathQueryService service(grid);
+    service.SetFrameBudget(300);
+    service.SetSliceExpansions(200);
+
+    const PathHandle first = service.Request({ 0, 0 }, { 63, 63 });
+    const PathHandle second = service.Request({ 0, 63 }, { 63, 0 });
+    service.Update();
+    EXPECT_EQ(service.GetStatus(first), PathStatus::Searching);
+    EXPECT_EQ(service.GetLastFrameExpansions(), 300u);
+
+    uint32_t mostInOneFrame = 0;
+    int frames = 1;
+    while (service.GetActiveCount() != 0 && frames < 1000)
+    {
+        service.Update();
+        mostInOneFrame = (std::max)(mostInOneFrame, service.GetLastFrameExpansions());
+        ++frames;
+    }
+    EXPECT_LE(mostInOneFrame, 300u);
+    EXPECT_GT(frames, 10);
+
+    std::vector<Vec2i> expectedPath;
+    EXPECT_EQ(service.GetResult(first).m_Cost, FindPath(grid, { 0, 0 }, { 63, 63 }, expectedPath).m_Cost);
+    EXPECT_EQ(service.GetResult(second).m_Cost, FindPath(grid, { 0, 63 }, { 63, 0 }, expectedPath).m_Cost);
+}
+
+TEST(PathQueryServiceTests, HigherPrioritiesAreSearchedFirst)
+{
+    const PathGrid grid(GridSystem::Grid(40, 40));
+    PathQueryService service(grid);
+    service.SetMaxActiveSearches(1);
+
+    const PathHandle low = service.Request({ 0, 0 }, { 39, 39 }, 0);
+    const PathHandle high = service.Request({ 39, 0 }, { 0, 39 }, 10);
+    const PathHandle middle = service.Request({ 0, 39 }, { 39, 0 }, 5);
+
+    service.Update();
+    EXPECT_TRUE(service.GetResult(high).IsFound());
+    EXPECT_EQ(service.GetStatus(middle), PathStatus::Searching);
+    EXPECT_EQ(service.GetStatus(low), PathStatus::Searching);
+
+    service.Update();
+    EXPECT_TRUE(service.GetResult(middle).IsFound());
+    EXPECT_EQ(service.GetStatus(low), PathStatus::Searching);
+
+    service.Update();
+    EXPECT_TRUE(service.GetResult(low).IsFound());
+}
+
+TEST(PathQueryServiceTests, ReleasedRequestsAreDropped)
+{
+    const PathGrid grid(GridSystem::Grid(64, 64));
+    PathQueryService service(grid);
+    service.SetSliceExpansions(10);
+
+    EXPECT_EQ(service.GetStatus(PathHandle{}), PathStatus::Invalid);
+
+    // released before the first Update
+    const PathHandle early = service.Request({ 0, 0 }, { 63, 63 });
+    service.Release(early);
+    service.Update();
+    EXPECT_EQ(service.GetActiveCount(), 0u);
+
+    // released mid-search
+    const PathHandle running = service.Request({ 0, 0 }, { 63, 63 });
+    service.Update();
+    EXPECT_EQ(service.GetActiveCount(), 1u);
+    service.Release(running);
+    service.Update();
+    EXPECT_EQ(service.GetActiveCount(), 0u);
+    EXPECT_EQ(service.GetStatus(running), PathStatus::Invalid);
+
+    // a reused slot does not answer to the old handle
+    const PathHandle reused = service.Request({ 1, 1 }, { 2, 2 });
+    EXPECT_EQ(reused.m_Index, running.m_Index);
+    EXPECT_NE(reused, running);
+    service.Update();
+    EXPECT_TRUE(service.GetResult(reused).IsFound());
+    EXPECT_EQ(service.GetStatus(running), PathStatus::Invalid);
+
+    service.Clear();
+    EXPECT_EQ(service.GetStatus(reused), PathStatus::Invalid);
+}
+
+TEST(PathQueryServiceTests, AcceptsRequestsFromManyThreads)
+{
+    const PathGrid grid(MakeRandomGrid(64, 64, 20, 0, 11));
+    PathQueryService service(grid);
+
+    constexpr int kThreads = 4;
+    constexpr int kPerThread = 100;
+    std::vector<std::vector<PathHandle>> handles(kThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t)
+    {
+        threads.emplace_back([&, t] {
+            std::mt19937 rng(t + 1);
+            for (int i = 0; i < kPerThread; ++i)
+                handles[t].push_back(service.Request(RandomOpenCell(grid, rng), RandomOpenCell(grid, rng), i % 3));
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    RunUntilIdle(service);
+    for (auto const& list : handles)
+        for (PathHandle handle : list)
+            EXPECT_NE(service.GetStatus(handle), PathStatus::Searching);
+}
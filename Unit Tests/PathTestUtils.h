@@ -0,0 +1,102 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: PathTestUtils
+* Description:
+*       Maps, cell pickers, a path checker and a GridSystem fixture shared by the
+*       pathfinding tests.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#ifndef PATHTESTUTILS_H
+#define PATHTESTUTILS_H
+
+#include <gtest/gtest.h>
+#include <Systems/Pathfinding/Pathfinder.h>
+#include <Core/Events/EventBus.h>
+
+/// @brief  builds a Grid from rows of cell characters
+inline GridSystem::Grid MakeGrid(std::vector<std::string> const& rows)
+{
+    GridSystem::Grid grid(static_cast<int>(rows[0].size()), static_cast<int>(rows.size()));
+    for (int y = 0; y < static_cast<int>(rows.size()); ++y)
+        for (int x = 0; x < static_cast<int>(rows[y].size()); ++x)
+            grid.SetCell(x, y, rows[y][x]);
+    return grid;
+}
+
+/// @brief  a map of '#' walls, '~' water and '.' floor in the given proportions
+inline GridSystem::Grid MakeRandomGrid(int width, int height, int wallPercent, int waterPercent, uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    GridSystem::Grid grid(width, height);
+    for (char& cell : grid.cells)
+    {
+        const int roll = static_cast<int>(rng() % 100);
+        cell = roll < wallPercent ? '#' : roll < wallPercent + waterPercent ? '~' : '.';
+    }
+    return grid;
+}
+
+/// @brief  the default costs with '~' walkable at the given cost
+inline TerrainCosts WaterTerrain(uint8_t waterCost)
+{
+    TerrainCosts terrain = TerrainCosts::Default();
+    terrain.Set('~', waterCost);
+    return terrain;
+}
+
+inline Vec2i RandomOpenCell(PathGrid const& grid, std::mt19937& rng)
+{
+    for (;;)
+    {
+        const Vec2i cell{ static_cast<int>(rng() % grid.GetWidth()), static_cast<int>(rng() % grid.GetHeight()) };
+        if (grid.IsWalkable(cell))
+            return cell;
+    }
+}
+
+/// @brief  checks every step is to a walkable neighbour without cutting a corner, and
+///         returns the summed cost
+inline uint32_t WalkPath(PathGrid const& grid, std::vector<Vec2i> const& path)
+{
+    uint32_t cost = 0;
+    for (std::size_t i = 1; i < path.size(); ++i)
+    {
+        const int dx = path[i].x() - path[i - 1].x();
+        const int dy = path[i].y() - path[i - 1].y();
+        EXPECT_TRUE(std::abs(dx) <= 1 && std::abs(dy) <= 1 && (dx != 0 || dy != 0)) << "step " << i;
+        EXPECT_TRUE(grid.IsWalkable(path[i])) << "step " << i;
+        const bool diagonal = dx != 0 && dy != 0;
+        if (diagonal)
+        {
+            EXPECT_TRUE(grid.IsWalkable(path[i - 1].x() + dx, path[i - 1].y())) << "step " << i;
+            EXPECT_TRUE(grid.IsWalkable(path[i - 1].x(), path[i - 1].y() + dy)) << "step " << i;
+        }
+        cost += (diagonal ? kDiagonalStepCost : kStraightStepCost) * grid.GetCost(path[i]);
+    }
+    return cost;
+}
+
+/// @brief  starts and ends each test with no maps, delivering any CellChanged still
+///         queued before the maps go away
+class PathGridSystemTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        gs = GridSystem::GetInstance();
+        gs->ClearMaps();
+    }
+
+    void TearDown() override
+    {
+        Events()->Dispatch();
+        gs->ClearMaps();
+    }
+
+    std::shared_ptr<GridSystem> gs;
+};
+
+#endif //PATHTESTUTILS_H
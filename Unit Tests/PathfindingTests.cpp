@@ -0,0 +1,231 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: PathfindingTests
+* Description:
+*       Tests for PathGrid and the A* and jump point pathfinders, including checks that
+*       jump point search finds paths as short as A* on random maps.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#include "PathTestUtils.h"
+
+TEST(PathGridTests, ReadsCostsThroughTheTerrainTable)
+{
+    TerrainCosts terrain = TerrainCosts::Default();
+    terrain.Set('~', 4);
+    const PathGrid grid(MakeGrid({ ".#~", "D .", }), terrain);
+
+    EXPECT_EQ(grid.GetWidth(), 3);
+    EXPECT_EQ(grid.GetHeight(), 2);
+    EXPECT_EQ(grid.GetCost(0, 0), 1);
+    EXPECT_FALSE(grid.IsWalkable(1, 0));
+    EXPECT_EQ(grid.GetCost(2, 0), 4);
+    EXPECT_FALSE(grid.IsWalkable(1, 1));
+    EXPECT_FALSE(grid.IsWalkable(-1, 0));
+    EXPECT_FALSE(grid.IsUniform());
+    EXPECT_EQ(grid.CellOf(grid.IndexOf(2, 1)), (Vec2i{ 2, 1 }));
+}
+
+TEST(PathGridTests, SetCellReportsRealChanges)
+{
+    PathGrid grid(MakeGrid({ "...", "..." }));
+    EXPECT_TRUE(grid.IsUniform());
+    EXPECT_FALSE(grid.SetCell(1, 1, 'D'));
+    EXPECT_TRUE(grid.SetCell(1, 1, '#'));
+    EXPECT_FALSE(grid.IsWalkable(1, 1));
+    EXPECT_FALSE(grid.SetCell(5, 5, '#'));
+
+    EXPECT_TRUE(grid.SetCost(0, 0, 3));
+    EXPECT_FALSE(grid.IsUniform());
+    EXPECT_TRUE(grid.SetCost(0, 0, 1));
+    EXPECT_TRUE(grid.IsUniform());
+}
+
+TEST(PathfinderTests, FindsTheShortestPathAroundWalls)
+{
+    const PathGrid grid(MakeGrid({
+        ".....",
+        ".###.",
+        ".#...",
+        ".#.#.",
+        "...#.",
+    }));
+
+    std::vector<Vec2i> path;
+    const PathResult result = FindPath(grid, { 2, 2 }, { 0, 0 }, path);
+    ASSERT_TRUE(result.IsFound());
+    EXPECT_EQ(path.front(), (Vec2i{ 2, 2 }));
+    EXPECT_EQ(path.back(), (Vec2i{ 0, 0 }));
+    EXPECT_EQ(WalkPath(grid, path), result.m_Cost);
+
+    // both ways around take eight straight steps, since the corner rule rules out every
+    // diagonal along them
+    EXPECT_EQ(result.m_Cost, 8 * kStraightStepCost);
+}
+
+TEST(PathfinderTests, StartEqualsGoal)
+{
+    const PathGrid grid(MakeGrid({ "..." }));
+    std::vector<Vec2i> path;
+    const PathResult result = FindPath(grid, { 1, 0 }, { 1, 0 }, path);
+    EXPECT_TRUE(result.IsFound());
+    EXPECT_EQ(result.m_Cost, 0u);
+    EXPECT_EQ(path, (std::vector<Vec2i>{ { 1, 0 } }));
+}
+
+TEST(PathfinderTests, ReportsInvalidEndpointsAndMissingPaths)
+{
+    const PathGrid grid(MakeGrid({ ".#.", ".#.", ".#." }));
+    std::vector<Vec2i> path{ { 9, 9 } };
+
+    EXPECT_EQ(FindPath(grid, { 0, 0 }, { 1, 1 }, path).m_Status, PathStatus::Invalid);
+    EXPECT_EQ(FindPath(grid, { -1, 0 }, { 0, 0 }, path).m_Status, PathStatus::Invalid);
+    EXPECT_EQ(FindPath(grid, { 0, 0 }, { 2, 2 }, path).m_Status, PathStatus::NoPath);
+    EXPECT_TRUE(path.empty());
+
+    PathOptions jps;
+    jps.m_Algorithm = PathAlgorithm::JumpPoint;
+    EXPECT_EQ(FindPath(grid, { 0, 0 }, { 2, 2 }, path, jps).m_Status, PathStatus::NoPath);
+}
+
+TEST(PathfinderTests, NeverCutsCorners)
+{
+    const PathGrid grid(MakeGrid({
+        ".#",
+        "..",
+    }));
+
+    for (PathAlgorithm algorithm : { PathAlgorithm::AStar, PathAlgorithm::JumpPoint })
+    {
+        PathOptions options;
+        options.m_Algorithm = algorithm;
+        std::vector<Vec2i> path;
+        const PathResult result = FindPath(grid, { 0, 0 }, { 1, 1 }, path, options);
+        ASSERT_TRUE(result.IsFound());
+        EXPECT_EQ(result.m_Cost, 2 * kStraightStepCost);
+        EXPECT_EQ(path.size(), 3u);
+    }
+}
+
+TEST(PathfinderTests, WeightedCellsAreAvoidedWhenCheaper)
+{
+    TerrainCosts terrain = TerrainCosts::Default();
+    terrain.Set('~', 5);
+    const PathGrid grid(MakeGrid({
+        ".~.",
+        ".~.",
+        "...",
+    }), terrain);
+
+    std::vector<Vec2i> path;
+    const PathResult result = FindPath(grid, { 0, 0 }, { 2, 0 }, path);
+    ASSERT_TRUE(result.IsFound());
+    EXPECT_EQ(result.m_Cost, WalkPath(grid, path));
+    EXPECT_EQ(result.m_Cost, 2 * kStraightStepCost + 2 * kDiagonalStepCost);
+
+    // jump point search needs uniform costs and falls back to A*
+    PathOptions jps;
+    jps.m_Algorithm = PathAlgorithm::JumpPoint;
+    EXPECT_EQ(FindPath(grid, { 0, 0 }, { 2, 0 }, path, jps).m_Cost, result.m_Cost);
+}
+
+TEST(PathfinderTests, FourWayMovement)
+{
+    const PathGrid grid(MakeGrid({ "....", "....", "...." }));
+    PathOptions options;
+    options.m_AllowDiagonal = false;
+    options.m_Heuristic = Heuristic::Manhattan;
+
+    std::vector<Vec2i> path;
+    const PathResult result = FindPath(grid, { 0, 0 }, { 3, 2 }, path, options);
+    ASSERT_TRUE(result.IsFound());
+    EXPECT_EQ(result.m_Cost, 5 * kStraightStepCost);
+    EXPECT_EQ(path.size(), 6u);
+}
+
+TEST(PathfinderTests, AdmissibleHeuristicsAgreeOnCost)
+{
+    const PathGrid grid(MakeRandomGrid(64, 64, 25, 0, 7));
+    std::mt19937 rng(11);
+
+    for (int query = 0; query < 50; ++query)
+    {
+        const Vec2i start{ static_cast<int>(rng() % 64), static_cast<int>(rng() % 64) };
+        const Vec2i goal{ static_cast<int>(rng() % 64), static_cast<int>(rng() % 64) };
+
+        std::vector<Vec2i> path;
+        PathOptions options;
+        options.m_Heuristic = Heuristic::None;
+        const PathResult reference = FindPath(grid, start, goal, path, options);
+
+        for (Heuristic heuristic : { Heuristic::Octile, Heuristic::Chebyshev, Heuristic::Euclidean })
+        {
+            options.m_Heuristic = heuristic;
+            const PathResult result = FindPath(grid, start, goal, path, options);
+            ASSERT_EQ(result.m_Status, reference.m_Status) << "query " << query;
+            EXPECT_EQ(result.m_Cost, reference.m_Cost) << "query " << query;
+            EXPECT_LE(result.m_Expanded, reference.m_Expanded) << "query " << query;
+        }
+    }
+}
+
+TEST(PathfinderTests, JumpPointSearchMatchesAStar)
+{
+    for (uint32_t seed = 1; seed <= 4; ++seed)
+    {
+        const PathGrid grid(MakeRandomGrid(96, 80, 10 + 8 * static_cast<int>(seed), 0, seed));
+        std::mt19937 rng(seed * 31);
+
+        PathOptions jps;
+        jps.m_Algorithm = PathAlgorithm::JumpPoint;
+
+        std::vector<Vec2i> aStarPath;
+        std::vector<Vec2i> jpsPath;
+        for (int query = 0; query < 100; ++query)
+        {
+            const Vec2i start{ static_cast<int>(rng() % 96), static_cast<int>(rng() % 80) };
+            const Vec2i goal{ static_cast<int>(rng() % 96), static_cast<int>(rng() % 80) };
+
+            const PathResult expected = FindPath(grid, start, goal, aStarPath);
+            const PathResult result = FindPath(grid, start, goal, jpsPath, jps);
+            ASSERT_EQ(result.m_Status, expected.m_Status) << "seed " << seed << " query " << query;
+            if (!result.IsFound())
+                continue;
+
+            EXPECT_EQ(result.m_Cost, expected.m_Cost) << "seed " << seed << " query " << query;
+            EXPECT_EQ(jpsPath.front(), start);
+            EXPECT_EQ(jpsPath.back(), goal);
+            EXPECT_EQ(WalkPath(grid, jpsPath), result.m_Cost) << "seed " << seed << " query " << query;
+        }
+    }
+}
+
+TEST(PathfinderTests, SlicedSearchMatchesOneShot)
+{
+    const PathGrid grid(MakeRandomGrid(48, 48, 20, 0, 3));
+    std::vector<Vec2i> expectedPath;
+    const PathResult expected = FindPath(grid, { 1, 1 }, { 46, 45 }, expectedPath);
+
+    // its own buffers, so the one-shot queries above and below do not disturb it
+    SearchBuffers buffers;
+    PathSearch search(buffers);
+    ASSERT_EQ(search.Start(grid, { 1, 1 }, { 46, 45 }), PathStatus::Searching);
+
+    int slices = 0;
+    while (search.Step(16) == PathStatus::Searching)
+    {
+        std::vector<Vec2i> unrelated;
+        FindPath(grid, { 0, 0 }, { 5, 5 }, unrelated);
+        ++slices;
+    }
+    EXPECT_GT(slices, 1);
+
+    std::vector<Vec2i> path;
+    search.ExtractPath(path);
+    EXPECT_EQ(search.GetStatus(), expected.m_Status);
+    EXPECT_EQ(search.GetResult().m_Cost, expected.m_Cost);
+    EXPECT_EQ(path, expectedPath);
+}
@@ -0,0 +1,106 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: PoolAllocatorTests
+* Description:
+*       Tests for the slab-backed PoolAllocator and the pooled Entity / Component storage.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#include <gtest/gtest.h>
+#include <Core/Memory/PoolAllocator.h>
+#include <Core/ECS/Entity/Entity.h>
+#include <Core/ECS/Component/Component.h>
+
+namespace {
+
+class PooledTestComponent final : public Component {
+public:
+    PooledTestComponent() : Component(typeid(PooledTestComponent)) {}
+    Component* Clone() const override { return new PooledTestComponent(*this); }
+
+    double m_Payload[5] = {};
+};
+
+} // namespace
+
+TEST(PoolAllocatorTests, FreedBlocksAreReused) {
+    PoolAllocator pool(24, 8);
+    void* a = pool.Allocate();
+    void* b = pool.Allocate();
+    EXPECT_NE(a, b);
+    EXPECT_EQ(pool.GetLiveCount(), 2u);
+
+    pool.Deallocate(a);
+    EXPECT_EQ(pool.GetLiveCount(), 1u);
+    EXPECT_EQ(pool.Allocate(), a);
+
+    pool.Deallocate(a);
+    pool.Deallocate(b);
+    EXPECT_EQ(pool.GetLiveCount(), 0u);
+    EXPECT_EQ(pool.GetSlabCount(), 1u);
+}
+
+TEST(PoolAllocatorTests, BlocksAreAlignedAndSized) {
+    PoolAllocator pool(3);
+    EXPECT_GE(pool.GetBlockSize(), sizeof(void*));
+    EXPECT_EQ(pool.GetBlockSize() % alignof(std::max_align_t), 0u);
+
+    void* block = pool.Allocate();
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(block) % alignof(std::max_align_t), 0u);
+    pool.Deallocate(block);
+}
+
+TEST(PoolAllocatorTests, BatchAllocationIsContiguous) {
+    PoolAllocator pool(32, 4);
+    std::vector<void*> blocks(100);
+    pool.AllocateBatch(blocks.size(), blocks.data());
+
+    for (std::size_t i = 1; i < blocks.size(); ++i)
+        EXPECT_EQ(static_cast<std::byte*>(blocks[i]) - static_cast<std::byte*>(blocks[i - 1]),
+                  static_cast<std::ptrdiff_t>(pool.GetBlockSize()));
+    EXPECT_EQ(pool.GetLiveCount(), blocks.size());
+
+    pool.DeallocateBatch(blocks.data(), blocks.size());
+    EXPECT_EQ(pool.GetLiveCount(), 0u);
+
+    // batch release keeps the original order for the next allocations
+    EXPECT_EQ(pool.Allocate(), blocks[0]);
+    EXPECT_EQ(pool.Allocate(), blocks[1]);
+}
+
+TEST(PoolAllocatorTests, LargeSizesBypassThePools) {
+    EXPECT_EQ(Pools()->GetPool(ObjectPools::kMaxPooledSize + 1), nullptr);
+    void* block = Pools()->Allocate(ObjectPools::kMaxPooledSize + 1);
+    ASSERT_NE(block, nullptr);
+    Pools()->Deallocate(block, ObjectPools::kMaxPooledSize + 1);
+}
+
+TEST(PoolAllocatorTests, EntitiesComeFromTheEntityPool) {
+    PoolAllocator* pool = Pools()->GetPool(sizeof(Entity));
+    ASSERT_NE(pool, nullptr);
+    const std::size_t liveBefore = pool->GetLiveCount();
+
+    auto* e = new Entity();
+    EXPECT_EQ(pool->GetLiveCount(), liveBefore + 1);
+    delete e;
+    EXPECT_EQ(pool->GetLiveCount(), liveBefore);
+}
+
+TEST(PoolAllocatorTests, ComponentsUseTheirSizeClass) {
+    PoolAllocator* pool = Pools()->GetPool(sizeof(PooledTestComponent));
+    ASSERT_NE(pool, nullptr);
+    const std::size_t liveBefore = pool->GetLiveCount();
+
+    {
+        Entity e;
+        e.AddComponent(new PooledTestComponent());
+        Entity* clone = e.Clone();
+        EXPECT_EQ(pool->GetLiveCount(), liveBefore + 2);
+        delete clone;
+    }
+
+    EXPECT_EQ(pool->GetLiveCount(), liveBefore);
+}
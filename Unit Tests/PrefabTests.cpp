@@ -0,0 +1,155 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: PrefabTests
+* Description:
+*       Tests for compiled Prefab templates and their bulk instantiation.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#include <gtest/gtest.h>
+#include <Core/ECS/Prefab/Prefab.h>
+#include <Core/ECS/Query/Query.h>
+
+namespace {
+
+class Health final : public Component {
+public:
+    Health() : Component(typeid(Health)) {}
+    Component* Clone() const override { ++cloneCount; return new Health(*this); }
+    int value = 100;
+    inline static int cloneCount = 0;
+};
+
+class Weapon final : public Component {
+public:
+    Weapon() : Component(typeid(Weapon)) {}
+    Component* Clone() const override { return new Weapon(*this); }
+    int damage = 5;
+};
+
+Prefab MakeSoldier()
+{
+    Prefab prefab;
+    const uint32_t body = prefab.AddNode("Soldier");
+    const uint32_t hand = prefab.AddNode("Hand", body);
+    prefab.AddNode("Helmet", body);
+
+    Health health;
+    health.value = 80;
+    prefab.AddComponent(body, health);
+
+    Weapon sword;
+    sword.damage = 12;
+    prefab.AddComponent(hand, sword);
+    return prefab;
+}
+
+} // namespace
+
+TEST(PrefabTests, InstancesCopyTreeAndComponentData) {
+    const Prefab prefab = MakeSoldier();
+    const std::vector<Entity*> soldiers = prefab.Instantiate(2);
+    ASSERT_EQ(soldiers.size(), 2u);
+
+    for (Entity* soldier : soldiers)
+    {
+        EXPECT_EQ(soldier->GetName(), "Soldier");
+        EXPECT_EQ(soldier->GetParent(), nullptr);
+        EXPECT_EQ(soldier->GetNumDescendants(), 2);
+
+        auto const* health = static_cast<Health const*>(soldier->FindComponent(typeid(Health)));
+        ASSERT_NE(health, nullptr);
+        EXPECT_EQ(health->value, 80);
+        EXPECT_EQ(health->GetEntity(), soldier);
+
+        Entity const* hand = nullptr;
+        for (Entity const* child : soldier->GetChildren())
+            if (child->GetName() == "Hand")
+                hand = child;
+        ASSERT_NE(hand, nullptr);
+        auto const* weapon = static_cast<Weapon const*>(hand->FindComponent(typeid(Weapon)));
+        ASSERT_NE(weapon, nullptr);
+        EXPECT_EQ(weapon->damage, 12);
+        EXPECT_TRUE(hand->IsDescendedFrom(soldier));
+    }
+
+    EXPECT_NE(soldiers[0]->FindComponent(typeid(Health)), soldiers[1]->FindComponent(typeid(Health)));
+    EXPECT_EQ(Health::cloneCount, 0);
+
+    for (Entity* soldier : soldiers)
+        delete soldier;
+}
+
+TEST(PrefabTests, InstancesAreContiguousAndReturnToThePools) {
+    PoolAllocator* entityPool = Pools()->GetPool(sizeof(Entity));
+    PoolAllocator* healthPool = Pools()->GetPool(sizeof(Health));
+    const std::size_t entitiesBefore = entityPool->GetLiveCount();
+    const std::size_t healthBefore = healthPool->GetLiveCount();
+
+    const Prefab prefab = MakeSoldier();
+    std::vector<Entity*> soldiers = prefab.Instantiate(3);
+    EXPECT_EQ(entityPool->GetLiveCount(), entitiesBefore + 9);
+    const std::size_t sharedWithWeapon = Pools()->GetPool(sizeof(Weapon)) == healthPool ? 3 : 0;
+    EXPECT_EQ(healthPool->GetLiveCount(), healthBefore + 3 + sharedWithWeapon);
+
+    // a copy's nodes sit next to each other, parents first
+    auto const* first = reinterpret_cast<std::byte const*>(soldiers[0]);
+    auto const* second = reinterpret_cast<std::byte const*>(soldiers[1]);
+    EXPECT_EQ(static_cast<std::size_t>(second - first), 3 * entityPool->GetBlockSize());
+
+    for (Entity* soldier : soldiers)
+        delete soldier;
+    EXPECT_EQ(entityPool->GetLiveCount(), entitiesBefore);
+    EXPECT_EQ(healthPool->GetLiveCount(), healthBefore);
+}
+
+TEST(PrefabTests, ArmyInstancesAreVisibleToQueries) {
+    Prefab prefab;
+    const uint32_t unit = prefab.AddNode("Unit");
+    prefab.AddComponent(unit, Health());
+    prefab.AddComponent(unit, Weapon());
+
+    auto& query = Query<Health, Weapon>::Get();
+    const std::size_t before = query.Size();
+
+    std::vector<Entity*> army = prefab.Instantiate(10000);
+    EXPECT_EQ(query.Size(), before + 10000);
+
+    for (Entity* soldier : army)
+        delete soldier;
+    EXPECT_EQ(query.Size(), before);
+}
+
+TEST(PrefabTests, InvalidNodesAndDuplicateComponentsAreRejected) {
+    Prefab prefab;
+    std::ostringstream log;
+    Log()->SetSink(&log);
+    EXPECT_EQ(prefab.AddNode("Orphan", 3), Prefab::kInvalidNode);
+    const uint32_t root = prefab.AddNode("Root");
+    EXPECT_EQ(prefab.AddNode("Second Root"), Prefab::kInvalidNode);
+    EXPECT_EQ(prefab.AddNode("Unborn Parent", 5), Prefab::kInvalidNode);
+    Log()->Flush();
+    EXPECT_NE(log.str().find("\"Orphan\" must be the root"), std::string::npos);
+    EXPECT_NE(log.str().find("\"Second Root\" needs a parent"), std::string::npos);
+    EXPECT_NE(log.str().find("no node 5"), std::string::npos);
+    EXPECT_EQ(prefab.GetNodeCount(), 1u);
+    EXPECT_EQ(root, 0u);
+
+    log.str("");
+    prefab.AddComponent(root, Health());
+    prefab.AddComponent(root, Health());
+    prefab.AddComponent(root + 1, Weapon());
+    Log()->Flush();
+    Log()->SetSink(nullptr);
+    EXPECT_NE(log.str().find("WARNING"), std::string::npos);
+    EXPECT_NE(log.str().find("ERROR"), std::string::npos);
+
+    // the rejected Weapon never reaches an instance
+    std::vector<Entity*> copies = prefab.Instantiate(1);
+    ASSERT_EQ(copies.size(), 1u);
+    EXPECT_EQ(copies[0]->FindComponent(typeid(Weapon)), nullptr);
+    delete copies[0];
+}
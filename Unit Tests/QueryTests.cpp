@@ -0,0 +1,147 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: QueryTests
+* Description:
+*       Tests for cached multi-component Queries and the JobSystem ParallelFor they use.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#include <gtest/gtest.h>
+#include <Core/ECS/Query/Query.h>
+#include <Core/Jobs/JobSystem.h>
+
+namespace {
+
+class Position final : public Component {
+public:
+    Position() : Component(typeid(Position)) {}
+    Component* Clone() const override { return new Position(*this); }
+    int value = 0;
+};
+
+class Velocity final : public Component {
+public:
+    Velocity() : Component(typeid(Velocity)) {}
+    Component* Clone() const override { return new Velocity(*this); }
+    int value = 0;
+};
+
+class Tag final : public Component {
+public:
+    Tag() : Component(typeid(Tag)) {}
+    Component* Clone() const override { return new Tag(*this); }
+};
+
+} // namespace
+
+TEST(QueryTests, MatchesOnlyEntitiesWithEveryType) {
+    auto& query = Query<Position, Velocity>::Get();
+    const std::size_t before = query.Size();
+
+    Entity both;
+    both.AddComponent(new Position());
+    both.AddComponent(new Velocity());
+
+    Entity onlyPosition;
+    onlyPosition.AddComponent(new Position());
+
+    EXPECT_EQ(query.Size(), before + 1);
+
+    std::vector<Entity*> seen;
+    query.ForEach([&seen](Entity& entity, Position&, Velocity&) { seen.push_back(&entity); });
+    EXPECT_NE(std::find(seen.begin(), seen.end(), &both), seen.end());
+    EXPECT_EQ(std::find(seen.begin(), seen.end(), &onlyPosition), seen.end());
+}
+
+TEST(QueryTests, ForEachGivesDirectComponentReferences) {
+    Entity e;
+    auto* position = new Position();
+    auto* velocity = new Velocity();
+    velocity->value = 3;
+    e.AddComponent(position);
+    e.AddComponent(velocity);
+
+    Query<Position, Velocity>::Get().ForEach([](Entity&, Position& p, Velocity& v) { p.value += v.value; });
+    EXPECT_EQ(position->value, 3);
+}
+
+TEST(QueryTests, QueryCreatedLaterFindsExistingEntities) {
+    Entity e;
+    e.AddComponent(new Tag());
+    e.AddComponent(new Velocity());
+
+    // first use of this particular query happens after the Entity exists
+    auto& query = Query<Velocity, Tag>::Get();
+    EXPECT_EQ(query.GetEntities().size(), query.Size());
+    EXPECT_NE(std::find(query.GetEntities().begin(), query.GetEntities().end(), &e), query.GetEntities().end());
+}
+
+TEST(QueryTests, RemovingComponentOrEntityUpdatesMatches) {
+    auto& query = Query<Position>::Get();
+    const std::size_t before = query.Size();
+
+    auto* a = new Entity();
+    a->AddComponent(new Position());
+    Entity b;
+    b.AddComponent(new Position());
+    EXPECT_EQ(query.Size(), before + 2);
+
+    EXPECT_TRUE(b.RemoveComponent<Position>());
+    EXPECT_FALSE(b.RemoveComponent<Position>());
+    EXPECT_EQ(query.Size(), before + 1);
+    EXPECT_EQ(b.FindComponent(typeid(Position)), nullptr);
+
+    delete a;
+    EXPECT_EQ(query.Size(), before);
+}
+
+TEST(QueryTests, ParallelForEachVisitsEveryMatch) {
+    std::vector<std::unique_ptr<Entity>> entities;
+    for (int i = 0; i < 500; ++i)
+    {
+        entities.push_back(std::make_unique<Entity>());
+        entities.back()->AddComponent(new Position());
+        entities.back()->AddComponent(new Velocity());
+        entities.back()->AddComponent(new Tag());
+    }
+
+    auto& query = Query<Position, Velocity, Tag>::Get();
+    query.ParallelForEach([](Entity&, Position& p, Velocity&, Tag&) { p.value = 7; }, 16);
+
+    for (auto const& entity : entities)
+        EXPECT_EQ(static_cast<Position*>(entity->FindComponent(typeid(Position)))->value, 7);
+}
+
+TEST(JobSystemTests, ParallelForCoversRangeExactlyOnce) {
+    std::vector<std::atomic<int>> hits(10007);
+    Jobs()->ParallelFor(hits.size(), 64, [&hits](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i)
+            hits[i].fetch_add(1);
+    });
+
+    for (auto const& hit : hits)
+        EXPECT_EQ(hit.load(), 1);
+}
+
+TEST(JobSystemTests, SubmittedJobsRun) {
+    std::atomic<int> counter = 0;
+    std::mutex mutex;
+    std::condition_variable done;
+
+    for (int i = 0; i < 10; ++i)
+    {
+        Jobs()->Submit([&] {
+            if (counter.fetch_add(1) == 9)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                done.notify_all();
+            }
+        });
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    EXPECT_TRUE(done.wait_for(lock, std::chrono::seconds(5), [&] { return counter.load() == 10; }));
+}
@@ -0,0 +1,188 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: ReplayTests
+* Description:
+*       Tests for the master seed, the replay log format, recording input sources, state
+*       checksums and replaying a recorded session through the Runtime.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#include <gtest/gtest.h>
+#include <Core/Random/Random.h>
+#include <Core/Replay/Replay.h>
+#include <Core/Events/EventBus.h>
+#include <Core/Runtime/Runtime.h>
+#include <Systems/Grid System/GridSystem.h>
+#include <Systems/Input/InputSystem.h>
+#include <cstdio>
+#include <fstream>
+
+class ReplayTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        GridSystem::GetInstance()->ClearMaps();
+    }
+
+    void TearDown() override
+    {
+        GridSystem::GetInstance()->ClearMaps();
+        Events()->Dispatch();
+        std::remove(m_Path.c_str());
+    }
+
+    std::string m_Path = "replay_test.etrp";
+};
+
+TEST(RandomTest, SameSeedDrawsTheSameSequence) {
+    Rng()->SetSeed(1234);
+    std::vector<int> first;
+    for (int i = 0; i < 16; ++i)
+        first.push_back(Rng()->NextInt(0, 1000));
+
+    Rng()->SetSeed(1234);
+    for (int i = 0; i < 16; ++i)
+        EXPECT_EQ(Rng()->NextInt(0, 1000), first[i]);
+    EXPECT_EQ(Rng()->GetSeed(), 1234u);
+}
+
+TEST_F(ReplayTest, LogRoundTripsFramesAndChecksums) {
+    ReplayRecorder recorder;
+    ASSERT_TRUE(recorder.Open(m_Path, 0xDEADBEEFCAFEull, 2));
+
+    recorder.AddKey(Key::G);
+    recorder.EndTick(1);        // tick 0
+    recorder.EndTick(0);        // tick 1, empty
+    recorder.EndTick(0);        // tick 2, empty
+    recorder.AddKey(Key::H);
+    recorder.AddKey(Key::ESC);
+    recorder.EndTick(300);      // tick 3
+    recorder.Close();
+    EXPECT_FALSE(recorder.IsOpen());
+
+    const auto log = ReplayLog::Load(m_Path);
+    ASSERT_NE(log, nullptr);
+    EXPECT_EQ(log->GetSeed(), 0xDEADBEEFCAFEull);
+    EXPECT_EQ(log->GetChecksumInterval(), 2u);
+    EXPECT_EQ(log->GetTickCount(), 4u);
+
+    auto const& frames = log->GetFrames();
+    ASSERT_EQ(frames.size(), 2u);
+    EXPECT_EQ(frames[0].m_Tick, 0u);
+    EXPECT_EQ(frames[0].m_FixedSteps, 1u);
+    EXPECT_EQ(frames[0].m_Keys, std::vector<Key>{ Key::G });
+    EXPECT_EQ(frames[1].m_Tick, 3u);
+    EXPECT_EQ(frames[1].m_FixedSteps, 300u);
+    EXPECT_EQ(frames[1].m_Keys, (std::vector<Key>{ Key::H, Key::ESC }));
+
+    auto const& checksums = log->GetChecksums();
+    ASSERT_EQ(checksums.size(), 2u);
+    EXPECT_EQ(checksums[0].first, 2u);
+    EXPECT_EQ(checksums[1].first, 4u);
+    EXPECT_EQ(checksums[1].second, ComputeStateChecksum());
+    EXPECT_EQ(log->GetFinalChecksum(), ComputeStateChecksum());
+}
+
+TEST_F(ReplayTest, LoadRejectsTruncatedLogs) {
+    ReplayRecorder recorder;
+    ASSERT_TRUE(recorder.Open(m_Path, 7));
+    recorder.AddKey(Key::A);
+    recorder.EndTick(1);
+    recorder.Close();
+
+    std::ifstream in(m_Path, std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    std::ofstream(m_Path, std::ios::binary | std::ios::trunc).write(bytes.data(), static_cast<std::streamsize>(bytes.size() - 3));
+
+    std::ostringstream log;
+    Log()->SetSink(&log);
+    EXPECT_EQ(ReplayLog::Load(m_Path), nullptr);
+    EXPECT_EQ(ReplayLog::Load("missing_replay.etrp"), nullptr);
+    Log()->Flush();
+    Log()->SetSink(nullptr);
+    EXPECT_NE(log.str().find("truncated"), std::string::npos);
+}
+
+TEST_F(ReplayTest, RecordedKeysReplayOnTheirTicks) {
+    ReplayRecorder recorder;
+    ASSERT_TRUE(recorder.Open(m_Path, 1));
+
+    auto scripted = std::make_unique<ScriptedInputSource>();
+    scripted->Add(1, Key::M);
+    scripted->Add(3, Key::G);
+    RecordingInputSource source(std::move(scripted), recorder);
+
+    KeyEvent event;
+    for (int tick = 0; tick < 4; ++tick)
+    {
+        source.BeginFrame();
+        while (source.Poll(event)) {}
+        recorder.EndTick(0);
+    }
+    recorder.Close();
+
+    const auto log = ReplayLog::Load(m_Path);
+    ASSERT_NE(log, nullptr);
+    auto replay = log->MakeInputSource();
+
+    std::vector<std::pair<int, Key>> seen;
+    for (int tick = 0; tick < 4; ++tick)
+    {
+        replay->BeginFrame();
+        while (replay->Poll(event))
+            seen.emplace_back(tick, event.m_Key);
+    }
+    EXPECT_EQ(seen, (std::vector<std::pair<int, Key>>{ { 1, Key::M }, { 3, Key::G } }));
+}
+
+TEST_F(ReplayTest, ChecksumFollowsTheActiveGrid) {
+    auto grid = GridSystem::GetInstance();
+    grid->CreateMap("ReplayMap", GridSystem::Dimension(8, 4));
+    ASSERT_TRUE(grid->LoadMap("ReplayMap"));
+
+    const uint64_t before = ComputeStateChecksum();
+    EXPECT_EQ(ComputeStateChecksum(), before);
+
+    grid->SetCell(3, 2, '#');
+    const uint64_t after = ComputeStateChecksum();
+    EXPECT_NE(after, before);
+
+    grid->SetCell(3, 2, '.');
+    EXPECT_EQ(ComputeStateChecksum(), before);
+}
+
+TEST_F(ReplayTest, RuntimeReplayMatchesAndDetectsDivergence) {
+    // record a session that makes a random map on tick 1 and exits on tick 3
+    auto scripted = std::make_unique<ScriptedInputSource>();
+    scripted->Add(1, Key::H);
+    scripted->Add(3, Key::ESC);
+    std::unique_ptr<InputSource> original = Input()->SetSource(std::move(scripted));
+
+    Rng()->SetSeed(99);
+    RuntimeSystem()->SetRecording(m_Path);
+    RuntimeSystem()->Run();
+    RuntimeSystem()->SetRecording("");
+
+    GridSystem::GetInstance()->ClearMaps();
+    EXPECT_TRUE(RuntimeSystem()->Replay(m_Path));
+
+    // the same input under another seed makes a different map
+    std::fstream file(m_Path, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(5);  // magic and version
+    file.put('\x5a');
+    file.close();
+
+    std::ostringstream log;
+    Log()->SetSink(&log);
+    GridSystem::GetInstance()->ClearMaps();
+    EXPECT_FALSE(RuntimeSystem()->Replay(m_Path));
+    Log()->Flush();
+    Log()->SetSink(nullptr);
+    EXPECT_NE(log.str().find("different state"), std::string::npos);
+
+    Input()->SetSource(std::move(original));
+}
@@ -0,0 +1,114 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: StringIdTests
+* Description:
+*       Tests for interned string IDs and their use as map and Entity names.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#include <gtest/gtest.h>
+#include <Core/Strings/StringId.h>
+#include <Core/ECS/Entity/Entity.h>
+#include <Systems/Grid System/GridSystem.h>
+
+// literal IDs are computed at compile time
+constexpr StringId kPlayer("Player");
+static_assert(kPlayer.GetHash() == StringId::Hash("Player"));
+static_assert(StringId().IsEmpty());
+static_assert(sizeof(StringId) == sizeof(uint32_t));
+static_assert(StringId::Hash("") == 0);
+static_assert(StringId::Hash("a") != StringId::Hash("b"));
+
+TEST(StringIdTests, SameTextGivesSameId) {
+    const std::string runtime = std::string("Pla") + "yer";
+    EXPECT_EQ(StringId(runtime), kPlayer);
+    EXPECT_NE(StringId("Enemy"), kPlayer);
+}
+
+TEST(StringIdTests, RuntimeTextIsInterned) {
+    const StringId id(std::string("InternedAtRuntime"));
+    EXPECT_EQ(id.GetString(), "InternedAtRuntime");
+}
+
+TEST(StringIdTests, CompileTimeIdResolvesOnceInterned) {
+    constexpr StringId id("OnlyHashedAtCompileTime");
+    StringId::Intern("OnlyHashedAtCompileTime");
+    EXPECT_EQ(id.GetString(), "OnlyHashedAtCompileTime");
+}
+
+TEST(StringIdTests, RuntimeLiteralsAreInternedOnce) {
+    const std::size_t before = StringTable::Instance().Size();
+    const StringId id("InternedAtConstruction");
+    EXPECT_EQ(StringTable::Instance().Size(), before + 1);
+    EXPECT_EQ(id.GetString(), "InternedAtConstruction");
+
+    const StringId again("InternedAtConstruction");
+    EXPECT_EQ(again, id);
+    EXPECT_EQ(StringTable::Instance().Size(), before + 1);
+}
+
+TEST(StringIdTests, CStringsAreCopiedIntoTheTable) {
+    StringId id;
+    {
+        const std::string text = std::string("Temporary ") + std::to_string(7);
+        id = StringId(text.c_str());
+    }
+    EXPECT_EQ(id.GetString(), "Temporary 7");
+}
+
+TEST(StringIdTests, CollisionsThrowOnlyWhenInterning) {
+    // "costarring" and "liquid" share a 32-bit FNV-1a hash
+    ASSERT_EQ(StringId::Hash("costarring"), StringId::Hash("liquid"));
+    StringId::Intern("costarring");
+    EXPECT_THROW(StringId::Intern("liquid"), std::runtime_error);
+    EXPECT_THROW(StringId("liquid"), std::runtime_error);
+    EXPECT_EQ(StringId("costarring").GetString(), "costarring");
+
+    // looking an ID up never throws
+    EXPECT_NO_THROW(StringId::Hashed("liquid").GetString());
+}
+
+TEST(StringIdTests, EmptyIdHasEmptyText) {
+    EXPECT_EQ(StringId().GetString(), "");
+    EXPECT_EQ(StringId(std::string()), StringId());
+}
+
+TEST(StringIdTests, StreamsItsText) {
+    std::ostringstream stream;
+    stream << StringId("Streamed");
+    EXPECT_EQ(stream.str(), "Streamed");
+}
+
+TEST(StringIdTests, EntityNamesAreNotInterned) {
+    const std::size_t before = StringTable::Instance().Size();
+    Entity entity;
+    entity.SetName("Named");
+    EXPECT_EQ(entity.GetNameId(), StringId::Hashed("Named"));
+    EXPECT_EQ(entity.GetName(), "Named");
+
+    entity.SetName(std::string("Renamed ") + std::to_string(42));
+    EXPECT_EQ(entity.GetNameId(), StringId::Hashed("Renamed 42"));
+    EXPECT_EQ(entity.GetName(), "Renamed 42");
+    EXPECT_EQ(StringTable::Instance().Size(), before);
+
+    // shared IDs still resolve through the table
+    entity.SetName(StringId::Intern("SharedName"));
+    EXPECT_EQ(entity.GetName(), "SharedName");
+}
+
+TEST(StringIdTests, GridMapsAreKeyedById) {
+    auto grid = GridSystem::GetInstance();
+    grid->ClearMaps();
+
+    constexpr StringId kMap("StringIdMap");
+    grid->CreateMap(std::string("StringIdMap"), GridSystem::Dimension(2, 2), '.');
+    EXPECT_TRUE(grid->LoadMap(kMap));
+    EXPECT_EQ(grid->GetActiveMap(), kMap);
+    EXPECT_EQ(grid->GetActiveMap().GetString(), "StringIdMap");
+
+    grid->ClearMaps();
+    EXPECT_TRUE(grid->GetActiveMap().IsEmpty());
+}
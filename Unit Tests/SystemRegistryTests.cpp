@@ -3,7 +3,8 @@
 * -----------------------------------------------------------------------------------------
 * File: SystemRegistryTests
 * Description:
-*      Tests the automatic registration of systems using the AUTO_REGISTER_SYSTEM macro.
+*      Tests the automatic registration of systems using the AUTO_REGISTER_SYSTEM macro,
+*      and compile-time SystemLists.
 *
 * Author:     Jax Clayton
 * Created:    8/2/2025
@@ -53,3 +54,64 @@ TEST(SystemRegistryTests, AutoRegisterRunsBeforeMain)
 
     EXPECT_TRUE(found) << "AUTO_REGISTER_SYSTEM did not register TestAutoSystem.";
 }
+
+// Systems registered only through a SystemList
+class ListedSystemA : public System
+{
+public:
+    ListedSystemA() : System("ListedSystemA") {}
+    void Update(double) override {}
+    void FixedUpdate() override {}
+    void Render() override {}
+
+    static std::shared_ptr<ListedSystemA> GetInstance()
+    {
+        static std::shared_ptr<ListedSystemA> instance(new ListedSystemA());
+        return instance;
+    }
+};
+
+class ListedSystemB : public System
+{
+public:
+    ListedSystemB() : System("ListedSystemB") {}
+    void Update(double) override {}
+    void FixedUpdate() override {}
+    void Render() override {}
+
+    static std::shared_ptr<ListedSystemB> GetInstance()
+    {
+        static std::shared_ptr<ListedSystemB> instance(new ListedSystemB());
+        return instance;
+    }
+};
+
+using TestSystems = SystemList<ListedSystemA, ListedSystemB>;
+
+static_assert(TestSystems::Size == 2);
+static_assert(TestSystems::IndexOf<ListedSystemB>() == 1);
+static_assert(TestSystems::Contains<ListedSystemA>);
+static_assert(!TestSystems::Contains<TestAutoSystem>);
+
+TEST(SystemRegistryTests, RegisterListPutsSystemsFirstInListOrder)
+{
+    auto& registry = SystemRegistry::Instance();
+    registry.RegisterList(TestSystems{});
+    registry.RegisterList(TestSystems{});
+
+    const auto& systems = registry.GetSystems();
+    ASSERT_GE(systems.size(), 3u);
+    EXPECT_EQ(systems[0], ListedSystemA::GetInstance().get());
+    EXPECT_EQ(systems[1], ListedSystemB::GetInstance().get());
+    EXPECT_EQ(std::count(systems.begin(), systems.end(), systems[0]), 1);
+}
+
+TEST(SystemRegistryTests, GetFindsSystemsByType)
+{
+    EXPECT_EQ(Registry()->Get<TestAutoSystem>(), TestAutoSystem::GetInstance().get());
+
+    // registering the same type again changes nothing
+    const std::size_t count = Registry()->GetSystems().size();
+    Registry()->Register<TestAutoSystem>();
+    EXPECT_EQ(Registry()->GetSystems().size(), count);
+}
@@ -0,0 +1,93 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: TerminalReaderTests
+* Description:
+*       Tests for decoding terminal bytes and escape sequences into Keys.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#include <gtest/gtest.h>
+#include <Systems/Input/TerminalReader.h>
+
+namespace {
+
+// feeds a whole string and collects every completed Key
+std::vector<Key> Parse(TerminalKeyParser& parser, std::string const& bytes)
+{
+    std::vector<Key> keys;
+    for (unsigned char byte : bytes)
+    {
+        const Key key = parser.Feed(byte);
+        if (key != Key::INVALID)
+            keys.push_back(key);
+    }
+    return keys;
+}
+
+std::vector<Key> Parse(std::string const& bytes)
+{
+    TerminalKeyParser parser;
+    return Parse(parser, bytes);
+}
+
+} // namespace
+
+TEST(TerminalKeyParserTests, PlainBytesAreUpperCasedKeys) {
+    EXPECT_EQ(Parse("gH1"), (std::vector<Key>{ Key::G, Key::H, Key::NUM_1 }));
+    EXPECT_EQ(Parse("\n\x7f"), (std::vector<Key>{ Key::ENTER, Key::BACKSPACE }));
+}
+
+TEST(TerminalKeyParserTests, EightBitBytesAreIgnored) {
+    // "é" in UTF-8 between two letters
+    EXPECT_EQ(Parse("a\xc3\xa9" "b"), (std::vector<Key>{ Key::A, Key::B }));
+    EXPECT_EQ(TerminalKeyParser::FromByte(0xE0), Key::INVALID);
+}
+
+TEST(TerminalKeyParserTests, ArrowKeysInBothModes) {
+    EXPECT_EQ(Parse("\x1b[A\x1b[B\x1b[C\x1b[D"),
+              (std::vector<Key>{ Key::ARROW_UP, Key::ARROW_DOWN, Key::ARROW_RIGHT, Key::ARROW_LEFT }));
+    EXPECT_EQ(Parse("\x1bOA\x1bOD"), (std::vector<Key>{ Key::ARROW_UP, Key::ARROW_LEFT }));
+}
+
+TEST(TerminalKeyParserTests, FunctionKeys) {
+    EXPECT_EQ(Parse("\x1bOP\x1bOS"), (std::vector<Key>{ Key::F1, Key::F4 }));
+    EXPECT_EQ(Parse("\x1b[15~\x1b[17~\x1b[21~\x1b[24~"),
+              (std::vector<Key>{ Key::F5, Key::F6, Key::F10, Key::F12 }));
+    EXPECT_EQ(Parse("\x1b[[A\x1b[[E"), (std::vector<Key>{ Key::F1, Key::F5 }));
+}
+
+TEST(TerminalKeyParserTests, EditingKeysAndModifiers) {
+    EXPECT_EQ(Parse("\x1b[2~\x1b[3~\x1b[5~\x1b[6~\x1b[H\x1b[4~"),
+              (std::vector<Key>{ Key::INSERT, Key::DELETE_KEY, Key::PAGE_UP, Key::PAGE_DOWN, Key::HOME, Key::END }));
+
+    // Ctrl+Up and Shift+F1 decode to the unmodified keys
+    EXPECT_EQ(Parse("\x1b[1;5A\x1b[1;2P"), (std::vector<Key>{ Key::ARROW_UP, Key::F1 }));
+}
+
+TEST(TerminalKeyParserTests, BurstsKeepEveryKey) {
+    EXPECT_EQ(Parse("ab\x1b[Ac"), (std::vector<Key>{ Key::A, Key::B, Key::ARROW_UP, Key::C }));
+}
+
+TEST(TerminalKeyParserTests, LoneEscapeNeedsFlush) {
+    TerminalKeyParser parser;
+    EXPECT_TRUE(Parse(parser, "\x1b").empty());
+    EXPECT_TRUE(parser.HasPending());
+    EXPECT_EQ(parser.Flush(), Key::ESC);
+    EXPECT_FALSE(parser.HasPending());
+
+    // a second escape ends the first
+    EXPECT_EQ(Parse(parser, "\x1b\x1b[B"), (std::vector<Key>{ Key::ESC, Key::ARROW_DOWN }));
+}
+
+TEST(TerminalKeyParserTests, AltKeyYieldsTheKey) {
+    EXPECT_EQ(Parse("\x1bx"), (std::vector<Key>{ Key::X }));
+}
+
+TEST(TerminalKeyParserTests, UnknownSequencesAreDropped) {
+    TerminalKeyParser parser;
+    EXPECT_EQ(Parse(parser, "\x1b[99~q"), (std::vector<Key>{ Key::Q }));
+    EXPECT_FALSE(parser.HasPending());
+}
@@ -0,0 +1,179 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: TransformTests
+* Description:
+*       Tests for 2D affine math and TransformSystem world-matrix propagation.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#include <gtest/gtest.h>
+#include <Core/ECS/Component/Transform/Transform.h>
+#include <Systems/Transform System/TransformSystem.h>
+
+namespace {
+
+Transform* AddTransform(Entity& entity, Vec2f translation = Vec2f::Zero())
+{
+    auto* transform = new Transform();
+    entity.AddComponent(transform);
+    transform->SetTranslation(translation);
+    return transform;
+}
+
+} // namespace
+
+TEST(Affine2Tests, FromTRSScalesThenRotatesThenTranslates) {
+    const Affine2f m = Affine2f::FromTRS({ 10.0f, 0.0f }, 90.0f, { 2.0f, 2.0f });
+    EXPECT_TRUE(m.TransformPoint({ 1.0f, 0.0f }).AlmostEqual(Vec2f{ 10.0f, 2.0f }, 1e-5f));
+    EXPECT_TRUE(m.TransformVector({ 0.0f, 1.0f }).AlmostEqual(Vec2f{ -2.0f, 0.0f }, 1e-5f));
+}
+
+TEST(Affine2Tests, BatchComposeMatchesScalarIncludingTail) {
+    constexpr std::size_t kCount = 11;
+    Affine2SoA parents, locals, out;
+    parents.Resize(kCount);
+    locals.Resize(kCount);
+    out.Resize(kCount);
+
+    for (std::size_t i = 0; i < kCount; ++i)
+    {
+        const float f = static_cast<float>(i);
+        parents.Set(i, Affine2f::FromTRS({ f, -f }, 15.0f * f, { 1.0f + f, 2.0f }));
+        locals.Set(i, Affine2f::FromTRS({ 0.5f * f, 3.0f }, -7.0f * f, { 1.0f, 0.5f + f }));
+    }
+
+    ComposeAffine2Batch(parents, locals, out, 0, kCount);
+    for (std::size_t i = 0; i < kCount; ++i)
+        EXPECT_TRUE(out.Get(i).AlmostEqual(parents.Get(i) * locals.Get(i), 1e-4f)) << "index " << i;
+}
+
+TEST(Affine2Tests, InverseUndoesTheTransform) {
+    const Affine2f m = Affine2f::FromTRS({ 3.0f, -2.0f }, 35.0f, { 2.0f, 0.5f });
+    EXPECT_TRUE((m * m.Inverse()).AlmostEqual(Affine2f::Identity(), 1e-5f));
+    EXPECT_NEAR(m.Determinant(), 1.0f, 1e-5f);
+
+    const Vec2f point{ 4.0f, 7.0f };
+    EXPECT_TRUE(m.Inverse().TransformPoint(m.TransformPoint(point)).AlmostEqual(point, 1e-4f));
+}
+
+TEST(TransformTests, ChildWorldIncludesParent) {
+    Entity parent;
+    Entity child;
+    child.SetParent(&parent);
+    Transform* parentTransform = AddTransform(parent, { 5.0f, 1.0f });
+    Transform* childTransform = AddTransform(child, { 1.0f, 0.0f });
+    parentTransform->SetRotation(90.0f);
+
+    EXPECT_TRUE(childTransform->IsDirty());
+    Transforms()->Propagate();
+
+    EXPECT_FALSE(parentTransform->IsDirty());
+    EXPECT_FALSE(childTransform->IsDirty());
+    EXPECT_TRUE(childTransform->GetWorldPosition().AlmostEqual(Vec2f{ 5.0f, 2.0f }, 1e-5f));
+    EXPECT_EQ(Transforms()->GetPendingCount(), 0u);
+}
+
+TEST(TransformTests, WorldToLocalHitTestsAgainstLocalBounds) {
+    Entity parent;
+    Entity button;
+    button.SetParent(&parent);
+    AddTransform(parent, { 20.0f, 10.0f })->SetRotation(90.0f);
+    Transform* buttonTransform = AddTransform(button, { 2.0f, 0.0f });
+    buttonTransform->SetScale({ 4.0f, 2.0f });
+    Transforms()->Propagate();
+
+    // the button covers [0, 1] x [0, 1] in its own space
+    auto hit = [&](Vec2f world) {
+        const Vec2f local = buttonTransform->WorldToLocal(world);
+        return local.x() >= 0.0f && local.x() <= 1.0f && local.y() >= 0.0f && local.y() <= 1.0f;
+    };
+    EXPECT_TRUE(hit(buttonTransform->LocalToWorld({ 0.5f, 0.5f })));
+    EXPECT_TRUE(buttonTransform->LocalToWorld({ 0.0f, 0.0f }).AlmostEqual(Vec2f{ 20.0f, 12.0f }, 1e-4f));
+    EXPECT_TRUE(hit({ 19.0f, 14.0f }));
+    EXPECT_FALSE(hit({ 21.0f, 14.0f }));
+    EXPECT_FALSE(hit({ 19.0f, 17.0f }));
+}
+
+TEST(TransformTests, EntitiesWithoutTransformPassTheParentThrough) {
+    Entity root;
+    Entity group;
+    Entity leaf;
+    group.SetParent(&root);
+    leaf.SetParent(&group);
+    Transform* rootTransform = AddTransform(root, { 3.0f, 4.0f });
+    Transform* leafTransform = AddTransform(leaf, { 1.0f, 1.0f });
+    Transforms()->Propagate();
+
+    EXPECT_TRUE(leafTransform->GetWorldPosition().AlmostEqual(Vec2f{ 4.0f, 5.0f }, 1e-5f));
+
+    // moving the root alone recomputes the leaf too
+    rootTransform->SetTranslation({ 0.0f, 0.0f });
+    Transforms()->Propagate();
+    EXPECT_TRUE(leafTransform->GetWorldPosition().AlmostEqual(Vec2f{ 1.0f, 1.0f }, 1e-5f));
+}
+
+TEST(TransformTests, DirtyChildInheritsCleanParentWorld) {
+    Entity parent;
+    Entity child;
+    child.SetParent(&parent);
+    AddTransform(parent, { 10.0f, 0.0f })->SetScale({ 2.0f, 2.0f });
+    Transform* childTransform = AddTransform(child);
+    Transforms()->Propagate();
+
+    childTransform->SetTranslation({ 1.0f, 1.0f });
+    Transforms()->Propagate();
+    EXPECT_TRUE(childTransform->GetWorldPosition().AlmostEqual(Vec2f{ 12.0f, 2.0f }, 1e-5f));
+}
+
+TEST(TransformTests, ReparentingRecomputesAgainstNewParent) {
+    Entity a;
+    Entity b;
+    Entity child;
+    AddTransform(a, { 1.0f, 0.0f });
+    AddTransform(b, { 0.0f, 7.0f });
+    Transform* childTransform = AddTransform(child, { 1.0f, 1.0f });
+    child.SetParent(&a);
+    Transforms()->Propagate();
+    EXPECT_TRUE(childTransform->GetWorldPosition().AlmostEqual(Vec2f{ 2.0f, 1.0f }, 1e-5f));
+
+    child.SetParent(&b);
+    EXPECT_TRUE(childTransform->IsDirty());
+    Transforms()->Propagate();
+    EXPECT_TRUE(childTransform->GetWorldPosition().AlmostEqual(Vec2f{ 1.0f, 8.0f }, 1e-5f));
+}
+
+TEST(TransformTests, LargeFormationMatchesPerEntityComposition) {
+    constexpr int kSquads = 40;
+    constexpr int kPerSquad = 50;
+
+    auto* formation = new Entity();
+    Transform* formationTransform = AddTransform(*formation, { 100.0f, -50.0f });
+    formationTransform->SetRotation(30.0f);
+
+    std::vector<std::pair<Transform*, Transform*>> members;
+    for (int s = 0; s < kSquads; ++s)
+    {
+        auto* squad = new Entity();
+        squad->SetParent(formation);
+        Transform* squadTransform = AddTransform(*squad, { static_cast<float>(s) * 4.0f, 0.0f });
+        squadTransform->SetRotation(static_cast<float>(s));
+        for (int m = 0; m < kPerSquad; ++m)
+        {
+            auto* member = new Entity();
+            member->SetParent(squad);
+            members.emplace_back(squadTransform, AddTransform(*member, { 0.0f, static_cast<float>(m) }));
+        }
+    }
+    Transforms()->Propagate();
+
+    for (auto const& [squad, member] : members)
+    {
+        const Affine2f expected = formationTransform->GetLocalMatrix() * squad->GetLocalMatrix() * member->GetLocalMatrix();
+        ASSERT_TRUE(member->GetWorldMatrix().AlmostEqual(expected, 1e-3f));
+    }
+
+    delete formation;
+}
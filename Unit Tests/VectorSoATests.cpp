@@ -0,0 +1,127 @@
+﻿/*******************************************************************************************
+* Project Eternum Engine
+* -----------------------------------------------------------------------------------------
+* File: VectorSoATests
+* Description:
+*       Tests for VectorSoA storage and its batch kernels, checked against the single
+*       Vector operations over sizes that leave a scalar remainder.
+*
+* Author:     Jax Clayton
+* Created:    10/18/2026
+* License:    MIT License (see LICENSE file in project root)
+*******************************************************************************************/
+#include <gtest/gtest.h>
+#include <Core/Vector/VectorSoA.h>
+
+namespace {
+
+/// @brief  odd enough to exercise both the SIMD body and the scalar remainder
+constexpr std::size_t kCount = 11;
+
+template <typename T, std::size_t N>
+VectorSoA<T, N> MakeBatch(T offset)
+{
+    VectorSoA<T, N> batch;
+    for (std::size_t i = 0; i < kCount; ++i)
+    {
+        Vector<T, N> v;
+        for (std::size_t axis = 0; axis < N; ++axis)
+            v[axis] = static_cast<T>(static_cast<double>(i) * (axis + 1) - 4.0 + offset);
+        batch.PushBack(v);
+    }
+    return batch;
+}
+
+} // namespace
+
+TEST(VectorSoATests, StoresEachComponentContiguously)
+{
+    Vec3fSoA batch(2);
+    EXPECT_EQ(batch.Size(), 2u);
+    EXPECT_EQ(batch.Get(1), Vec3f::Zero());
+
+    batch.Set(1, Vec3f{1.f, 2.f, 3.f});
+    batch.PushBack(Vec3f{4.f, 5.f, 6.f});
+    EXPECT_EQ(batch.Size(), 3u);
+    EXPECT_FLOAT_EQ(batch.Component(1)[1], 2.f);
+    EXPECT_FLOAT_EQ(batch.Component(2)[2], 6.f);
+    EXPECT_EQ(batch.Get(2), (Vec3f{4.f, 5.f, 6.f}));
+
+    batch.Clear();
+    EXPECT_TRUE(batch.Empty());
+}
+
+TEST(VectorSoATests, ArithmeticMatchesSingleVectors)
+{
+    const auto a = MakeBatch<float, 2>(0.5f);
+    const auto b = MakeBatch<float, 2>(-1.25f);
+
+    Vec2fSoA sum(kCount), scaled(kCount), moved(kCount);
+    AddBatch(a, b, sum);
+    ScaleBatch(a, 3.f, scaled);
+    MultiplyAddBatch(a, b, 0.016f, moved);
+
+    for (std::size_t i = 0; i < kCount; ++i)
+    {
+        EXPECT_EQ(sum.Get(i), a.Get(i) + b.Get(i)) << i;
+        EXPECT_EQ(scaled.Get(i), a.Get(i) * 3.f) << i;
+        EXPECT_EQ(moved.Get(i), a.Get(i) + b.Get(i) * 0.016f) << i;
+    }
+}
+
+TEST(VectorSoATests, ReductionsMatchSingleVectors)
+{
+    const auto a = MakeBatch<float, 3>(0.5f);
+    const auto b = MakeBatch<float, 3>(2.f);
+    const Vec3f point{1.f, -2.f, 3.f};
+
+    std::vector<float> dots(kCount), lengths(kCount), distances(kCount);
+    DotBatch(a, b, dots);
+    LengthBatch(a, lengths);
+    DistanceToPointBatch(a, point, distances);
+
+    for (std::size_t i = 0; i < kCount; ++i)
+    {
+        EXPECT_NEAR(dots[i], a.Get(i).Dot(b.Get(i)), 1e-4f) << i;
+        EXPECT_NEAR(lengths[i], a.Get(i).Length(), 1e-5f) << i;
+        EXPECT_NEAR(distances[i], (a.Get(i) - point).Length(), 1e-5f) << i;
+    }
+}
+
+TEST(VectorSoATests, NormalizeAndClampLength)
+{
+    auto a = MakeBatch<double, 2>(0.0);
+    a.Set(4, Vec2d::Zero());
+
+    Vec2dSoA unit(kCount), clamped(kCount);
+    NormalizeBatch(a, unit);
+    ClampLengthBatch(a, 5.0, clamped);
+
+    for (std::size_t i = 0; i < kCount; ++i)
+    {
+        const Vec2d v = a.Get(i);
+        EXPECT_TRUE(unit.Get(i).AlmostEqual(v.Normalized(), 1e-12)) << i;
+
+        const double length = v.Length();
+        const Vec2d expected = length > 5.0 ? v * (5.0 / length) : v;
+        EXPECT_TRUE(clamped.Get(i).AlmostEqual(expected, 1e-12)) << i;
+        EXPECT_LE(clamped.Get(i).Length(), 5.0 + 1e-12) << i;
+    }
+    EXPECT_EQ(unit.Get(4), Vec2d::Zero());
+}
+
+TEST(VectorSoATests, RangesOnlyTouchTheirElements)
+{
+    auto positions = MakeBatch<float, 2>(0.f);
+    const auto velocities = MakeBatch<float, 2>(1.f);
+    const auto before = positions;
+
+    // two jobs splitting the batch must match a single pass
+    MultiplyAddBatch(positions, velocities, 2.f, positions, 0, 6);
+    for (std::size_t i = 6; i < kCount; ++i)
+        EXPECT_EQ(positions.Get(i), before.Get(i)) << i;
+
+    MultiplyAddBatch(positions, velocities, 2.f, positions, 6);
+    for (std::size_t i = 0; i < kCount; ++i)
+        EXPECT_EQ(positions.Get(i), before.Get(i) + velocities.Get(i) * 2.f) << i;
+}
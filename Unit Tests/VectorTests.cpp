@@ -4,7 +4,8 @@
 * File: VectorTests
 * Description:
 *      Tests for the templated Vector<T, N> class: construction, named accessors,
-*      arithmetic, dot/length/normalize, comparisons, and helpers.
+*      arithmetic, dot/length/normalize, comparisons, helpers, the SIMD-specialized
+*      sizes, PaddedVec3f, constant evaluation and expression templates.
 *
 * Author:     Jax Clayton
 * Created:    8/8/2025
@@ -206,3 +207,251 @@ TEST(VectorTests, RangeForIteration)
     for (int x : v) sum += x;
     EXPECT_EQ(sum, 6);
 }
+
+// ---------------------------------------------------------
+// SIMD Specializations
+// ---------------------------------------------------------
+namespace {
+
+/// @brief  runs the arithmetic on a SIMD-backed size and checks it against plain loops
+template <typename T, std::size_t N>
+void ExpectMatchesScalar()
+{
+    Vector<T, N> a, b;
+    std::array<T, N> ra{}, rb{};
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        a[i] = ra[i] = static_cast<T>(1.5 + i);
+        b[i] = rb[i] = static_cast<T>(0.25 - 2.0 * i);
+    }
+
+    T dot = 0;
+    for (std::size_t i = 0; i < N; ++i) dot += ra[i] * rb[i];
+    EXPECT_NEAR(a.Dot(b), dot, 1e-5);
+
+    auto c = -((a + b) * static_cast<T>(3) - b) / static_cast<T>(2);
+    for (std::size_t i = 0; i < N; ++i)
+        EXPECT_NEAR(c[i], -((ra[i] + rb[i]) * 3 - rb[i]) / 2, 1e-5) << "lane " << i;
+}
+
+} // namespace
+
+TEST(VectorTests, SimdSizesMatchScalarLoops)
+{
+    ExpectMatchesScalar<float, 2>();
+    ExpectMatchesScalar<float, 3>();
+    ExpectMatchesScalar<float, 4>();
+    ExpectMatchesScalar<double, 2>();
+    ExpectMatchesScalar<double, 4>();
+}
+
+TEST(VectorTests, SimdSizesKeepTheirLayout)
+{
+    EXPECT_EQ(sizeof(Vec2f), 2 * sizeof(float));
+    EXPECT_EQ(sizeof(Vec3f), 3 * sizeof(float));
+    EXPECT_EQ(sizeof(Vec4f), 4 * sizeof(float));
+    EXPECT_EQ(sizeof(Vec2d), 2 * sizeof(double));
+#if ETERNUM_SIMD_SSE
+    EXPECT_EQ(alignof(Vec4f), 16u);
+    EXPECT_EQ(alignof(Vec2d), 16u);
+#endif
+}
+
+TEST(VectorTests, Vec3fLeavesTheNextFloatAlone)
+{
+    struct Packed { Vec3f v; float next; };
+    Packed packed{ Vec3f{1.f, 2.f, 3.f}, 42.f };
+
+    packed.v += Vec3f{1.f, 1.f, 1.f};
+    packed.v *= 2.f;
+    packed.v = -packed.v;
+    EXPECT_FLOAT_EQ(packed.next, 42.f);
+    EXPECT_EQ(packed.v, (Vec3f{-4.f, -6.f, -8.f}));
+}
+
+TEST(VectorTests, NormalizeFastIsCloseToNormalize)
+{
+    Vec4f a{3.f, -4.f, 12.f, 0.5f};
+    EXPECT_TRUE(a.NormalizedFast().AlmostEqual(a.Normalized(), 1e-5f));
+    EXPECT_NEAR(NormalizeFast(a).Length(), 1.f, 1e-5f);
+
+    Vec2f b{1e-3f, 2e3f};
+    b.NormalizeFast();
+    EXPECT_NEAR(b.Length(), 1.f, 1e-5f);
+
+    Vec3f zero;
+    zero.NormalizeFast();
+    EXPECT_EQ(zero, Vec3f::Zero());
+}
+
+TEST(VectorTests, PaddedVec3fBehavesLikeVec3f)
+{
+    EXPECT_EQ(sizeof(PaddedVec3f), 16u);
+
+    const Vec3f a{1.f, 2.f, 2.f};
+    const Vec3f b{-3.f, 0.5f, 4.f};
+    const PaddedVec3f pa(a), pb(b);
+
+    EXPECT_FLOAT_EQ(pa.Dot(pb), a.Dot(b));
+    EXPECT_FLOAT_EQ(pa.Length(), 3.f);
+    EXPECT_EQ((pa + pb).ToVec3f(), a + b);
+    EXPECT_EQ((pa - pb).ToVec3f(), a - b);
+    EXPECT_EQ((2.f * pa / 4.f).ToVec3f(), 2.f * a / 4.f);
+    EXPECT_EQ((-pa).ToVec3f(), -a);
+    EXPECT_TRUE(pa.Normalized().ToVec3f().AlmostEqual(a.Normalized()));
+
+    float sum = 0.f;
+    for (float value : pa) sum += value;
+    EXPECT_FLOAT_EQ(sum, 5.f);
+}
+
+// ---------------------------------------------------------
+// Constant Evaluation
+// ---------------------------------------------------------
+namespace {
+
+constexpr Vec2i kNeighborOffsets[] = { {1, 0}, {0, 1}, {-1, 0}, {0, -1} };
+
+constexpr Vec2i SumOfOffsets()
+{
+    Vec2i sum;
+    for (Vec2i const& offset : kNeighborOffsets)
+        sum += offset;
+    return sum;
+}
+
+} // namespace
+
+TEST(VectorTests, UsableInConstantExpressions)
+{
+    static_assert(SumOfOffsets() == Vec2i::Zero());
+    static_assert(kNeighborOffsets[1].y() == 1);
+
+    constexpr Vec3f a{1.f, 2.f, 3.f};
+    constexpr Vec3f b = a * 2.f - Vec3f::Unit(0);
+    static_assert(b == Vec3f{1.f, 4.f, 6.f});
+    static_assert(a.Dot(b) == 27.f);
+    static_assert((-a).Eval().LengthSq() == 14.f);
+
+    // the same expressions at runtime take the SIMD kernels
+    Vec3f c{1.f, 2.f, 3.f};
+    c *= 2.f;
+    c -= Vec3f::Unit(0);
+    EXPECT_EQ(c, b);
+}
+
+// ---------------------------------------------------------
+// Expression Templates
+// ---------------------------------------------------------
+TEST(VectorTests, ChainsStayLazyUntilAssigned)
+{
+    Vec4f a{1.f, 2.f, 3.f, 4.f};
+    const Vec4f b{0.5f, 0.5f, 0.5f, 0.5f};
+    const Vec4f c{1.f, 1.f, 1.f, 1.f};
+
+    auto chain = a + b * 2.f - c;
+    static_assert(!std::is_same_v<decltype(chain), Vec4f>);
+    EXPECT_FLOAT_EQ(chain[3], 4.f);
+
+    // the chain reads its operands when evaluated, not when built
+    a[3] = 10.f;
+    const Vec4f result = chain;
+    EXPECT_EQ(result, (Vec4f{1.f, 2.f, 3.f, 10.f}));
+}
+
+TEST(VectorTests, AssigningAnExpressionOfItselfIsSafe)
+{
+    Vec3d v{1.0, 2.0, 3.0};
+    const Vec3d d{1.0, 1.0, 1.0};
+
+    v = (v - d) * 2.0 + v / 2.0;
+    EXPECT_EQ(v, (Vec3d{0.5, 3.0, 5.5}));
+
+    v += -v + d;
+    EXPECT_EQ(v, d);
+}
+
+TEST(VectorTests, ExpressionsCopyTemporaryOperands)
+{
+    const Vec2f a{1.f, 2.f};
+
+    // the temporary dies at the end of this statement; the expression keeps a copy
+    auto e = a + Vec2f{10.f, 20.f} * 2.f;
+    const Vec2f result = e;
+    EXPECT_EQ(result, (Vec2f{21.f, 42.f}));
+}
+
+TEST(VectorTests, ExpressionsForwardAccessorsAndComparisons)
+{
+    const Vec3f a{1.f, 2.f, 3.f};
+    const Vec3f b{4.f, 5.f, 6.f};
+    const Vec3f c{5.f, 7.f, 9.f};
+
+    EXPECT_FLOAT_EQ((a + b).x(), 5.f);
+    EXPECT_FLOAT_EQ((b - a).z(), 3.f);
+    EXPECT_TRUE((a + b) == c);
+    EXPECT_TRUE(c == a + b);
+    EXPECT_TRUE((a + b) != a);
+    EXPECT_TRUE((c - b) == (c - b));
+    static_assert((Vec2i{1, 2} + Vec2i{3, 4}) == Vec2i{4, 6});
+}
+
+namespace {
+
+/// @brief  element type that counts default constructions, which only happen when a
+///         Vector is made
+struct Counted
+{
+    static inline int s_Defaults = 0;
+
+    double m_Value = 0.0;
+
+    Counted() { ++s_Defaults; }
+    explicit Counted(double value) : m_Value(value) {}
+
+    Counted operator+(const Counted& rhs) const { return Counted(m_Value + rhs.m_Value); }
+    Counted operator-(const Counted& rhs) const { return Counted(m_Value - rhs.m_Value); }
+    Counted operator*(const Counted& rhs) const { return Counted(m_Value * rhs.m_Value); }
+    Counted operator-() const { return Counted(-m_Value); }
+    Counted& operator+=(const Counted& rhs) { m_Value += rhs.m_Value; return *this; }
+    Counted& operator-=(const Counted& rhs) { m_Value -= rhs.m_Value; return *this; }
+    bool operator==(const Counted& rhs) const { return m_Value == rhs.m_Value; }
+
+    friend std::ostream& operator<<(std::ostream& os, const Counted& c) { return os << c.m_Value; }
+};
+
+using CountedVec3 = Vector<Counted, 3>;
+
+} // namespace
+
+TEST(VectorTests, ChainsMakeNoIntermediateVectors)
+{
+    const CountedVec3 a{Counted(1.0), Counted(2.0), Counted(3.0)};
+    const CountedVec3 b{Counted(4.0), Counted(5.0), Counted(6.0)};
+    const CountedVec3 c{Counted(1.0), Counted(1.0), Counted(1.0)};
+    const Counted s(2.0);
+
+    Counted::s_Defaults = 0;
+    CountedVec3 r = a + b * s - c;
+    EXPECT_EQ(Counted::s_Defaults, 3);  // only r itself
+    EXPECT_EQ(r, (CountedVec3{Counted(8.0), Counted(11.0), Counted(14.0)}));
+
+    Counted::s_Defaults = 0;
+    r = (a - c) * s + -b;
+    r += a * s - (b - c);
+    r -= -(a + c);
+    EXPECT_TRUE(r == (a - c) * s - b + a * s - (b - c) + a + c);
+    EXPECT_EQ(Counted::s_Defaults, 0);
+    EXPECT_EQ(r, (CountedVec3{Counted(-3.0), Counted(0.0), Counted(3.0)}));
+}
+
+TEST(VectorTests, HelpersAcceptExpressions)
+{
+    const Vec2f a{3.f, 0.f};
+    const Vec2f b{0.f, 4.f};
+
+    EXPECT_FLOAT_EQ(Length(b - a), 5.f);
+    EXPECT_FLOAT_EQ((b - a).Length(), 5.f);
+    EXPECT_FLOAT_EQ(Dot(a + b, a - b), -7.f);
+    EXPECT_TRUE(Normalize(a * 2.f).AlmostEqual(Vec2f{1.f, 0.f}));
+}